@@ -0,0 +1,132 @@
+#pragma once
+
+/**
+ * @file bench.h
+ * @brief Minimal benchmark harness for the native (host) build
+ *
+ * Each benchmark times every iteration individually and reports
+ * p50/p99/max latency plus heap allocations per iteration, so
+ * allocation churn in hot paths shows up next to the timings.
+ * check() turns a benchmark into a test: a failed check is reported
+ * under its line and makes the run exit nonzero.
+ *
+ * Usage:
+ *   BENCH(display_full_frame) {
+ *       DisplayDriver display;            // setup (not timed)
+ *       state.run([&] {                   // timed per iteration
+ *           renderFrame(display);
+ *       });
+ *       state.counter("refreshes", display.getRefreshCount());
+ *   }
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+// =============================================================================
+// Allocation tracking (global operator new/delete live in bench_main.cpp)
+// =============================================================================
+
+struct AllocStats {
+    uint64_t count = 0;     ///< Number of allocations
+    uint64_t bytes = 0;     ///< Total bytes requested
+    uint64_t peak = 0;      ///< Peak live heap above the level before the run (all threads)
+};
+
+/**
+ * @brief Allocation totals since process start
+ */
+AllocStats allocSnapshot();
+
+/**
+ * @brief Directory for image dumps (--dump-png), or nullptr if disabled
+ */
+const char* dumpDir();
+
+// =============================================================================
+// Benchmark state
+// =============================================================================
+
+class State {
+public:
+    explicit State(uint32_t iterations) : _iterations(iterations) {}
+
+    /**
+     * @brief Run fn for the configured iterations (after a short warmup)
+     */
+    void run(const std::function<void()>& fn);
+
+    /**
+     * @brief Attach an extra named value to the result line
+     */
+    void counter(const char* name, double value) { counters.emplace_back(name, value); }
+
+    /**
+     * @brief Fail the benchmark (and the run's exit code) unless ok
+     */
+    void check(bool ok, const char* what) {
+        if (!ok) failures.emplace_back(what);
+    }
+
+    uint32_t iterations() const { return _iterations; }
+
+    // Results (filled by run())
+    std::vector<uint64_t> samplesNs;
+    AllocStats allocs;
+    std::vector<std::pair<std::string, double>> counters;
+    std::vector<std::string> failures;
+
+private:
+    uint32_t _iterations;
+};
+
+/**
+ * @brief Report the median iteration as nanoseconds per operation
+ *
+ * For benches whose timed body loops over ops operations, to get below
+ * the timer's resolution.
+ */
+inline void reportNsPerOp(State& state, uint32_t ops) {
+    std::vector<uint64_t> samples = state.samplesNs;
+    if (samples.empty()) return;
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    state.counter("ns/op", static_cast<double>(samples[samples.size() / 2]) / ops);
+}
+
+// =============================================================================
+// Registry
+// =============================================================================
+
+using BenchFn = void (*)(State&);
+
+struct Entry {
+    const char* name;
+    BenchFn fn;
+    uint32_t iterations;
+};
+
+inline std::vector<Entry>& registry() {
+    static std::vector<Entry> entries;
+    return entries;
+}
+
+struct Registrar {
+    Registrar(const char* name, BenchFn fn, uint32_t iterations) {
+        registry().push_back({name, fn, iterations});
+    }
+};
+
+} // namespace bench
+
+#define BENCH_ITERS(name, iters)                                               \
+    static void bench_##name(bench::State& state);                             \
+    static bench::Registrar bench_registrar_##name(#name, bench_##name, iters); \
+    static void bench_##name(bench::State& state)
+
+#define BENCH(name) BENCH_ITERS(name, 200)
@@ -0,0 +1,859 @@
+/**
+ * @file bench_display.cpp
+ * @brief Frame rendering benchmarks (Compositor + screens + host panel)
+ *
+ * Frames are rendered the same way main.cpp's renderCurrentScreen() does:
+ * clear, status bar, screen content, then a full refresh or a diffed
+ * partial refresh. The host panel copies pixels instantly and refreshes
+ * run synchronously, so timings are pure CPU rasterization + diff cost
+ * (except the async_* benches, which simulate BUSY time).
+ *
+ * The incremental frame_* benches then check further frames against full
+ * redraws: the panel image must match byte for byte.
+ */
+
+#include "bench.h"
+#include "display/compositor.h"
+#include "display/display_driver.h"
+#include "ui/screens/hue_dashboard.h"
+#include "ui/screens/sensor_dashboard.h"
+#include "ui/screens/settings_actions.h"
+#include "ui/screens/settings_homekit.h"
+#include "ui/screens/settings_hue.h"
+#include "ui/screens/settings_info.h"
+#include "ui/screens/settings_tado.h"
+#include "ui/screens/tado_control.h"
+#include "ui/status_bar.h"
+#include "host/png_writer.h"
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <string>
+
+using namespace paperhome;
+
+namespace {
+
+/**
+ * @brief Display stack shared by the frame benchmarks
+ */
+struct FrameRig {
+    DisplayDriver display;
+    Compositor compositor{display};
+    StatusBar statusBar;
+
+    FrameRig() {
+        display.init();
+        display.setAsyncRefresh(false);
+        display.panel().resetCounters();
+
+        StatusBarData data;
+        data.wifiConnected = true;
+        data.wifiRSSI = -55;
+        data.mqttConnected = true;
+        data.hueConnected = true;
+        data.tadoConnected = true;
+        data.temperature = 22.4f;
+        data.co2 = 640;
+        data.batteryPercent = 85;
+        statusBar.setData(data);
+    }
+
+    /**
+     * @brief Mirrors renderCurrentScreen() in main.cpp
+     */
+    void renderFrame(Screen& screen, bool full) {
+        display.noteInput();  // Frames are input-driven: no idle clean-up
+        compositor.beginFrame(screen.isRetained() ? Compositor::FrameMode::IMMEDIATE
+                                                  : Compositor::FrameMode::RECORDED);
+        if (full || !screen.isRetained()) {
+            compositor.fillScreen(true);
+            screen.invalidateAll();
+        }
+        if (screen.hasStatusBar()) {
+            statusBar.render(compositor);
+        }
+        screen.render(compositor);
+
+        if (full) {
+            compositor.endFrameFull();
+        } else {
+            compositor.endFrame();
+        }
+
+        screen.clearDirty();
+    }
+
+    /**
+     * @brief Redraw the whole scene, as non-retained screens do
+     */
+    void renderScene(Screen& screen, Compositor::FrameMode mode) {
+        display.noteInput();
+        compositor.beginFrame(mode);
+        compositor.fillScreen(true);
+        screen.invalidateAll();
+        statusBar.render(compositor);
+        screen.render(compositor);
+        compositor.endFrame();
+        screen.clearDirty();
+    }
+
+    void reportPanel(bench::State& state, uint32_t frames) {
+        auto& panel = display.panel();
+        state.counter("full", panel.getFullRefreshCount());
+        state.counter("partial", panel.getPartialRefreshCount());
+        state.counter("px/frame", frames ? static_cast<double>(panel.getPixelsRefreshed()) / frames : 0);
+        state.counter("windows", compositor.getLastFrameWindows());
+    }
+};
+
+/**
+ * @brief Rasterize a recording offscreen and write it as <dumpDir>/<name>.png
+ */
+void dumpRecording(const DisplayList& list, const char* name) {
+    if (!bench::dumpDir()) return;
+
+    static DisplayDriver offscreen;
+    static bool ready = offscreen.init();
+    if (!ready) return;
+    offscreen.setAsyncRefresh(false);
+
+    offscreen.fillScreen(true);
+    list.rasterize(offscreen);
+
+    // Framebuffer is panel-native; golden images are in logical orientation
+    Framebuffer& fb = offscreen.framebuffer();
+    const int16_t width = fb.width();
+    const int16_t height = fb.height();
+    const size_t stride = (width + 7) / 8;
+    std::vector<uint8_t> rows(stride * height, 0);
+    const uint8_t* native = fb.getBuffer();
+    for (int16_t y = 0; y < height; y++) {
+        for (int16_t x = 0; x < width; x++) {
+            Rect n = fb.mapToNative(Rect(x, y, 1, 1));
+            if (native[n.y * Framebuffer::STRIDE_BYTES + (n.x >> 3)] & (0x80 >> (n.x & 7))) {
+                rows[y * stride + (x >> 3)] |= 0x80 >> (x & 7);
+            }
+        }
+    }
+
+    std::string path = std::string(bench::dumpDir()) + "/" + name + ".png";
+    host::png::writeGray1(path.c_str(), width, height, rows.data(), stride);
+}
+
+/**
+ * @brief Whether rig's panel shows what a full redraw of screen shows
+ *
+ * A reference rig with the same status bar data redraws everything and
+ * full-refreshes; the two panel images must match byte for byte.
+ */
+bool matchesFullRedraw(FrameRig& rig, Screen& screen) {
+    static std::unique_ptr<FrameRig> reference(new FrameRig());
+    reference->statusBar.setData(rig.statusBar.getData());
+    reference->renderFrame(screen, true);
+
+    rig.display.waitIdle();
+    return memcmp(rig.display.panel().getPanelImage(),
+                  reference->display.panel().getPanelImage(), Framebuffer::SIZE_BYTES) == 0;
+}
+
+/**
+ * @brief Run frames more steps after the timed loop, checking each frame
+ *        against a full redraw
+ */
+template<typename Step>
+void checkAgainstFullRedraws(bench::State& state, FrameRig& rig, Screen& screen, Step&& step,
+                             uint32_t frames = 12) {
+    bool match = true;
+    for (uint32_t i = 0; i < frames && match; i++) {
+        step();
+        match = matchesFullRedraw(rig, screen);
+    }
+    state.check(match, "partial frame differs from a full redraw");
+}
+
+// Every font in display/fonts.h
+const GFXfont* const ALL_FONTS[] = {
+    &FreeMonoBold24pt7b, &FreeMonoBold18pt7b, &FreeMonoBold12pt7b, &FreeMonoBold9pt7b,
+    &FreeMono9pt7b, &FreeSansBold18pt7b, &FreeSansBold12pt7b, &FreeSansBold9pt7b,
+    &FreeSans12pt7b, &FreeSans9pt7b
+};
+constexpr size_t ALL_FONT_COUNT = sizeof(ALL_FONTS) / sizeof(ALL_FONTS[0]);
+
+std::vector<HueRoom> makeRooms(int count) {
+    static const char* const names[] = {
+        "Living Room", "Kitchen", "Bedroom", "Office", "Bathroom",
+        "Hallway", "Dining", "Guest Room", "Kids Room"
+    };
+    std::vector<HueRoom> rooms;
+    for (int i = 0; i < count; i++) {
+        HueRoom room;
+        room.id = std::to_string(i + 1);
+        room.name = names[i % 9];
+        room.isOn = (i % 3) != 0;
+        room.brightness = static_cast<uint8_t>((i * 23) % 100);
+        room.lightCount = static_cast<uint8_t>(2 + i % 4);
+        rooms.push_back(room);
+    }
+    return rooms;
+}
+
+SensorData makeSensorData() {
+    SensorData data;
+    data.co2 = 640;
+    data.temperature = 22.4f;
+    data.humidity = 46.0f;
+    data.iaq = 42;
+    data.iaqAccuracy = 3;
+    data.pressure = 1013.2f;
+    data.stcc4Connected = true;
+    data.bme688Connected = true;
+    for (size_t i = 0; i < data.co2History.size(); i++) {
+        data.co2History[i] = static_cast<int16_t>(500 + i * 3);
+        data.tempHistory[i] = static_cast<int16_t>(2200 + i);
+        data.humidityHistory[i] = static_cast<int16_t>(4500 - i);
+        data.iaqHistory[i] = static_cast<int16_t>(40 + i % 10);
+        data.pressureHistory[i] = static_cast<int16_t>(10130 + i % 5);
+    }
+    data.historyCount = static_cast<uint8_t>(data.co2History.size());
+    return data;
+}
+
+} // namespace
+
+BENCH(frame_full_hue_dashboard) {
+    auto rig = std::make_unique<FrameRig>();
+    HueDashboard screen;
+    screen.setRooms(makeRooms(9));
+    screen.onEnter();
+
+    state.run([&] { rig->renderFrame(screen, true); });
+
+    rig->reportPanel(state, rig->display.panel().getFullRefreshCount());
+}
+
+BENCH(frame_full_sensor_dashboard) {
+    auto rig = std::make_unique<FrameRig>();
+    SensorDashboard screen;
+    screen.setSensorData(makeSensorData());
+    screen.onEnter();
+
+    state.run([&] { rig->renderFrame(screen, true); });
+
+    rig->reportPanel(state, rig->display.panel().getFullRefreshCount());
+}
+
+BENCH(frame_selection_move_hue_dashboard) {
+    auto rig = std::make_unique<FrameRig>();
+    HueDashboard screen;
+    screen.setRooms(makeRooms(9));
+    screen.onEnter();
+    rig->renderFrame(screen, true);
+    rig->display.panel().resetCounters();
+
+    // Walk the 3x3 grid: right, right, down, ... exercising every tile
+    static const NavEvent moves[] = {
+        NavEvent::SELECT_RIGHT, NavEvent::SELECT_RIGHT, NavEvent::SELECT_DOWN,
+        NavEvent::SELECT_LEFT, NavEvent::SELECT_LEFT, NavEvent::SELECT_DOWN,
+        NavEvent::SELECT_RIGHT, NavEvent::SELECT_RIGHT, NavEvent::SELECT_UP,
+        NavEvent::SELECT_UP, NavEvent::SELECT_LEFT, NavEvent::SELECT_LEFT
+    };
+    size_t step = 0;
+    uint32_t frames = 0;
+
+    auto move = [&] {
+        screen.handleEvent(moves[step++ % (sizeof(moves) / sizeof(moves[0]))]);
+        rig->renderFrame(screen, false);
+        frames++;
+    };
+    state.run(move);
+
+    rig->reportPanel(state, frames);
+    checkAgainstFullRedraws(state, *rig, screen, move);
+}
+
+BENCH(frame_hue_room_update) {
+    auto rig = std::make_unique<FrameRig>();
+    HueDashboard screen;
+    std::vector<HueRoom> rooms = makeRooms(9);
+    screen.setRooms(rooms);
+    screen.onEnter();
+    rig->renderFrame(screen, true);
+    rig->display.panel().resetCounters();
+
+    // One room's brightness changes per frame; only its tile repaints
+    uint32_t frames = 0;
+
+    auto update = [&] {
+        HueRoom& room = rooms[frames % rooms.size()];
+        room.brightness = static_cast<uint8_t>((room.brightness + 7) % 100);
+        screen.setRooms(rooms);
+        rig->renderFrame(screen, false);
+        frames++;
+    };
+    state.run(update);
+
+    rig->reportPanel(state, frames);
+    checkAgainstFullRedraws(state, *rig, screen, update);
+}
+
+BENCH(frame_tado_zone_update) {
+    auto rig = std::make_unique<FrameRig>();
+    TadoControl screen;
+    std::vector<TadoZone> zones(3);
+    for (size_t i = 0; i < zones.size(); i++) {
+        zones[i].id = std::to_string(i + 1);
+        zones[i].name = "Zone " + std::to_string(i + 1);
+        zones[i].currentTemp = 20.0f + i;
+        zones[i].targetTemp = 21.0f;
+        zones[i].humidity = 45.0f;
+    }
+    screen.setZones(zones);
+    screen.onEnter();
+    rig->renderFrame(screen, true);
+    rig->display.panel().resetCounters();
+
+    // Every zone's reading jitters below the 0.1 °C shown; one zone's
+    // reading moves a full tenth per frame and only it repaints
+    uint32_t frames = 0;
+    bool jitterIgnored = true;
+
+    auto update = [&] {
+        for (TadoZone& zone : zones) {
+            zone.currentTemp += (frames % 2) ? -0.01f : 0.01f;
+        }
+        screen.setZones(zones);
+        jitterIgnored &= !screen.isDirty();
+
+        zones[frames % zones.size()].currentTemp += 0.1f;
+        screen.setZones(zones);
+        rig->renderFrame(screen, false);
+        frames++;
+    };
+    state.run(update);
+
+    rig->reportPanel(state, frames);
+    state.check(jitterIgnored, "change below the shown resolution invalidated a zone");
+    checkAgainstFullRedraws(state, *rig, screen, update);
+}
+
+BENCH(frame_sensor_value_update) {
+    auto rig = std::make_unique<FrameRig>();
+    SensorDashboard screen;
+    SensorData data = makeSensorData();
+    screen.setSensorData(data);
+    screen.onEnter();
+    rig->renderFrame(screen, true);
+    rig->display.panel().resetCounters();
+
+    // New CO2 reading each frame, no navigation
+    uint32_t frames = 0;
+
+    auto update = [&] {
+        data.co2 = static_cast<uint16_t>(600 + (frames % 50) * 7);
+        screen.setSensorData(data);
+        rig->renderFrame(screen, false);
+        frames++;
+    };
+    state.run(update);
+
+    rig->reportPanel(state, frames);
+    checkAgainstFullRedraws(state, *rig, screen, update);
+}
+
+BENCH(frame_status_bar_and_sensor_update) {
+    auto rig = std::make_unique<FrameRig>();
+    SensorDashboard screen;
+    SensorData data = makeSensorData();
+    screen.setSensorData(data);
+    screen.onEnter();
+    rig->renderFrame(screen, true);
+    rig->display.panel().resetCounters();
+
+    // Status bar temperature and a dashboard reading change together;
+    // these should stay separate windows rather than one near-full rect
+    uint32_t frames = 0;
+    StatusBarData bar;
+    bar.wifiConnected = true;
+    bar.co2 = 640;
+    bar.batteryPercent = 85;
+
+    auto update = [&] {
+        bar.temperature = 20.0f + (frames % 40) * 0.1f;
+        rig->statusBar.setData(bar);
+        data.pressure = 1000.0f + (frames % 30);
+        screen.setSensorData(data);
+        rig->renderFrame(screen, false);
+        frames++;
+    };
+    state.run(update);
+
+    rig->reportPanel(state, frames);
+    checkAgainstFullRedraws(state, *rig, screen, update);
+}
+
+/**
+ * @brief Status mailbox update over an unchanged retained screen
+ *
+ * Mirrors applyServiceSnapshots(): only the status bar is repainted, so
+ * the refresh must stay inside it.
+ */
+BENCH(frame_status_bar_update_retained) {
+    auto rig = std::make_unique<FrameRig>();
+    HueDashboard screen;
+    screen.setRooms(makeRooms(9));
+    screen.onEnter();
+    rig->renderFrame(screen, true);
+    rig->display.panel().resetCounters();
+
+    uint32_t frames = 0;
+    StatusBarData bar = rig->statusBar.getData();
+    bool insideBar = true;
+
+    auto update = [&] {
+        bar.co2 = static_cast<uint16_t>(600 + frames % 50);
+        rig->statusBar.setData(bar);
+        rig->renderFrame(screen, false);
+        Rect bounds = rig->compositor.getLastRefreshBounds();
+        insideBar &= bounds.y >= StatusBar::Y && bounds.bottom() <= StatusBar::Y + StatusBar::HEIGHT;
+        frames++;
+    };
+    state.run(update);
+
+    rig->reportPanel(state, frames);
+    state.check(insideBar, "status update refreshed outside the status bar");
+    checkAgainstFullRedraws(state, *rig, screen, update);
+}
+
+BENCH(frame_status_bar_only) {
+    auto rig = std::make_unique<FrameRig>();
+
+    state.run([&] {
+        rig->compositor.beginFrame();
+        rig->statusBar.render(rig->compositor);
+        rig->compositor.endFrame();
+    });
+
+    rig->reportPanel(state, rig->display.panel().getPartialRefreshCount());
+}
+
+BENCH(text_labels_atlas) {
+    auto rig = std::make_unique<FrameRig>();
+    static const char* labels[] = {"Living Room", "Kitchen", "22.5 C", "Brightness 80%", "Office"};
+
+    state.run([&] {
+        for (int i = 0; i < 5; i++) {
+            rig->compositor.drawTextCentered(labels[i], 20, 100 + i * 60, 440,
+                                             &FreeSansBold12pt7b, true);
+        }
+    });
+
+    const FontCache& fonts = rig->display.fontCache();
+    state.counter("bounds_hits", fonts.getHits());
+    state.counter("bounds_misses", fonts.getMisses());
+}
+
+BENCH(text_labels_gfx_print) {
+    auto rig = std::make_unique<FrameRig>();
+    static const char* labels[] = {"Living Room", "Kitchen", "22.5 C", "Brightness 80%", "Office"};
+    Framebuffer& fb = rig->display.framebuffer();
+    fb.setFont(&FreeSansBold12pt7b);
+    fb.setTextColor(GxEPD_BLACK);
+
+    // Baseline: Adafruit GFX per-pixel glyph walk plus getTextBounds
+    state.run([&] {
+        for (int i = 0; i < 5; i++) {
+            int16_t x1, y1;
+            uint16_t w, h;
+            fb.getTextBounds(labels[i], 0, 0, &x1, &y1, &w, &h);
+            fb.setCursor(20 + (440 - w) / 2 - x1, 100 + i * 60);
+            fb.print(labels[i]);
+        }
+    });
+}
+
+/**
+ * @brief Atlas text against Adafruit GFX print, byte for byte
+ *
+ * Every printable glyph of every font, in all four rotations, black on
+ * white and white on black, at x offsets that are not byte-aligned. The
+ * back buffers must match and drawText() must return the bounds
+ * getTextBounds() computes.
+ */
+BENCH_ITERS(text_atlas_matches_gfx, 1) {
+    auto rig = std::make_unique<FrameRig>();
+    DisplayDriver& display = rig->display;
+    Framebuffer& fb = display.framebuffer();
+    const GFXfont* const* fonts = ALL_FONTS;
+    const size_t fontCount = ALL_FONT_COUNT;
+    const uint8_t originalRotation = fb.getRotation();
+
+    std::vector<uint8_t> atlasImage(Framebuffer::SIZE_BYTES);
+    uint32_t cases = 0;
+    uint32_t pixelMismatches = 0;
+    uint32_t boundsMismatches = 0;
+    uint32_t fallbacks = 0;
+    FontCache atlases;
+
+    // Lines of 16 glyphs covering ' '..'~'
+    auto draw = [&](const GFXfont* font, bool black, bool atlas) {
+        display.fillScreen(black);
+        display.setFont(font);
+        display.setTextColor(black);
+        for (int line = 0; line < 6; line++) {
+            char text[17];
+            int length = 0;
+            for (int c = 32 + line * 16; c < 32 + (line + 1) * 16 && c <= 126; c++) {
+                text[length++] = static_cast<char>(c);
+            }
+            text[length] = '\0';
+
+            const int16_t x = static_cast<int16_t>(5 + line * 3);
+            const int16_t y = static_cast<int16_t>(font->yAdvance * (line + 1));
+            if (atlas) {
+                const Rect drawn = display.drawText(text, x, y);
+                int16_t x1, y1;
+                uint16_t w, h;
+                fb.getTextBounds(text, x, y, &x1, &y1, &w, &h);
+                boundsMismatches += drawn != Rect(x1, y1, w, h);
+            } else {
+                fb.setCursor(x, y);
+                fb.print(text);
+            }
+        }
+    };
+
+    state.run([&] {
+        for (uint8_t rotation = 0; rotation < 4; rotation++) {
+            fb.setRotation(rotation);
+            for (size_t f = 0; f < fontCount; f++) {
+                fallbacks += atlases.atlas(fonts[f], rotation) == nullptr;
+                for (bool black : {true, false}) {
+                    draw(fonts[f], black, true);
+                    memcpy(atlasImage.data(), fb.getBuffer(), Framebuffer::SIZE_BYTES);
+                    draw(fonts[f], black, false);
+                    pixelMismatches += memcmp(atlasImage.data(), fb.getBuffer(), Framebuffer::SIZE_BYTES) != 0;
+                    cases++;
+                }
+            }
+        }
+    });
+    fb.setRotation(originalRotation);
+
+    state.check(fallbacks == 0, "font without an atlas (compared GFX with itself)");
+    state.check(pixelMismatches == 0, "atlas text pixels differ from GFX print");
+    state.check(boundsMismatches == 0, "drawText bounds differ from getTextBounds");
+    state.counter("cases", cases);
+    state.counter("fonts", static_cast<double>(fontCount));
+}
+
+/**
+ * @brief Every screen (and settings state) draws through at most one atlas per font
+ *
+ * Atlases are keyed by GFXfont address, so a font header compiled into
+ * several files would fill the FontCache slots with duplicates and make
+ * later screens fall back to GFX print.
+ */
+BENCH_ITERS(text_atlas_per_font_all_screens, 1) {
+    auto rig = std::make_unique<FrameRig>();
+    uint32_t frames = 0;
+
+    auto show = [&](Screen& screen) {
+        screen.onEnter();
+        rig->renderFrame(screen, true);
+        frames++;
+    };
+
+    state.run([&] {
+        HueDashboard hue;
+        hue.setRooms(makeRooms(9));
+        show(hue);
+
+        SensorDashboard sensors;
+        sensors.setSensorData(makeSensorData());
+        show(sensors);
+
+        TadoControl tado;
+        std::vector<TadoZone> zones(2);
+        for (size_t i = 0; i < zones.size(); i++) {
+            zones[i].id = std::to_string(i + 1);
+            zones[i].name = "Zone " + std::to_string(i + 1);
+            zones[i].currentTemp = 20.5f;
+            zones[i].targetTemp = 21.0f;
+            zones[i].humidity = 45.0f;
+        }
+        tado.setZones(zones);
+        show(tado);
+
+        SettingsInfo info;
+        DeviceInfo device;
+        device.wifiSSID = "PaperHome";
+        device.ipAddress = "192.168.1.20";
+        device.wifiConnected = true;
+        device.hueConnected = true;
+        device.hueBridgeIP = "192.168.1.2";
+        device.hueRoomCount = 9;
+        info.setDeviceInfo(device);
+        show(info);
+
+        SettingsHue settingsHue;
+        for (HueState hueState : {HueState::DISCONNECTED, HueState::DISCOVERING,
+                                  HueState::WAITING_FOR_BUTTON, HueState::AUTHENTICATING,
+                                  HueState::CONNECTED, HueState::ERROR}) {
+            settingsHue.setState(hueState, "192.168.1.2", 9);
+            show(settingsHue);
+        }
+
+        SettingsTado settingsTado;
+        TadoAuthInfo auth = {};
+        strcpy(auth.verifyUrl, "https://login.tado.com/device?user_code=ABC123");
+        strcpy(auth.userCode, "ABC123");
+        auth.expiresInSeconds = 300;
+        settingsTado.setAuthInfo(auth);
+        for (TadoState tadoState : {TadoState::DISCONNECTED, TadoState::AWAITING_AUTH,
+                                    TadoState::AUTHENTICATING, TadoState::VERIFYING,
+                                    TadoState::CONNECTED, TadoState::ERROR}) {
+            settingsTado.setState(tadoState, 2);
+            show(settingsTado);
+        }
+
+        SettingsHomeKit homeKit;
+        for (bool paired : {false, true}) {
+            homeKit.setPaired(paired);
+            show(homeKit);
+        }
+
+        SettingsActions actions;
+        show(actions);
+    });
+
+    const FontCache& fonts = rig->display.fontCache();
+    state.check(fonts.getAtlasCount() <= ALL_FONT_COUNT, "more atlases than fonts (duplicate GFXfont copies)");
+    state.check(fonts.getFallbacks() == 0, "text fell back to GFX print");
+    state.counter("atlases", fonts.getAtlasCount());
+    state.counter("fallbacks", fonts.getFallbacks());
+    state.counter("frames", frames);
+}
+
+static void benchSceneRoomUpdate(bench::State& state, Compositor::FrameMode mode) {
+    auto rig = std::make_unique<FrameRig>();
+    HueDashboard screen;
+    std::vector<HueRoom> rooms = makeRooms(9);
+    screen.setRooms(rooms);
+    screen.onEnter();
+    rig->renderScene(screen, mode);
+    rig->display.panel().resetCounters();
+
+    // Whole scene is redrawn every frame, but only one tile's content changes
+    uint32_t frames = 0;
+
+    state.run([&] {
+        HueRoom& room = rooms[frames % rooms.size()];
+        room.brightness = static_cast<uint8_t>((room.brightness + 7) % 100);
+        screen.setRooms(rooms);
+        rig->renderScene(screen, mode);
+        frames++;
+    });
+
+    rig->reportPanel(state, frames);
+    if (mode == Compositor::FrameMode::RECORDED) {
+        state.counter("recorded", rig->compositor.getLastRecordedCommands());
+        state.counter("replayed", rig->compositor.getLastReplayedCommands());
+        dumpRecording(rig->compositor.getLastRecording(), "scene_hue_room_update_recorded");
+    }
+
+    checkAgainstFullRedraws(state, *rig, screen, [&] {
+        HueRoom& room = rooms[frames++ % rooms.size()];
+        room.brightness = static_cast<uint8_t>((room.brightness + 7) % 100);
+        screen.setRooms(rooms);
+        rig->renderScene(screen, mode);
+    });
+}
+
+BENCH(scene_hue_room_update_immediate) {
+    benchSceneRoomUpdate(state, Compositor::FrameMode::IMMEDIATE);
+}
+
+BENCH(scene_hue_room_update_recorded) {
+    benchSceneRoomUpdate(state, Compositor::FrameMode::RECORDED);
+}
+
+/**
+ * @brief Whether recording commands as the next frame leaves the panel as
+ *        drawing them immediately and full-refreshing does
+ */
+static bool recordedMatchesImmediate(FrameRig& rig, std::initializer_list<DrawCommand> commands) {
+    rig.compositor.beginFrame(Compositor::FrameMode::RECORDED);
+    for (const DrawCommand& cmd : commands) rig.compositor.submit(cmd);
+    rig.compositor.endFrame();
+
+    static std::unique_ptr<FrameRig> reference(new FrameRig());
+    Compositor& immediate = reference->compositor;
+    immediate.beginFrame(Compositor::FrameMode::IMMEDIATE);
+    immediate.fillScreen(true);
+    for (const DrawCommand& cmd : commands) immediate.submit(cmd);
+    immediate.endFrameFull();
+
+    rig.display.waitIdle();
+    return memcmp(rig.display.panel().getPanelImage(),
+                  reference->display.panel().getPanelImage(), Framebuffer::SIZE_BYTES) == 0;
+}
+
+/**
+ * @brief Recorded frames whose commands differ only in order or in
+ *        bitmap contents
+ *
+ * A content-only diff finds nothing to redraw in each of these.
+ */
+BENCH_ITERS(display_list_order_and_contents, 1) {
+    auto rig = std::make_unique<FrameRig>();
+    const DrawCommand fill = DrawCommand::fillRect(40, 40, 200, 60, true);
+    const DrawCommand label = DrawCommand::text("Swap", 60, 80, &FreeSansBold18pt7b, false);
+    const DrawCommand invert = DrawCommand::invertRect(40, 150, 120, 40);
+    const DrawCommand block = DrawCommand::fillRect(60, 160, 60, 20, true);
+    static uint8_t pixels[4 * 16];
+    const DrawCommand icon = DrawCommand::bitmap(300, 60, pixels, 32, 16, true);
+
+    bool swapped = false, inverted = false, redrawn = false;
+    state.run([&] {
+        recordedMatchesImmediate(*rig, {fill, label});
+        swapped = recordedMatchesImmediate(*rig, {label, fill});
+
+        recordedMatchesImmediate(*rig, {invert, block, invert});
+        inverted = recordedMatchesImmediate(*rig, {invert, invert, block});
+
+        memset(pixels, 0xAA, sizeof(pixels));
+        recordedMatchesImmediate(*rig, {icon});
+        memset(pixels, 0x0F, sizeof(pixels));
+        redrawn = recordedMatchesImmediate(*rig, {icon});
+    });
+
+    state.check(swapped, "overlapping commands swapped order without a redraw");
+    state.check(inverted, "reordered inverts left a stale region");
+    state.check(redrawn, "bitmap redrawn in place kept its old pixels");
+}
+
+/**
+ * @brief Selection moves while the panel is BUSY with earlier refreshes
+ *
+ * Measures UI-side frame latency (render + endFrame) with a simulated
+ * partial refresh time; "coalesced" counts requests merged into a later
+ * refresh instead of blocking the frame.
+ */
+static void benchSelectionUnderBusy(bench::State& state, bool async) {
+    auto rig = std::make_unique<FrameRig>();
+    HueDashboard screen;
+    screen.setRooms(makeRooms(9));
+    screen.onEnter();
+    rig->renderFrame(screen, true);
+
+    rig->display.setAsyncRefresh(async);
+    rig->display.panel().setBusyTime(0, 20);
+    rig->display.panel().resetCounters();
+
+    uint32_t frames = 0;
+    state.run([&] {
+        screen.handleEvent(frames % 2 ? NavEvent::SELECT_LEFT : NavEvent::SELECT_RIGHT);
+        rig->renderFrame(screen, false);
+        frames++;
+    });
+    rig->display.waitIdle();
+
+    state.counter("refreshes", rig->display.getRefreshCount());
+    state.counter("coalesced", rig->display.getCoalescedCount());
+    rig->reportPanel(state, frames);
+}
+
+BENCH_ITERS(async_selection_under_busy, 40) {
+    benchSelectionUnderBusy(state, true);
+}
+
+BENCH_ITERS(sync_selection_under_busy, 40) {
+    benchSelectionUnderBusy(state, false);
+}
+
+/**
+ * @brief Ghosting clean-up after a burst of selection moves
+ *
+ * Selection moves keep flipping the same tiles; once input goes idle the
+ * scheduler cleans only the worn regions. Reports the over-budget tiles
+ * and how much of the panel the clean-up touched versus a full refresh.
+ */
+BENCH_ITERS(ghosting_cleanup_after_selection_burst, 20) {
+    auto rig = std::make_unique<FrameRig>();
+    HueDashboard screen;
+    screen.setRooms(makeRooms(9));
+    screen.onEnter();
+    rig->renderFrame(screen, true);
+
+    static const NavEvent moves[] = {NavEvent::SELECT_RIGHT, NavEvent::SELECT_LEFT};
+    uint16_t overBudget = 0;
+    uint64_t cleanedPixels = 0;
+    uint32_t frames = 0;
+
+    state.run([&] {
+        for (uint8_t i = 0; i < config::display::GHOST_PARTIAL_BUDGET; i++) {
+            screen.handleEvent(moves[frames++ % 2]);
+            rig->renderFrame(screen, false);
+        }
+        overBudget = rig->display.refreshScheduler().getTilesOverBudget();
+
+        // Idle: the next service() issues the clean-up
+        delay(config::display::GHOST_IDLE_MS);
+        rig->display.panel().resetCounters();
+        rig->display.service();
+        cleanedPixels = rig->display.panel().getPixelsRefreshed();
+    });
+
+    state.counter("over_budget_tiles", overBudget);
+    state.counter("cleanups", rig->display.getCleanupCount());
+    state.counter("clean_px", static_cast<double>(cleanedPixels));
+    state.counter("full_px", static_cast<double>(Framebuffer::SIZE_BYTES) * 8);
+}
+
+/**
+ * @brief Scattered dirty rects past MAX_RECTS (status bar, tiles, labels)
+ *
+ * Without a per-window overhead scattered rects rarely merge on cost, so
+ * every frame adds more than the accumulator keeps and it force-merges. The kept set must still cover every rect added and never
+ * overlap: overlapping windows would be refreshed twice.
+ */
+BENCH(dirty_rects_overflow) {
+    DirtyRectAccumulator dirty(0);
+    std::vector<Rect> added;
+    uint32_t seed = 1;
+    auto next = [&seed](uint32_t range) {
+        seed = seed * 1103515245u + 12345u;
+        return static_cast<int16_t>((seed >> 16) % range);
+    };
+
+    bool overlapping = false;
+    bool uncovered = false;
+    state.run([&] {
+        dirty.reset();
+        added.clear();
+        for (int i = 0; i < 24; i++) {
+            Rect rect(next(760), next(440), 8 + next(40), 8 + next(24));
+            added.push_back(rect);
+            dirty.add(rect);
+        }
+
+        for (uint8_t i = 0; i < dirty.count(); i++) {
+            for (uint8_t j = i + 1; j < dirty.count(); j++) {
+                overlapping |= dirty[i].intersects(dirty[j]);
+            }
+        }
+        for (const Rect& rect : added) {
+            int32_t covered = 0;
+            for (const Rect& kept : dirty) {
+                covered += kept.intersection(rect).area();
+            }
+            uncovered |= covered < rect.area();
+        }
+    });
+
+    state.check(!overlapping, "kept rects overlap");
+    state.check(!uncovered, "added rect not covered");
+    state.counter("rects", dirty.count());
+    state.counter("area", dirty.totalArea());
+}
@@ -0,0 +1,113 @@
+/**
+ * @file bench_events.cpp
+ * @brief Event bus publish latency: EventBus vs StaticEventBus
+ *
+ * Each timed iteration publishes OPS_PER_ITER events to 1, 8 or 32
+ * subscribers of the same type; ns/op is per publish (all subscribers).
+ * EventBus runs on the host mutex stand-in (native/include/freertos).
+ */
+
+#include "bench.h"
+#include "core/event_bus.h"
+#include "core/static_event_bus.h"
+#include <memory>
+
+using namespace paperhome;
+
+namespace {
+
+constexpr uint32_t OPS_PER_ITER = 256;
+
+struct TickEvent : Event {
+    uint32_t value;
+};
+
+struct OtherEvent : Event {
+    uint8_t payload[24];
+};
+
+using BenchBus = StaticEventBus<EventList<OtherEvent, TickEvent>, 32, 16>;
+
+uint32_t g_delivered = 0;
+
+void onTick(const TickEvent& event, void*) {
+    g_delivered += event.value;
+}
+
+/**
+ * @brief Publish through the global EventBus to n subscribers
+ */
+void runEventBus(bench::State& state, size_t subscribers) {
+    EventBus& bus = EventBus::instance();
+    bus.init();
+    bus.clear();
+    for (size_t i = 0; i < subscribers; i++) {
+        bus.subscribe<TickEvent>([](const TickEvent& event) { g_delivered += event.value; });
+    }
+
+    TickEvent event;
+    event.value = 1;
+    state.run([&] {
+        for (uint32_t i = 0; i < OPS_PER_ITER; i++) {
+            bus.publish(event);
+        }
+    });
+
+    bus.clear();
+    bench::reportNsPerOp(state, OPS_PER_ITER);
+}
+
+/**
+ * @brief Publish inline through a StaticEventBus to n subscribers
+ */
+void runStaticBus(bench::State& state, size_t subscribers) {
+    auto bus = std::make_unique<BenchBus>();
+    for (size_t i = 0; i < subscribers; i++) {
+        bus->subscribe<TickEvent>(&onTick);
+    }
+
+    TickEvent event;
+    event.value = 1;
+    state.run([&] {
+        for (uint32_t i = 0; i < OPS_PER_ITER; i++) {
+            bus->publish(event);
+        }
+    });
+
+    bench::reportNsPerOp(state, OPS_PER_ITER);
+}
+
+/**
+ * @brief Post to a StaticEventBus queue, then dispatch the batch
+ */
+void runStaticBusDeferred(bench::State& state, size_t subscribers) {
+    auto bus = std::make_unique<BenchBus>();
+    for (size_t i = 0; i < subscribers; i++) {
+        bus->subscribe<TickEvent>(&onTick);
+    }
+
+    TickEvent event;
+    event.value = 1;
+    state.run([&] {
+        for (uint32_t i = 0; i < OPS_PER_ITER; i += 8) {
+            for (uint32_t j = 0; j < 8; j++) bus->post(event);
+            bus->dispatch();
+        }
+    });
+
+    bench::reportNsPerOp(state, OPS_PER_ITER);
+}
+
+} // namespace
+
+BENCH_ITERS(event_bus_publish_1, 1000) { runEventBus(state, 1); }
+BENCH_ITERS(event_bus_publish_8, 1000) { runEventBus(state, 8); }
+BENCH_ITERS(event_bus_publish_32, 1000) { runEventBus(state, 32); }
+
+BENCH_ITERS(static_event_bus_publish_1, 1000) { runStaticBus(state, 1); }
+BENCH_ITERS(static_event_bus_publish_8, 1000) { runStaticBus(state, 8); }
+BENCH_ITERS(static_event_bus_publish_32, 1000) { runStaticBus(state, 32); }
+
+BENCH_ITERS(static_event_bus_deferred_1, 1000) { runStaticBusDeferred(state, 1); }
+BENCH_ITERS(static_event_bus_deferred_8, 1000) { runStaticBusDeferred(state, 8); }
+BENCH_ITERS(static_event_bus_deferred_32, 1000) { runStaticBusDeferred(state, 32); }
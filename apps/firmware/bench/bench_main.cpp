@@ -0,0 +1,178 @@
+/**
+ * @file bench_main.cpp
+ * @brief Benchmark runner for the native build
+ *
+ * Usage: program [--filter <substring>] [--iterations <n>] [--dump-png <dir>]
+ *
+ * --dump-png writes the final recorded frame of benchmarks that record a
+ * display list to <dir>/<benchmark>.png (golden images for diffing).
+ *
+ * Output is one line per benchmark, stable enough to diff between runs:
+ *   name  iters  p50_us  p99_us  max_us  allocs/op  bytes/op  [counters]
+ *
+ * Failed checks follow their benchmark's line as "FAIL <name>: <check>";
+ * the exit code is then 1.
+ */
+
+#include "bench.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
+#include <new>
+
+// =============================================================================
+// Allocation counting
+// =============================================================================
+
+namespace {
+
+std::atomic<uint64_t> g_allocCount{0};
+std::atomic<uint64_t> g_allocBytes{0};
+std::atomic<int64_t> g_liveBytes{0};
+std::atomic<int64_t> g_peakBytes{0};
+const char* g_dumpDir = nullptr;
+
+void* countedAlloc(size_t size) {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+
+    // Live bytes as the allocator sees them (usable size, both directions)
+    int64_t live = g_liveBytes.fetch_add(malloc_usable_size(p), std::memory_order_relaxed) +
+                   static_cast<int64_t>(malloc_usable_size(p));
+    int64_t peak = g_peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !g_peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    return p;
+}
+
+void countedFree(void* p) {
+    if (!p) return;
+    g_liveBytes.fetch_sub(malloc_usable_size(p), std::memory_order_relaxed);
+    std::free(p);
+}
+
+} // namespace
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { countedFree(p); }
+void operator delete[](void* p) noexcept { countedFree(p); }
+void operator delete(void* p, size_t) noexcept { countedFree(p); }
+void operator delete[](void* p, size_t) noexcept { countedFree(p); }
+
+namespace bench {
+
+const char* dumpDir() {
+    return g_dumpDir;
+}
+
+AllocStats allocSnapshot() {
+    AllocStats stats;
+    stats.count = g_allocCount.load(std::memory_order_relaxed);
+    stats.bytes = g_allocBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void State::run(const std::function<void()>& fn) {
+    // Warmup: first-touch allocations, font/cache construction
+    uint32_t warmup = std::max<uint32_t>(1, _iterations / 10);
+    for (uint32_t i = 0; i < warmup; i++) {
+        fn();
+    }
+
+    samplesNs.clear();
+    samplesNs.reserve(_iterations);
+
+    AllocStats before = allocSnapshot();
+    const int64_t liveBefore = g_liveBytes.load(std::memory_order_relaxed);
+    g_peakBytes.store(liveBefore, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < _iterations; i++) {
+        uint64_t start = host::clock::wallNs();
+        fn();
+        samplesNs.push_back(host::clock::wallNs() - start);
+    }
+    AllocStats after = allocSnapshot();
+
+    allocs.count = after.count - before.count;
+    allocs.bytes = after.bytes - before.bytes;
+    allocs.peak = static_cast<uint64_t>(g_peakBytes.load(std::memory_order_relaxed) - liveBefore);
+}
+
+} // namespace bench
+
+// =============================================================================
+// Runner
+// =============================================================================
+
+static double percentileUs(std::vector<uint64_t>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[index] / 1000.0;
+}
+
+int main(int argc, char** argv) {
+    const char* filter = nullptr;
+    uint32_t iterationsOverride = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterationsOverride = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--dump-png") == 0 && i + 1 < argc) {
+            g_dumpDir = argv[++i];
+        }
+    }
+
+    auto entries = bench::registry();
+    std::sort(entries.begin(), entries.end(),
+              [](const bench::Entry& a, const bench::Entry& b) { return strcmp(a.name, b.name) < 0; });
+
+    printf("%-36s %7s %10s %10s %10s %10s %11s\n",
+           "benchmark", "iters", "p50_us", "p99_us", "max_us", "allocs/op", "bytes/op");
+
+    size_t failed = 0;
+    for (const auto& entry : entries) {
+        if (filter && !strstr(entry.name, filter)) continue;
+
+        bench::State state(iterationsOverride ? iterationsOverride : entry.iterations);
+
+        // Firmware debug logging would dominate timings
+        Serial.setMuted(true);
+        entry.fn(state);
+        Serial.setMuted(false);
+
+        auto& samples = state.samplesNs;
+        std::sort(samples.begin(), samples.end());
+        size_t n = samples.empty() ? 1 : samples.size();
+
+        printf("%-36s %7zu %10.1f %10.1f %10.1f %10.1f %11.1f",
+               entry.name, samples.size(),
+               percentileUs(samples, 0.50),
+               percentileUs(samples, 0.99),
+               samples.empty() ? 0.0 : samples.back() / 1000.0,
+               static_cast<double>(state.allocs.count) / n,
+               static_cast<double>(state.allocs.bytes) / n);
+        for (const auto& counter : state.counters) {
+            printf("  %s=%.1f", counter.first.c_str(), counter.second);
+        }
+        printf("\n");
+        for (const auto& failure : state.failures) {
+            printf("  FAIL %s: %s\n", entry.name, failure.c_str());
+        }
+        failed += state.failures.size();
+        fflush(stdout);
+    }
+
+    if (failed) {
+        printf("%zu check(s) failed\n", failed);
+        return 1;
+    }
+    return 0;
+}
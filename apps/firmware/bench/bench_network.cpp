@@ -0,0 +1,374 @@
+/**
+ * @file bench_network.cpp
+ * @brief NetworkWorker and HttpConnection: command latency, I/O loop time,
+ *        bridge keep-alive
+ *
+ * Requests are served by the host HTTPClient fixtures (host::http::on)
+ * with a real sleep for the configured latency. The toggle benches
+ * submit one Hue PUT at user priority and poll until its callback has
+ * run, like the I/O task's net job. net_io_pass_tado_slow times one pass
+ * of the I/O task's service jobs, which is what an input event waits
+ * behind. Both fail if a slow Tado request costs more than a few ms: the
+ * busy toggle's p99 against an idle baseline, every pass in absolute
+ * terms. The bridge benches give every TCP connect a real handshake
+ * delay (host::net::setConnectLatency) and compare a fresh connection
+ * per request with the Hue lane's kept-alive one. tado_tls_hour does the
+ * same for TLS handshakes (host::net::setHandshakeLatency) over an hour
+ * of zone polls and token refreshes. http_reuse_retry_after_lost checks
+ * which requests are sent again when a reused connection drops.
+ */
+
+#include "bench.h"
+#include "fixtures.h"
+#include "service_fixture.h"
+#include "hue/hue_service.h"
+#include "tado/tado_service.h"
+#include <HTTPClient.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace paperhome;
+
+namespace {
+
+constexpr uint32_t SLOW_TADO_MS = 1000;
+constexpr uint32_t BACKGROUND_MS = 20;
+constexpr uint32_t BRIDGE_CONNECT_MS = 5;     // TCP handshake with the bridge over Wi-Fi
+constexpr uint32_t TLS_HANDSHAKE_MS = 20;     // Scaled down: ~300-600 ms on the ESP32-S3
+constexpr uint64_t LANE_SLACK_NS = 3000000;   // A slow lane may cost the others this much
+
+NetRequest makeRequest(NetMethod method, const char* url) {
+    NetRequest request;
+    request.method = method;
+    request.url = url;
+    return request;
+}
+
+/**
+ * @brief Poll completions until done is set (I/O task stand-in)
+ */
+void waitFor(NetworkWorker& network, const bool& done) {
+    while (!done) {
+        network.poll();
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+/**
+ * @brief PUTs through one HttpConnection, reporting connects and requests/s
+ */
+void bridgePuts(bench::State& state, bool keepAlive) {
+    host::http::clear();
+    host::net::setConnectLatency(BRIDGE_CONNECT_MS);
+    host::http::on("PUT", "/action", HTTP_CODE_OK, "[{\"success\":{}}]");
+
+    HttpConnection bridge(keepAlive, config::hue::KEEPALIVE_IDLE_MS);
+    NetRequest request = makeRequest(NetMethod::PUT, "http://192.168.1.2/api/user/groups/1/action");
+    request.body = "{\"on\":true,\"bri\":128}";
+    request.contentType = "application/json";
+
+    uint64_t start = host::clock::wallNs();
+    state.run([&] {
+        NetResponse response;
+        bridge.execute(request, response);
+    });
+    double seconds = (host::clock::wallNs() - start) / 1e9;
+
+    state.counter("connects", bridge.getStats().connects);
+    state.counter("req/s", bridge.getStats().requests / seconds);
+}
+
+/**
+ * @brief Submit a Hue toggle and wait for its completion
+ */
+void toggleHue(NetworkWorker& network) {
+    bool done = false;
+    network.submit(NetLane::HUE, NetPriority::USER,
+                   makeRequest(NetMethod::PUT, "http://hue.local/api/user/groups/1/action"),
+                   [&done](const NetResponse&) { done = true; });
+    waitFor(network, done);
+}
+
+/**
+ * @brief 99th percentile of samples
+ */
+uint64_t p99Ns(std::vector<uint64_t> samples) {
+    if (samples.empty()) return 0;
+    const size_t index = samples.size() * 99 / 100;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+} // namespace
+
+BENCH_ITERS(net_hue_toggle_tado_idle, 200) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    host::http::on("PUT", "hue.local", HTTP_CODE_OK, "[]");
+
+    state.run([&] { toggleHue(network); });
+}
+
+BENCH_ITERS(net_hue_toggle_tado_busy, 200) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    host::http::on("PUT", "hue.local", HTTP_CODE_OK, "[]");
+    host::http::on("GET", "tado.com", HTTP_CODE_OK, "[]", SLOW_TADO_MS);
+
+    // Baseline: the same toggles with the Tado lane idle
+    std::vector<uint64_t> idleNs;
+    for (uint32_t i = 0; i < state.iterations(); i++) {
+        const uint64_t start = host::clock::wallNs();
+        toggleHue(network);
+        idleNs.push_back(host::clock::wallNs() - start);
+    }
+
+    // Keep the Tado lane blocked in slow transfers for the whole run
+    auto fillTado = [&] {
+        while (network.getPendingCount(NetLane::TADO) < config::tasks::NET_BACKGROUND_QUEUE_SIZE &&
+               network.submit(NetLane::TADO, NetPriority::BACKGROUND,
+                              makeRequest(NetMethod::GET, "https://hops.tado.com/homes/1/rooms"),
+                              [](const NetResponse&) {})) {
+        }
+    };
+    fillTado();
+
+    state.run([&] {
+        fillTado();
+        toggleHue(network);
+    });
+
+    state.counter("tado_pending", network.getPendingCount(NetLane::TADO));
+    state.counter("idle_p99_us", p99Ns(idleNs) / 1000.0);
+    state.check(network.getPendingCount(NetLane::TADO) > 0, "Tado lane was not busy during the toggles");
+    state.check(p99Ns(state.samplesNs) <= p99Ns(idleNs) + LANE_SLACK_NS,
+                "Hue toggle p99 with a busy Tado lane exceeds the idle p99 by more than 3 ms");
+    bench::settle(NetLane::TADO);
+}
+
+BENCH_ITERS(net_user_behind_background, 20) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    host::http::on("PUT", "hue.local", HTTP_CODE_OK, "[]");
+    host::http::on("GET", "hue.local", HTTP_CODE_OK, "{}", BACKGROUND_MS);
+
+    // A full background queue ahead of the command: it waits for at most
+    // the one poll already in flight, not the whole queue
+    uint32_t worstQueuedMs = 0;
+    state.run([&] {
+        for (uint8_t i = 0; i < config::tasks::NET_BACKGROUND_QUEUE_SIZE; i++) {
+            network.submit(NetLane::HUE, NetPriority::BACKGROUND,
+                           makeRequest(NetMethod::GET, "http://hue.local/api/user/groups"),
+                           [](const NetResponse&) {});
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        bool done = false;
+        network.submit(NetLane::HUE, NetPriority::USER,
+                       makeRequest(NetMethod::PUT, "http://hue.local/api/user/groups/1/action"),
+                       [&](const NetResponse& response) {
+                           if (response.queuedMs > worstQueuedMs) worstQueuedMs = response.queuedMs;
+                           done = true;
+                       });
+        waitFor(network, done);
+        bench::settle(NetLane::HUE);
+    });
+
+    state.counter("user_queued_max_ms", worstQueuedMs);
+    state.counter("background_ms", BACKGROUND_MS * config::tasks::NET_BACKGROUND_QUEUE_SIZE);
+}
+
+BENCH_ITERS(net_io_pass_tado_slow, 5000) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    bench::seedHueCredentials();
+    bench::seedTadoTokens();
+    host::http::on("GET", "/groups", HTTP_CODE_OK, bench::fixtures::hueGroupsJson(9));
+    host::http::on("PUT", "/action", HTTP_CODE_OK, "[]");
+    host::http::on("GET", "/me", HTTP_CODE_OK,
+                   "{\"homes\":[{\"id\":123456,\"name\":\"Home\"}]}", SLOW_TADO_MS);
+    host::http::on("GET", "/rooms", HTTP_CODE_OK, bench::fixtures::tadoRoomsJson(6), SLOW_TADO_MS);
+
+    HueService hue(network);
+    TadoService tado(network);
+    hue.init();
+    tado.init();
+
+    // One pass of the net/hue/tado jobs per real millisecond, 100 ms of
+    // firmware time each, so Hue polls run and a Tado request is always in
+    // flight. Passes are timed by hand: the sleep between them is not.
+    uint32_t toggles = 0;
+    state.samplesNs.clear();
+    for (uint32_t pass = 0; pass < state.iterations(); pass++) {
+        host::clock::advanceMs(100);
+
+        uint64_t start = host::clock::wallNs();
+        network.poll();
+        hue.update();
+        tado.update();
+        if (pass % 50 == 49 && hue.toggleRoom("1")) {
+            toggles++;
+        }
+        state.samplesNs.push_back(host::clock::wallNs() - start);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    state.counter("toggles", toggles);
+    state.counter("tado_pending", network.getPendingCount(NetLane::TADO));
+    state.counter("rejected", network.getRejectedCount());
+    state.check(*std::max_element(state.samplesNs.begin(), state.samplesNs.end()) <= LANE_SLACK_NS,
+                "an I/O pass took more than 3 ms behind a slow Tado request");
+    bench::settle(NetLane::HUE);
+    bench::settle(NetLane::TADO);
+}
+
+BENCH_ITERS(hue_bridge_put_reconnect, 200) {
+    bridgePuts(state, false);
+}
+
+BENCH_ITERS(hue_bridge_put_keepalive, 200) {
+    bridgePuts(state, true);
+}
+
+/**
+ * @brief Requests whose reused connection drops after they were sent
+ *
+ * The peer handles every request, then every other one loses the
+ * connection before the response. Only the GET may be sent again; a
+ * repeated token POST would carry a refresh token the peer has already
+ * rotated.
+ */
+BENCH_ITERS(http_reuse_retry_after_lost, 50) {
+    host::http::clear();
+    uint32_t handled[2] = {0, 0};
+    auto dropEveryOther = [](uint32_t& count) {
+        return [&count](const host::http::Request&) {
+            host::http::Response response;
+            response.code = (++count % 2 == 0) ? HTTPC_ERROR_CONNECTION_LOST : HTTP_CODE_OK;
+            response.body = "{}";
+            return response;
+        };
+    };
+    host::http::on("GET", "/rooms", dropEveryOther(handled[0]));
+    host::http::on("POST", "/oauth2/token", dropEveryOther(handled[1]));
+
+    HttpConnection hops(true, config::tado::KEEPALIVE_IDLE_MS);
+    HttpConnection login(true, config::tado::KEEPALIVE_IDLE_MS);
+    const NetRequest get = makeRequest(NetMethod::GET, "https://hops.tado.com/homes/1/rooms");
+    const NetRequest post = makeRequest(NetMethod::POST, "https://login.tado.com/oauth2/token");
+    uint32_t sent[2] = {0, 0};
+
+    state.run([&] {
+        NetResponse response;
+        hops.execute(get, response);
+        sent[0]++;
+        login.execute(post, response);
+        sent[1]++;
+    });
+
+    state.counter("get_retries", handled[0] - sent[0]);
+    state.counter("post_repeats", handled[1] - sent[1]);
+    state.check(handled[0] > sent[0], "GET on a lost reused connection was not retried");
+    state.check(handled[1] == sent[1], "POST sent again after the peer handled it");
+}
+
+BENCH_ITERS(hue_brightness_sweep, 200) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    host::net::setConnectLatency(BRIDGE_CONNECT_MS);
+    bench::seedHueCredentials();
+    host::http::on("GET", "/groups", HTTP_CODE_OK, bench::fixtures::hueGroupsJson(9));
+
+    // Bridge side: record when each step arrives
+    std::atomic<uint64_t> arrivedNs{0};
+    host::http::on("PUT", "/action", [&](const host::http::Request&) {
+        arrivedNs = host::clock::wallNs();
+        host::http::Response response;
+        response.code = HTTP_CODE_OK;
+        response.body = "[{\"success\":{}}]";
+        return response;
+    });
+
+    // Every step its own PUT: this times the transport, not the shaping
+    HueService hue(network);
+    hue.setBrightnessCoalescing(false);
+    hue.init();
+    bench::settle(NetLane::HUE);
+    const HttpConnection::Stats before = network.getConnectionStats(NetLane::HUE);
+
+    // Each step: command issued on the I/O task until the bridge sees it,
+    // then the step's refetch completes before the next one
+    std::vector<uint64_t> toBridgeNs;
+    uint8_t brightness = 1;
+    state.run([&] {
+        arrivedNs = 0;
+        uint64_t issued = host::clock::wallNs();
+        hue.setRoomBrightness("1", brightness);
+        brightness = (brightness % 254) + 1;
+        bench::settle(NetLane::HUE);
+        toBridgeNs.push_back(arrivedNs - issued);
+    });
+
+    const HttpConnection::Stats& after = network.getConnectionStats(NetLane::HUE);
+    std::sort(toBridgeNs.begin(), toBridgeNs.end());
+    state.counter("to_bridge_p50_us", toBridgeNs[toBridgeNs.size() / 2] / 1000.0);
+    state.counter("connects", after.connects - before.connects);
+    state.counter("requests", after.requests - before.requests);
+}
+
+/**
+ * @brief One hour of Tado polling against TLS endpoints
+ *
+ * Each iteration is one second of firmware time: 60 zone polls (HOPS),
+ * 6 token refreshes (login) plus the initial /me (API). The peer keeps
+ * idle connections for peerIdleMs.
+ */
+void tadoTlsHour(bench::State& state, uint32_t peerIdleMs) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    host::net::setConnectLatency(BRIDGE_CONNECT_MS);
+    host::net::setHandshakeLatency(TLS_HANDSHAKE_MS);
+    host::net::setPeerIdleTimeout(peerIdleMs);
+    bench::seedTadoTokens();
+    host::http::on("GET", "/me", HTTP_CODE_OK, "{\"homes\":[{\"id\":123456,\"name\":\"Home\"}]}");
+    host::http::on("GET", "/rooms", HTTP_CODE_OK, bench::fixtures::tadoRoomsJson(6));
+    host::http::on("POST", "/oauth2/token", HTTP_CODE_OK,
+                   "{\"access_token\":\"bench-access-token\",\"refresh_token\":\"bench-refresh-token\"}");
+
+    // Connections left open by earlier benches must not count as reuse
+    network.closeConnections(NetLane::TADO);
+    bench::settle(NetLane::TADO);
+    const HttpConnection::Stats before = network.getConnectionStats(NetLane::TADO);
+
+    TadoService tado(network);
+    tado.init();
+
+    state.run([&] {
+        host::clock::advanceMs(1000);
+        tado.update();
+        bench::settle(NetLane::TADO);
+    });
+
+    HttpConnection::Stats stats = network.getConnectionStats(NetLane::TADO);
+    const uint32_t requests = stats.requests - before.requests;
+    const uint32_t handshakes = stats.connects - before.connects;
+    state.counter("requests", requests);
+    state.counter("handshakes", handshakes);
+    state.counter("reused_pct", requests ? 100.0 * (requests - handshakes) / requests : 0);
+    state.counter("handshake_avg_ms", handshakes ? double(stats.connectMs - before.connectMs) / handshakes : 0);
+    host::net::setPeerIdleTimeout(0);
+}
+
+// Peer keeps idle connections for 2 minutes (outlives the 60 s poll)
+BENCH_ITERS(tado_tls_hour_keepalive, 3600) {
+    tadoTlsHour(state, 120000);
+}
+
+// Peer closes idle connections after 30 s: every poll needs a new handshake
+BENCH_ITERS(tado_tls_hour_peer_closes, 3600) {
+    tadoTlsHour(state, 30000);
+}
@@ -0,0 +1,291 @@
+/**
+ * @file bench_queues.cpp
+ * @brief Cross-core queue benchmarks: SpscRing vs FreeRTOS queues
+ *
+ * The FreeRTOS baselines use the raw queue calls the original InputQueue
+ * and ServiceDataQueue made, on the host queue stand-in
+ * (native/include/freertos/queue.h, mutex + condition variables), which
+ * is the same shape of cost as the ESP-IDF queue's critical section.
+ * The *_inline service benches carry every payload in the message, as
+ * the original ServiceUpdate did; state now goes through mailboxes
+ * (queue_mailbox_*) and room/zone tables through snapshot stores.
+ *
+ * The *_contended benches keep a consumer thread draining the queue while
+ * each timed iteration sends one item, so max/p99 show the worst-case
+ * time the producer is held up by the other side. "dropped" counts sends
+ * that found the queue full (the producer outran the drainer).
+ */
+
+#include "bench.h"
+#include "core/input_queue.h"
+#include "core/service_queue.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace paperhome;
+
+namespace {
+
+constexpr size_t QUEUE_LENGTH = 16;
+constexpr uint32_t OPS_PER_ITER = 256;   // Round trips per timed iteration
+
+
+using InputRing = SpscRing<InputAction, QUEUE_LENGTH>;
+
+/**
+ * @brief Service message with every payload inline (layout before pooling)
+ */
+struct InlineServiceUpdate {
+    uint8_t type;
+    uint32_t timestamp;
+    StatusBarData statusData;
+    SensorData sensorData;
+    HueStateData hueStateData;
+    TadoStateData tadoStateData;
+    DeviceInfoData deviceInfoData;
+    uint8_t roomCount;
+    uint8_t zoneCount;
+};
+
+using InlineRing = SpscRing<InlineServiceUpdate, 8>;
+
+/**
+ * @brief Background consumer that drains a queue until stopped
+ */
+class Drainer {
+public:
+    template<typename Drain>
+    explicit Drainer(Drain drain)
+        : _thread([this, drain]() mutable {
+              while (!_stop.load(std::memory_order_relaxed)) {
+                  drain();
+              }
+          }) {}
+
+    ~Drainer() {
+        _stop.store(true, std::memory_order_relaxed);
+        _thread.join();
+    }
+
+private:
+    std::atomic<bool> _stop{false};
+    std::thread _thread;
+};
+
+} // namespace
+
+// =============================================================================
+// Single thread: send + receive round trip
+// =============================================================================
+
+BENCH_ITERS(queue_spsc_input_roundtrip, 2000) {
+    auto ring = std::make_unique<InputRing>();
+    InputAction action = InputAction::button(InputEvent::BUTTON_A);
+    InputAction out;
+
+    state.run([&] {
+        for (uint32_t i = 0; i < OPS_PER_ITER; i++) {
+            ring->push(action);
+            ring->pop(out);
+        }
+    });
+
+    bench::reportNsPerOp(state, OPS_PER_ITER);
+}
+
+BENCH_ITERS(queue_freertos_input_roundtrip, 2000) {
+    QueueHandle_t queue = xQueueCreate(QUEUE_LENGTH, sizeof(InputAction));
+    InputAction action = InputAction::button(InputEvent::BUTTON_A);
+    InputAction out;
+
+    state.run([&] {
+        for (uint32_t i = 0; i < OPS_PER_ITER; i++) {
+            xQueueSend(queue, &action, 0);
+            xQueueReceive(queue, &out, 0);
+        }
+    });
+
+    vQueueDelete(queue);
+    bench::reportNsPerOp(state, OPS_PER_ITER);
+}
+
+BENCH_ITERS(queue_freertos_service_status_inline, 2000) {
+    // Original ServiceDataQueue path: fat message by value through xQueue
+    QueueHandle_t queue = xQueueCreate(8, sizeof(InlineServiceUpdate));
+    auto update = std::make_unique<InlineServiceUpdate>();
+    auto out = std::make_unique<InlineServiceUpdate>();
+    StatusBarData data{};
+
+    state.run([&] {
+        for (uint32_t i = 0; i < OPS_PER_ITER; i++) {
+            update->type = 0;
+            update->timestamp = millis();
+            update->statusData = data;
+            xQueueSend(queue, update.get(), 0);
+            xQueueReceive(queue, out.get(), 0);
+        }
+    });
+
+    vQueueDelete(queue);
+    bench::reportNsPerOp(state, OPS_PER_ITER);
+    state.counter("msg_bytes", sizeof(InlineServiceUpdate));
+}
+
+BENCH_ITERS(queue_spsc_service_status_inline, 2000) {
+    // Fat message built in place in an SpscRing slot
+    auto ring = std::make_unique<InlineRing>();
+    StatusBarData data{};
+
+    state.run([&] {
+        for (uint32_t i = 0; i < OPS_PER_ITER; i++) {
+            ring->emplaceWith([&](InlineServiceUpdate& update) {
+                update.type = 0;
+                update.timestamp = millis();
+                update.statusData = data;
+            });
+            ring->consume([](InlineServiceUpdate&) {});
+        }
+    });
+
+    bench::reportNsPerOp(state, OPS_PER_ITER);
+    state.counter("msg_bytes", sizeof(InlineServiceUpdate));
+}
+
+BENCH_ITERS(queue_mailbox_status_publish_read, 2000) {
+    auto queue = std::make_unique<ServiceDataQueue>();
+    StatusBarData data{};
+    StatusBarData out;
+    volatile uint16_t sink = 0;
+
+    state.run([&] {
+        for (uint32_t i = 0; i < OPS_PER_ITER; i++) {
+            data.co2 = static_cast<uint16_t>(i);
+            queue->sendStatus(data);
+            if (queue->readStatus(out)) sink = out.co2;
+        }
+    });
+    (void)sink;
+
+    bench::reportNsPerOp(state, OPS_PER_ITER);
+}
+
+BENCH_ITERS(queue_mailbox_sensor_burst, 2000) {
+    // Eight publishes between UI loops: one read, seven versions skipped
+    auto queue = std::make_unique<ServiceDataQueue>();
+    SensorData data{};
+    auto out = std::make_unique<SensorData>();
+    volatile uint16_t sink = 0;
+
+    state.run([&] {
+        for (uint16_t i = 0; i < 8; i++) {
+            data.co2 = i;
+            queue->sendSensorData(data);
+        }
+        if (queue->readSensorData(*out)) sink = out->co2;
+    });
+    (void)sink;
+}
+
+// =============================================================================
+// Room tables: per-update vectors vs snapshot store
+// =============================================================================
+
+namespace {
+
+/**
+ * @brief Fill a room as the Hue conversion does (names past SSO length)
+ */
+void fillRoom(HueRoom& room, size_t index, uint8_t brightness) {
+    static const char* const names[] = {
+        "Living Room Ceiling", "Kitchen Worktop Strip", "Main Bedroom Lamps",
+        "Upstairs Office Desk", "Downstairs Hallway", "Dining Room Pendant"
+    };
+    room.id = std::to_string(index + 1);
+    room.name = names[index % 6];
+    room.isOn = true;
+    room.brightness = brightness;
+    room.lightCount = 3;
+}
+
+} // namespace
+
+BENCH_ITERS(queue_rooms_vector_copy, 2000) {
+    // Previous path: build a vector, copy it across, copy it out again
+    std::vector<HueRoom> shared;
+    uint8_t brightness = 0;
+
+    state.run([&] {
+        std::vector<HueRoom> rooms;
+        rooms.reserve(6);
+        for (size_t i = 0; i < 6; i++) {
+            HueRoom room;
+            fillRoom(room, i, brightness);
+            rooms.push_back(room);
+        }
+        shared = rooms;
+        std::vector<HueRoom> received = shared;
+        brightness++;
+    });
+}
+
+BENCH_ITERS(queue_rooms_snapshot, 2000) {
+    auto queue = std::make_unique<ServiceDataQueue>();
+    uint8_t brightness = 0;
+    volatile uint32_t sink = 0;
+
+    state.run([&] {
+        HueRoomTable& table = queue->beginHueRooms();
+        table.count = 6;
+        for (size_t i = 0; i < 6; i++) {
+            fillRoom(table.rooms[i], i, brightness);
+        }
+        queue->commitHueRooms();
+
+        auto snapshot = queue->readHueRooms();
+        sink = snapshot.generation + snapshot.table->rooms[0].brightness;
+        brightness++;
+    });
+    (void)sink;
+}
+
+// =============================================================================
+// Two threads: producer send while a consumer drains
+// =============================================================================
+
+BENCH_ITERS(queue_spsc_input_contended, 20000) {
+    auto ring = std::make_unique<InputRing>();
+    InputAction action = InputAction::button(InputEvent::BUTTON_A);
+    size_t dropped = 0;
+
+    {
+        Drainer drainer([&] { return ring->consume([](InputAction&) {}); });
+        state.run([&] {
+            if (!ring->push(action)) dropped++;
+        });
+    }
+
+    state.counter("dropped", dropped);
+}
+
+BENCH_ITERS(queue_freertos_input_contended, 20000) {
+    QueueHandle_t queue = xQueueCreate(QUEUE_LENGTH, sizeof(InputAction));
+    InputAction action = InputAction::button(InputEvent::BUTTON_A);
+    size_t dropped = 0;
+
+    {
+        Drainer drainer([&] {
+            InputAction out;
+            while (xQueueReceive(queue, &out, 0) == pdTRUE) {}
+        });
+        state.run([&] {
+            if (xQueueSend(queue, &action, 0) != pdTRUE) dropped++;
+        });
+    }
+
+    vQueueDelete(queue);
+    state.counter("dropped", dropped);
+}
@@ -0,0 +1,183 @@
+/**
+ * @file bench_scheduler.cpp
+ * @brief I/O task loop: 100 Hz superloop vs DeadlineScheduler
+ *
+ * Each timed iteration simulates one minute of the I/O task on the host
+ * virtual clock with the ioTask job set (the eight jobs main.cpp adds,
+ * config::tasks intervals) and empty job bodies. The counters show how
+ * often the task wakes and how many job bodies run per minute; the
+ * timing is scheduling overhead only.
+ *
+ * io_deadline_scheduler_order checks run order across a millis() wrap,
+ * with a job disabled, re-enabled and made due by runNow().
+ */
+
+#include "bench.h"
+#include "core/config.h"
+#include "core/deadline_scheduler.h"
+#include "host/clock.h"
+#include <string>
+#include <vector>
+
+using namespace paperhome;
+
+namespace {
+
+constexpr uint32_t SIMULATED_MS = 60000;
+constexpr uint32_t SUPERLOOP_PERIOD_MS = 10;
+constexpr size_t JOB_COUNT = 8;
+
+uint32_t g_jobRuns = 0;
+
+void countJob() {
+    g_jobRuns++;
+}
+
+/**
+ * @brief Add the ioTask job set (main.cpp) with every body counting
+ */
+void addIoJobs(DeadlineScheduler& scheduler) {
+    using namespace config::tasks;
+    scheduler.addJob("input", countJob, IO_INPUT_INTERVAL_MS, IO_INPUT_BUDGET_MS);
+    scheduler.addJob("net", countJob, IO_NET_INTERVAL_MS, IO_NET_BUDGET_MS);
+    scheduler.addJob("hue", countJob, IO_HUE_INTERVAL_MS, IO_HUE_BUDGET_MS);
+    scheduler.addJob("tado", countJob, IO_TADO_INTERVAL_MS, IO_TADO_BUDGET_MS);
+    scheduler.addJob("sensors", countJob, IO_SENSOR_INTERVAL_MS, IO_SENSOR_BUDGET_MS);
+    scheduler.addJob("mqtt", countJob, IO_MQTT_INTERVAL_MS, IO_MQTT_BUDGET_MS);
+    scheduler.addJob("status", countJob, IO_STATUS_INTERVAL_MS, IO_STATUS_BUDGET_MS);
+    scheduler.addJob("stats", countJob, IO_STATS_INTERVAL_MS, 0,
+                     config::debug::TASKS_DBG || config::debug::NET_DBG);
+}
+
+// Run log for the order check: job letter and ms since the check started
+std::vector<std::pair<char, uint32_t>> g_runs;
+uint32_t g_startMs = 0;
+
+uint32_t elapsedMs() {
+    return static_cast<uint32_t>(millis()) - g_startMs;
+}
+
+void jobA() { g_runs.emplace_back('a', elapsedMs()); }
+void jobB() { g_runs.emplace_back('b', elapsedMs()); }
+void jobC() { g_runs.emplace_back('c', elapsedMs()); }
+
+/**
+ * @brief Step the scheduler on the virtual clock for ms
+ */
+void runFor(DeadlineScheduler& scheduler, uint32_t ms) {
+    const uint32_t end = elapsedMs() + ms;
+    while (static_cast<int32_t>(elapsedMs() - end) < 0) {
+        const uint32_t sleepMs = scheduler.runDue(static_cast<uint32_t>(millis()));
+        host::clock::advanceMs(sleepMs > 0 ? sleepMs : 1);
+    }
+}
+
+/**
+ * @brief Runs of job within [from, to), as ms since the check started
+ */
+std::vector<uint32_t> runsOf(char job, uint32_t from, uint32_t to) {
+    std::vector<uint32_t> times;
+    for (const auto& run : g_runs) {
+        if (run.first == job && run.second >= from && run.second < to) times.push_back(run.second);
+    }
+    return times;
+}
+
+} // namespace
+
+BENCH_ITERS(io_superloop_minute, 50) {
+    uint32_t wakeups = 0;
+    state.run([&] {
+        wakeups = 0;
+        g_jobRuns = 0;
+        const uint32_t end = static_cast<uint32_t>(millis()) + SIMULATED_MS;
+        while (static_cast<int32_t>(static_cast<uint32_t>(millis()) - end) < 0) {
+            // Every body every pass; each service checks its own timer
+            for (size_t i = 0; i < JOB_COUNT; i++) countJob();
+            wakeups++;
+            host::clock::advanceMs(SUPERLOOP_PERIOD_MS);
+        }
+    });
+    state.counter("wakeups/min", wakeups);
+    state.counter("job_runs/min", g_jobRuns);
+}
+
+BENCH_ITERS(io_deadline_scheduler_minute, 50) {
+    DeadlineScheduler scheduler;
+    addIoJobs(scheduler);
+
+    uint32_t wakeups = 0;
+    state.run([&] {
+        wakeups = 0;
+        g_jobRuns = 0;
+        const uint32_t end = static_cast<uint32_t>(millis()) + SIMULATED_MS;
+        while (static_cast<int32_t>(static_cast<uint32_t>(millis()) - end) < 0) {
+            const uint32_t sleepMs = scheduler.runDue(static_cast<uint32_t>(millis()));
+            wakeups++;
+            host::clock::advanceMs(sleepMs > 0 ? sleepMs : 1);
+        }
+    });
+
+    uint32_t late = 0;
+    for (DeadlineScheduler::JobId id = 0; id < scheduler.getJobCount(); id++) {
+        late += scheduler.getStats(id).late;
+    }
+    state.counter("wakeups/min", wakeups);
+    state.counter("job_runs/min", g_jobRuns);
+    state.counter("late", late);
+}
+
+BENCH_ITERS(io_deadline_scheduler_order, 1) {
+    // Exact virtual time; later benches get their clock back
+    const uint64_t savedOffsetUs = host::clock::offsetUs();
+    host::clock::freeze(true);
+
+    bool ordered = true, cadence = true, disabled = true, reenabled = true, runNow = true;
+    state.run([&] {
+        // Start 30 ms before millis() wraps
+        host::clock::advanceMs(0u - 30u - static_cast<uint32_t>(millis()));
+        g_runs.clear();
+        g_startMs = static_cast<uint32_t>(millis());
+
+        DeadlineScheduler scheduler;
+        scheduler.addJob("a", jobA, 10, 0);
+        const DeadlineScheduler::JobId b = scheduler.addJob("b", jobB, 25, 0);
+        const DeadlineScheduler::JobId c = scheduler.addJob("c", jobC, 40, 0);
+
+        // Across the wrap: every deadline on time, earliest first
+        runFor(scheduler, 100);
+        cadence &= runsOf('a', 0, 100) == std::vector<uint32_t>{0, 10, 20, 30, 40, 50, 60, 70, 80, 90} &&
+                  runsOf('b', 0, 100) == std::vector<uint32_t>{0, 25, 50, 75} &&
+                  runsOf('c', 0, 100) == std::vector<uint32_t>{0, 40, 80};
+
+        // Disabled: b stays out of the heap; re-enabled: first run one interval later
+        scheduler.setEnabled(b, false);
+        runFor(scheduler, 50);
+        disabled &= runsOf('b', 100, 150).empty() && runsOf('a', 100, 150).size() == 5;
+        scheduler.setEnabled(b, true);
+        runFor(scheduler, 30);
+        reenabled &= runsOf('b', 150, 180) == std::vector<uint32_t>{175};
+
+        // runNow between deadlines (nothing else due): c runs at once,
+        // then keeps its interval from there
+        scheduler.runDue(static_cast<uint32_t>(millis()));
+        host::clock::advanceMs(5);
+        scheduler.runNow(c);
+        runFor(scheduler, 50);
+        runNow &= runsOf('c', 180, 240) == std::vector<uint32_t>{185, 225};
+
+        for (size_t i = 1; i < g_runs.size(); i++) {
+            ordered &= g_runs[i - 1].second <= g_runs[i].second;
+        }
+    });
+
+    host::clock::freeze(false);
+    host::clock::offsetUs() = savedOffsetUs;
+
+    state.check(cadence, "jobs missed or shifted deadlines across the millis() wrap");
+    state.check(disabled, "disabled job ran, or the others lost their cadence");
+    state.check(reenabled, "re-enabled job did not run one interval after enabling");
+    state.check(runNow, "runNow() job did not run at once or lost its interval");
+    state.check(ordered, "jobs ran out of deadline order");
+    state.counter("runs", static_cast<double>(g_runs.size()));
+}
@@ -0,0 +1,94 @@
+/**
+ * @file bench_sensors.cpp
+ * @brief Sensor history buffer and statistics benchmarks
+ *
+ * SensorManager runs against the synthetic STCC4/BME688 stand-ins. The
+ * virtual clock is advanced one sample interval per update so the full
+ * 48-hour history fills in milliseconds.
+ */
+
+#include "bench.h"
+#include "core/ring_buffer.h"
+#include "sensors/sensor_manager.h"
+#include <memory>
+
+using namespace paperhome;
+
+namespace {
+
+using History = RingBuffer<SensorSample, config::sensors::stcc4::BUFFER_SIZE>;
+
+/**
+ * @brief Fill a sensor manager's history to capacity
+ */
+void fillHistory(SensorManager& sensors) {
+    sensors.init();
+    for (size_t i = 0; i < config::sensors::stcc4::BUFFER_SIZE; i++) {
+        host::clock::advanceMs(config::sensors::stcc4::SAMPLE_INTERVAL_MS);
+        sensors.update();
+    }
+}
+
+} // namespace
+
+BENCH_ITERS(ring_buffer_push, 2000) {
+    auto history = std::make_unique<History>();
+    SensorSample sample{};
+    uint16_t co2 = 400;
+
+    state.run([&] {
+        sample.co2 = co2++;
+        history->push(sample);
+    });
+
+    state.counter("count", history->count());
+}
+
+BENCH(ring_buffer_calculate_stats_full) {
+    auto history = std::make_unique<History>();
+    for (size_t i = 0; i < history->capacity(); i++) {
+        SensorSample sample{};
+        sample.co2 = static_cast<uint16_t>(450 + (i * 37) % 600);
+        history->push(sample);
+    }
+
+    volatile float sink = 0;
+    state.run([&] {
+        auto stats = calculateStats(*history, [](const SensorSample& s) {
+            return static_cast<float>(s.co2);
+        });
+        sink = stats.avg;
+    });
+    (void)sink;
+
+    state.counter("samples", history->count());
+}
+
+BENCH(sensor_manager_all_stats_full) {
+    auto sensors = std::make_unique<SensorManager>();
+    fillHistory(*sensors);
+
+    volatile float sink = 0;
+    state.run([&] {
+        sink = sensors->getCO2Stats().avg
+             + sensors->getTemperatureStats().avg
+             + sensors->getHumidityStats().avg
+             + sensors->getIAQStats().avg
+             + sensors->getPressureStats().avg;
+    });
+    (void)sink;
+
+    state.counter("samples", sensors->getHistoryCount());
+}
+
+BENCH_ITERS(sensor_manager_update, 1000) {
+    auto sensors = std::make_unique<SensorManager>();
+    sensors->init();
+
+    state.run([&] {
+        host::clock::advanceMs(config::sensors::stcc4::SAMPLE_INTERVAL_MS);
+        sensors->update();
+    });
+
+    state.counter("samples", sensors->getHistoryCount());
+}
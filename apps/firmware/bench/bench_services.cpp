@@ -0,0 +1,917 @@
+/**
+ * @file bench_services.cpp
+ * @brief Hue and Tado response parsing benchmarks
+ *
+ * Services run unmodified against HTTPClient fixtures (native/include/HTTPClient.h).
+ * Timings cover request dispatch through a network lane, response copy,
+ * JSON parse and change detection. The hue_groups_parse_* benches time the
+ * /groups parse alone and report its peak heap. The hue_event_stream_*
+ * benches push events through a local SSE endpoint (host/sse.h). The
+ * hue_brightness_sweep_* benches drive a trigger sweep against a bridge
+ * that refuses group commands sent faster than it accepts them. The
+ * *_optimistic_* benches inject command failures from the mock device
+ * and check that the optimistic state settles on what the device has.
+ * The tado_zones_hour_* benches replay an hour of recorded zone changes
+ * with and without conditional (ETag) polls.
+ */
+
+#include "bench.h"
+#include "fixtures.h"
+#include "service_fixture.h"
+#include "hue/hue_service.h"
+#include "tado/tado_service.h"
+#include <ArduinoJson.h>
+#include <HTTPClient.h>
+#include <WiFiClient.h>
+#include <host/sse.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace paperhome;
+using bench::seedHueCredentials;
+using bench::seedTadoTokens;
+
+namespace {
+
+/**
+ * @brief Serve alternating payloads so every poll carries a change
+ */
+void serveAlternating(const char* method, const char* path, const String& a, const String& b) {
+    auto toggle = std::make_shared<bool>(false);
+    host::http::on(method, path, [=](const host::http::Request&) {
+        host::http::Response response;
+        response.code = HTTP_CODE_OK;
+        response.body = (*toggle = !*toggle) ? a : b;
+        return response;
+    });
+}
+
+/**
+ * @brief One hour against a mock bridge, one I/O pass per second
+ *
+ * The rooms change from the Hue app at ~20 and ~40 minutes and by a local
+ * toggle at 30 minutes; otherwise the bridge is idle. Passes are timed by
+ * hand so events land on fixed seconds.
+ */
+void hueIdleHour(bench::State& state, bool incremental) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    seedHueCredentials();
+
+    auto version = std::make_shared<std::atomic<int>>(0);
+    host::http::on("GET", "/groups", [version](const host::http::Request&) {
+        host::http::Response response;
+        response.code = HTTP_CODE_OK;
+        response.body = bench::fixtures::hueGroupsJson(9, 4, 17 * version->load());
+        return response;
+    });
+    host::http::on("PUT", "/action", [version](const host::http::Request&) {
+        version->fetch_add(1);
+        host::http::Response response;
+        response.code = HTTP_CODE_OK;
+        response.body = "[{\"success\":{}}]";
+        return response;
+    });
+
+    HueService hue(network);
+    hue.setIncrementalPolling(incremental);
+    hue.setEventStream(false);
+    uint32_t notifications = 0;
+    hue.setRoomsCallback([&] { notifications++; });
+    hue.init();
+    bench::settle(NetLane::HUE);
+
+    const uint32_t seconds = state.iterations();
+    const uint32_t requestsBefore = host::http::requestCount();
+    const uint32_t notificationsBefore = notifications;
+    uint32_t changedAt = 0;
+    uint32_t seenNotifications = 0;
+    uint32_t worstDelay = 0;
+
+    state.samplesNs.clear();
+    for (uint32_t second = 1; second <= seconds; second++) {
+        if (second == seconds / 3 + 7 || second == seconds * 2 / 3 + 13) {
+            version->fetch_add(1);
+            changedAt = second;
+            seenNotifications = notifications;
+        }
+        if (second == seconds / 2) {
+            hue.toggleRoom("1");
+        }
+
+        host::clock::advanceMs(1000);
+        uint64_t start = host::clock::wallNs();
+        network.poll();
+        hue.update();
+        bench::settle(NetLane::HUE);
+        state.samplesNs.push_back(host::clock::wallNs() - start);
+
+        if (changedAt && notifications != seenNotifications) {
+            worstDelay = std::max(worstDelay, second - changedAt);
+            changedAt = 0;
+        }
+    }
+
+    const HueService::PollStats& stats = hue.getPollStats();
+    state.counter("requests", host::http::requestCount() - requestsBefore);
+    state.counter("parses", stats.parses);
+    state.counter("unchanged", stats.unchanged);
+    state.counter("notifies", notifications - notificationsBefore);
+    state.counter("change_seen_max_s", worstDelay);
+}
+
+/**
+ * @brief A 3 s trigger sweep on one room against a rate-limiting bridge
+ *
+ * The trigger raises room 1 by 4 every 50 ms (one iteration each); the
+ * I/O task runs every 10 ms, then for 5 s after the sweep. The mock
+ * bridge refuses (429, not applied) a group PUT within 800 ms of the last
+ * one it applied. Passes are timed by hand.
+ */
+void hueBrightnessSweep(bench::State& state, bool coalesce) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    seedHueCredentials();
+    struct Bridge {
+        std::mutex mutex;
+        int bri = -1;
+        uint32_t appliedAt = 0;
+        uint32_t puts = 0;
+        uint32_t throttled = 0;
+    };
+    auto bridge = std::make_shared<Bridge>();
+    host::http::on("PUT", "/groups/1/action", [bridge](const host::http::Request& request) {
+        std::lock_guard<std::mutex> lock(bridge->mutex);
+        host::http::Response response;
+        bridge->puts++;
+        if (bridge->bri >= 0 && millis() - bridge->appliedAt < 800) {
+            bridge->throttled++;
+            response.code = 429;
+            return response;
+        }
+        const char* bri = strstr(request.body.c_str(), "\"bri\":");
+        bridge->bri = bri ? atoi(bri + 6) : bridge->bri;
+        bridge->appliedAt = millis();
+        response.code = HTTP_CODE_OK;
+        response.body = "[{\"success\":{}}]";
+        return response;
+    });
+    // Room 1's brightness is the fixture's seed + 1
+    host::http::on("GET", "/groups", [bridge](const host::http::Request&) {
+        std::lock_guard<std::mutex> lock(bridge->mutex);
+        host::http::Response response;
+        response.code = HTTP_CODE_OK;
+        response.body = bench::fixtures::hueGroupsJson(9, 4, bridge->bri > 0 ? bridge->bri - 1 : 0);
+        return response;
+    });
+    auto bridgeBri = [bridge] {
+        std::lock_guard<std::mutex> lock(bridge->mutex);
+        return bridge->bri;
+    };
+
+    HueService hue(network);
+    hue.setEventStream(false);
+    hue.setBrightnessCoalescing(coalesce);
+    uint32_t notifications = 0;
+    hue.setRoomsCallback([&] { notifications++; });
+    hue.init();
+    bench::settle(NetLane::HUE);
+
+    const uint32_t steps = state.iterations();
+    const uint32_t tailTicks = 500;
+    int target = hue.findRoom("1")->brightness;
+    uint32_t staleShown = 0;
+    uint32_t settledMs = 0;
+
+    state.samplesNs.clear();
+    for (uint32_t tick = 0; tick < steps * 5 + tailTicks; tick++) {
+        if (tick < steps * 5 && tick % 5 == 0) {
+            hue.adjustRoomBrightness("1", 4);
+            target = std::min(target + 4, 254);
+            // What the room list (and so the tile) shows right after the command
+            if (hue.findRoom("1")->brightness != target) {
+                staleShown++;
+            }
+        }
+
+        host::clock::advanceMs(10);
+        uint64_t start = host::clock::wallNs();
+        network.poll();
+        hue.update();
+        bench::settle(NetLane::HUE);
+        state.samplesNs.push_back(host::clock::wallNs() - start);
+
+        if (tick >= steps * 5 && !settledMs && bridgeBri() == target) {
+            settledMs = (tick - steps * 5 + 1) * 10;
+        }
+    }
+
+    const HueService::CommandStats& stats = hue.getCommandStats();
+    state.counter("commands", steps);
+    state.counter("puts", bridge->puts);
+    state.counter("throttled", bridge->throttled);
+    state.counter("confirmations", stats.confirmations);
+    state.counter("stale_shown", staleShown);
+    state.counter("final_ok", bridgeBri() == target);
+    state.counter("settle_ms", settledMs);
+    state.counter("notifies", notifications);
+}
+
+/**
+ * @brief Replace the value after occurrence nth (0 = first) of key in json
+ */
+String patchValue(const String& json, const char* key, const String& value, int nth = 0) {
+    int start = json.indexOf(key);
+    for (; start >= 0 && nth > 0; nth--) {
+        start = json.indexOf(key, start + 1);
+    }
+    if (start < 0) return json;
+    const int from = start + strlen(key);
+    int end = from;
+    while (end < static_cast<int>(json.length()) && json[end] != ',' && json[end] != '}') end++;
+    return json.substring(0, from) + value + json.substring(end);
+}
+
+/**
+ * @brief Mock device state with scripted command failures
+ *
+ * Of every command the mock receives, each 4th fails outright (HTTP
+ * error), each 5th is refused in an error body (Hue) or accepted but not
+ * applied (Tado), and each 7th is accepted but not applied, as if
+ * another app changed it right back. Outcomes in script are used first.
+ */
+struct FlakyDevice {
+    enum class Outcome { APPLIED, HTTP_ERROR, REFUSED, IGNORED };
+
+    std::mutex mutex;
+    bool on = false;
+    int level = 1;
+    uint32_t commands = 0;
+    uint32_t injected = 0;
+    std::vector<Outcome> script;
+
+    Outcome next() {
+        commands++;
+        Outcome outcome = Outcome::APPLIED;
+        if (!script.empty()) {
+            outcome = script.front();
+            script.erase(script.begin());
+        } else if (commands % 4 == 0) outcome = Outcome::HTTP_ERROR;
+        else if (commands % 5 == 0) outcome = Outcome::REFUSED;
+        else if (commands % 7 == 0) outcome = Outcome::IGNORED;
+        injected += (outcome != Outcome::APPLIED);
+        return outcome;
+    }
+};
+
+/**
+ * @brief Run I/O passes for ms of firmware time, 100 ms each
+ */
+template<typename Service>
+void runPasses(Service& service, NetLane lane, uint32_t ms) {
+    for (uint32_t elapsed = 0; elapsed < ms; elapsed += 100) {
+        host::clock::advanceMs(100);
+        bench::network().poll();
+        service.update();
+        bench::settle(lane);
+    }
+}
+
+/**
+ * @brief Run I/O passes until the Hue event stream is up and resynced
+ */
+void waitForEventStream(HueService& hue) {
+    while (!hue.isEventStreamConnected()) {
+        bench::network().poll();
+        hue.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    hue.update();
+    bench::settle(NetLane::HUE);
+}
+
+/**
+ * @brief HOPS /rooms body for minute m of the recorded hour
+ *
+ * Six zones replayed from a recorded trace shape: each sensor reports every
+ * 3-8 minutes in 0.04 °C steps (most below the 0.1 °C shown), humidity of
+ * zone 1 moves every 15 minutes, and zone 3's schedule raises its setpoint
+ * at minute 30.
+ */
+String tadoRecordedRooms(uint32_t minute) {
+    String body = bench::fixtures::tadoRoomsJson(6);
+    char value[16];
+    for (uint32_t zone = 0; zone < 6; zone++) {
+        const uint32_t reports = minute / (3 + zone);
+        snprintf(value, sizeof(value), "%.2f", 19.5f + zone * 0.4f + 0.04f * (reports % 10));
+        body = patchValue(body, "\"insideTemperature\":{\"value\":", value, zone);
+    }
+    snprintf(value, sizeof(value), "%u", 41 + (minute / 15) % 3);
+    body = patchValue(body, "\"humidity\":{\"percentage\":", value);
+    if (minute >= 30) {
+        body = patchValue(body, "\"temperature\":{\"value\":", "22.0", 2 * 2);
+    }
+    return body;
+}
+
+/**
+ * @brief One hour of zone polls against the recorded-trace HOPS mock
+ *
+ * The mock sends an ETag (hash of the body) and answers 304 to a matching
+ * If-None-Match. One I/O pass per firmware second, as in hueIdleHour().
+ */
+void tadoZonesHour(bench::State& state, bool conditional) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    seedTadoTokens();
+    host::http::on("GET", "/me", HTTP_CODE_OK, "{\"homes\":[{\"id\":123456,\"name\":\"Home\"}]}");
+    host::http::on("POST", "/oauth2/token", HTTP_CODE_OK,
+                   "{\"access_token\":\"bench-access-token\",\"refresh_token\":\"bench-refresh-token\"}");
+
+    struct Hops {
+        std::mutex mutex;
+        uint32_t minute = 0;
+        uint32_t bodyBytes = 0;     // Bytes of 200 bodies served
+        uint32_t bodies = 0;        // Distinct bodies served in a row
+        String lastBody;
+    };
+    auto hops = std::make_shared<Hops>();
+    host::http::on("GET", "/rooms", [hops](const host::http::Request& request) {
+        std::lock_guard<std::mutex> lock(hops->mutex);
+        const String body = tadoRecordedRooms(hops->minute);
+
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < body.length(); i++) {
+            hash = (hash ^ static_cast<uint8_t>(body[i])) * 16777619u;
+        }
+        char etag[16];
+        snprintf(etag, sizeof(etag), "\"%08x\"", hash);
+        if (body != hops->lastBody) {
+            hops->bodies++;
+            hops->lastBody = body;
+        }
+
+        host::http::Response response;
+        response.headers.emplace_back("ETag", etag);
+        if (request.header("If-None-Match") == etag) {
+            response.code = HTTP_CODE_NOT_MODIFIED;
+            return response;
+        }
+        response.code = HTTP_CODE_OK;
+        response.body = body;
+        hops->bodyBytes += body.length();
+        return response;
+    });
+
+    TadoService tado(network);
+    tado.setConditionalPolling(conditional);
+    uint32_t notifications = 0;
+    tado.setZonesCallback([&] { notifications++; });
+    tado.init();
+    host::clock::advanceMs(10000);
+    runPasses(tado, NetLane::TADO, 2000);
+
+    const TadoService::ZoneStats before = tado.getZoneStats();
+    const uint32_t requestsBefore = host::http::requestCount();
+    uint32_t bytesBefore = 0;
+    {
+        std::lock_guard<std::mutex> lock(hops->mutex);
+        bytesBefore = hops->bodyBytes;
+        hops->bodies = 0;
+    }
+
+    state.samplesNs.clear();
+    for (uint32_t second = 1; second <= state.iterations(); second++) {
+        {
+            std::lock_guard<std::mutex> lock(hops->mutex);
+            hops->minute = second / 60;
+        }
+        host::clock::advanceMs(1000);
+        const uint64_t start = host::clock::wallNs();
+        network.poll();
+        tado.update();
+        bench::settle(NetLane::TADO);
+        state.samplesNs.push_back(host::clock::wallNs() - start);
+    }
+
+    const TadoService::ZoneStats& stats = tado.getZoneStats();
+    std::lock_guard<std::mutex> lock(hops->mutex);
+    state.counter("connected", tado.isConnected());
+    state.counter("requests", host::http::requestCount() - requestsBefore);
+    state.counter("body_changes", hops->bodies);
+    state.counter("not_modified", stats.notModified - before.notModified);
+    state.counter("parses", stats.parses - before.parses);
+    state.counter("bytes_downloaded", hops->bodyBytes - bytesBefore);
+    state.counter("parse_us", stats.parseUs - before.parseUs);
+    state.counter("ui_updates_per_h", stats.publishes - before.publishes);
+    state.counter("zone_updates", stats.zoneUpdates - before.zoneUpdates);
+    state.counter("field_updates", stats.fieldUpdates - before.fieldUpdates);
+}
+
+} // namespace
+
+// =============================================================================
+// Hue
+// =============================================================================
+
+BENCH(hue_rooms_poll_unchanged) {
+    host::http::clear();
+    seedHueCredentials();
+    host::http::on("GET", "/groups", HTTP_CODE_OK, bench::fixtures::hueGroupsJson(9));
+
+    HueService hue(bench::network());
+    uint32_t notifications = 0;
+    hue.setRoomsCallback([&] { notifications++; });
+    hue.init();
+    bench::settle(NetLane::HUE);
+
+    state.run([&] {
+        hue.refreshRooms();
+        bench::settle(NetLane::HUE);
+    });
+
+    state.counter("rooms", hue.getRoomCount());
+    state.counter("notifies", notifications);
+}
+
+BENCH(hue_rooms_poll_changed) {
+    host::http::clear();
+    seedHueCredentials();
+    serveAlternating("GET", "/groups",
+                     bench::fixtures::hueGroupsJson(9, 4, 0),
+                     bench::fixtures::hueGroupsJson(9, 4, 17));
+
+    HueService hue(bench::network());
+    uint32_t notifications = 0;
+    hue.setRoomsCallback([&] { notifications++; });
+    hue.init();
+    bench::settle(NetLane::HUE);
+
+    state.run([&] {
+        hue.refreshRooms();
+        bench::settle(NetLane::HUE);
+    });
+
+    state.counter("rooms", hue.getRoomCount());
+    state.counter("notifies", notifications);
+}
+
+BENCH_ITERS(hue_rooms_poll_large, 100) {
+    host::http::clear();
+    seedHueCredentials();
+    String body = bench::fixtures::hueGroupsJson(12, 88);
+    host::http::on("GET", "/groups", HTTP_CODE_OK, body);
+
+    HueService hue(bench::network());
+    hue.init();
+    bench::settle(NetLane::HUE);
+
+    state.run([&] {
+        hue.refreshRooms();
+        bench::settle(NetLane::HUE);
+    });
+
+    state.counter("body_bytes", body.length());
+}
+
+BENCH_ITERS(hue_idle_hour_full_poll, 3600) {
+    hueIdleHour(state, false);
+}
+
+BENCH_ITERS(hue_idle_hour_incremental, 3600) {
+    hueIdleHour(state, true);
+}
+
+// Wall-clock time from the bridge sending a grouped_light event to the
+// rooms callback (where the firmware hands rooms to the UI). On the device
+// the Hue job period (IO_HUE_INTERVAL_MS) comes on top.
+BENCH(hue_event_stream_latency) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    seedHueCredentials();
+    host::http::on("GET", "/groups", HTTP_CODE_OK, bench::fixtures::hueGroupsJson(9));
+    host::sse::Server bridge("/eventstream/clip/v2");
+
+    HueService hue(network);
+    uint32_t notifications = 0;
+    hue.setRoomsCallback([&] { notifications++; });
+    hue.init();
+    waitForEventStream(hue);
+
+    bool on = hue.findRoom("1")->anyOn;
+    uint32_t step = 0;
+    state.run([&] {
+        on = !on;
+        step++;
+        const uint32_t before = notifications;
+        bridge.push(bench::fixtures::hueGroupedLightEvent("1", on, 20.0f + step % 80));
+        while (notifications == before) {
+            network.poll();
+            hue.update();
+            std::this_thread::yield();
+        }
+    });
+
+    HueEventStream::Stats stats = hue.getEventStreamStats();
+    state.counter("events", stats.events);
+    state.counter("deltas", stats.deltas);
+    state.counter("polls", hue.getPollStats().polls);
+}
+
+// The stream drops and the bridge refuses it for a minute: polling takes
+// over until it reconnects. One pass per second of firmware time.
+BENCH_ITERS(hue_event_stream_drop, 1) {
+    NetworkWorker& network = bench::network();
+    host::http::clear();
+    seedHueCredentials();
+    host::http::on("GET", "/groups", HTTP_CODE_OK, bench::fixtures::hueGroupsJson(9));
+    host::sse::Server bridge("/eventstream/clip/v2");
+
+    HueService hue(network);
+    hue.init();
+    waitForEventStream(hue);
+
+    const uint32_t pollsBefore = hue.getPollStats().polls;
+    bridge.refuse(true);
+    bridge.drop();
+
+    uint32_t reconnectedAfter = 0;
+    state.samplesNs.clear();
+    for (uint32_t second = 1; second <= 180 && !reconnectedAfter; second++) {
+        if (second == 60) {
+            bridge.refuse(false);
+        }
+        host::clock::advanceMs(1000);
+
+        uint64_t start = host::clock::wallNs();
+        network.poll();
+        hue.update();
+        bench::settle(NetLane::HUE);
+        state.samplesNs.push_back(host::clock::wallNs() - start);
+
+        // Real time for the stream task to notice the clock moved
+        std::this_thread::sleep_for(std::chrono::milliseconds(config::hue::EVENT_READ_POLL_MS * 6));
+        if (second >= 60 && hue.isEventStreamConnected()) {
+            reconnectedAfter = second - 60;
+        }
+    }
+
+    state.counter("fallback_polls", hue.getPollStats().polls - pollsBefore);
+    state.counter("reconnect_s", reconnectedAfter);
+    state.counter("drops", hue.getEventStreamStats().drops);
+    state.counter("connects", bridge.connects());
+}
+
+BENCH_ITERS(hue_brightness_sweep_direct, 60) {
+    hueBrightnessSweep(state, false);
+}
+
+BENCH_ITERS(hue_brightness_sweep_coalesced, 60) {
+    hueBrightnessSweep(state, true);
+}
+
+// Toggles and brightness sets on room 1 against a bridge that fails a
+// share of them. Timed: the command call until the rooms callback (what
+// the UI waits for). After each command, 3 s of I/O passes; the room
+// shown must then match the bridge. A rollback must show the polled
+// state at once. Scripted toggles then check that a failed request rolls
+// back, a confirming poll settles and a superseding poll wins.
+BENCH_ITERS(hue_optimistic_commands, 60) {
+    host::http::clear();
+    seedHueCredentials();
+
+    auto bridge = std::make_shared<FlakyDevice>();
+    host::http::on("GET", "/groups", [bridge](const host::http::Request&) {
+        std::lock_guard<std::mutex> lock(bridge->mutex);
+        String body = bench::fixtures::hueGroupsJson(9, 4, bridge->level - 1);
+        const char* on = bridge->on ? "true" : "false";
+        body = patchValue(body, "\"all_on\":", on);
+        body = patchValue(body, "\"any_on\":", on);
+        host::http::Response response;
+        response.code = HTTP_CODE_OK;
+        response.body = body;
+        return response;
+    });
+    host::http::on("PUT", "/groups/1/action", [bridge](const host::http::Request& request) {
+        std::lock_guard<std::mutex> lock(bridge->mutex);
+        host::http::Response response;
+        response.code = HTTP_CODE_OK;
+        response.body = "[{\"success\":{}}]";
+        switch (bridge->next()) {
+            case FlakyDevice::Outcome::HTTP_ERROR:
+                response.code = 503;
+                response.body = "";
+                break;
+            case FlakyDevice::Outcome::REFUSED:
+                response.body = "[{\"error\":{\"type\":201,\"description\":\"parameter, on, is not modifiable\"}}]";
+                break;
+            case FlakyDevice::Outcome::IGNORED:
+                break;
+            case FlakyDevice::Outcome::APPLIED: {
+                bridge->on = request.body.indexOf("\"on\":true") >= 0;
+                const int bri = request.body.indexOf("\"bri\":");
+                if (bri >= 0) bridge->level = atoi(request.body.c_str() + bri + 6);
+                break;
+            }
+        }
+        return response;
+    });
+
+    HueService hue(bench::network());
+    hue.setEventStream(false);
+    uint32_t notifications = 0;
+    uint32_t rolledBackSeen = 0;
+    uint32_t staleRollbacks = 0;
+    auto showsBridge = [&] {
+        const HueRoomData* room = hue.findRoom("1");
+        return room->anyOn == bridge->on && room->brightness == bridge->level;
+    };
+    hue.setRoomsCallback([&] {
+        notifications++;
+        if (hue.getPendingStats().rolledBack != rolledBackSeen) {
+            rolledBackSeen = hue.getPendingStats().rolledBack;
+            std::lock_guard<std::mutex> lock(bridge->mutex);
+            staleRollbacks += !showsBridge();
+        }
+    });
+    hue.init();
+    bench::settle(NetLane::HUE);
+    runPasses(hue, NetLane::HUE, 1000);
+
+    uint32_t shownAtOnce = 0;
+    uint32_t inconsistent = 0;
+    state.samplesNs.clear();
+    for (uint32_t i = 0; i < state.iterations(); i++) {
+        const uint32_t before = notifications;
+        const uint64_t start = host::clock::wallNs();
+        if (i % 2) {
+            hue.setRoomBrightness("1", static_cast<uint8_t>(20 + (i * 37) % 230));
+        } else {
+            hue.toggleRoom("1");
+        }
+        state.samplesNs.push_back(host::clock::wallNs() - start);
+        shownAtOnce += (notifications != before);
+
+        runPasses(hue, NetLane::HUE, 3000);
+
+        std::lock_guard<std::mutex> lock(bridge->mutex);
+        inconsistent += !showsBridge();
+    }
+
+    // Scripted toggles: each must end the expected way, showing the bridge
+    auto scripted = [&](FlakyDevice::Outcome outcome, uint32_t PendingStats::*ending) {
+        {
+            std::lock_guard<std::mutex> lock(bridge->mutex);
+            bridge->script.assign(1, outcome);
+        }
+        const uint32_t before = hue.getPendingStats().*ending;
+        const bool wasOn = hue.findRoom("1")->anyOn;
+        hue.toggleRoom("1");
+        const bool shown = hue.findRoom("1")->anyOn != wasOn;
+        runPasses(hue, NetLane::HUE, 3000);
+
+        std::lock_guard<std::mutex> lock(bridge->mutex);
+        return shown && hue.getPendingStats().*ending == before + 1 && showsBridge();
+    };
+    state.check(scripted(FlakyDevice::Outcome::HTTP_ERROR, &PendingStats::rolledBack),
+                "failed toggle did not roll back to the polled state");
+    state.check(scripted(FlakyDevice::Outcome::APPLIED, &PendingStats::confirmed),
+                "applied toggle was not confirmed by the next poll");
+    state.check(scripted(FlakyDevice::Outcome::IGNORED, &PendingStats::superseded),
+                "ignored toggle was not superseded by the polled state");
+    state.check(staleRollbacks == 0, "rollback showed something other than the polled state");
+    state.check(inconsistent == 0, "room shown differs from the bridge after 3 s");
+
+    const PendingStats& pending = hue.getPendingStats();
+    state.counter("shown_at_once", shownAtOnce);
+    state.counter("injected_failures", bridge->injected);
+    state.counter("confirmed", pending.confirmed);
+    state.counter("superseded", pending.superseded);
+    state.counter("rolled_back", pending.rolledBack);
+    state.counter("expired", pending.expired);
+    state.counter("inconsistent", inconsistent);
+}
+
+// 100 groups (12 rooms, 88 entertainment areas) read off the connection
+BENCH(hue_groups_parse_stream) {
+    String body = bench::fixtures::hueGroupsJson(12, 88);
+    WiFiClient connection;
+    HueRoomData rooms[HUE_MAX_ROOMS];
+    uint8_t count = 0;
+
+    state.run([&] {
+        connection.receive(body.c_str(), body.length());
+        HueService::parseRooms(connection, rooms, count);
+    });
+
+    state.counter("rooms", count);
+    state.counter("peak_heap_bytes", state.allocs.peak);
+}
+
+// Same body the way it used to be parsed: copied into a String, then one
+// unfiltered document for the whole response
+BENCH(hue_groups_parse_document) {
+    String body = bench::fixtures::hueGroupsJson(12, 88);
+    WiFiClient connection;
+    HueRoomData rooms[HUE_MAX_ROOMS];
+    uint8_t count = 0;
+
+    state.run([&] {
+        connection.receive(body.c_str(), body.length());
+        String response = connection.readAll();
+
+        JsonDocument doc;
+        deserializeJson(doc, response);
+        count = 0;
+        for (JsonPair kv : doc.as<JsonObject>()) {
+            JsonObject group = kv.value();
+            String type = group["type"].as<String>();
+            if (count >= HUE_MAX_ROOMS || (type != "Room" && type != "Zone")) {
+                continue;
+            }
+            HueRoomData& room = rooms[count++];
+            strncpy(room.id, kv.key().c_str(), sizeof(room.id) - 1);
+            String name = group["name"].as<String>();
+            strncpy(room.name, name.c_str(), sizeof(room.name) - 1);
+            String className = group["class"].as<String>();
+            strncpy(room.className, className.c_str(), sizeof(room.className) - 1);
+            room.anyOn = group["state"]["any_on"] | false;
+            room.brightness = group["action"]["bri"] | 0;
+            room.lightCount = group["lights"].as<JsonArray>().size();
+        }
+    });
+
+    state.counter("rooms", count);
+    state.counter("peak_heap_bytes", state.allocs.peak);
+}
+
+// =============================================================================
+// Tado
+// =============================================================================
+
+BENCH(tado_zones_poll_unchanged) {
+    host::http::clear();
+    seedTadoTokens();
+    host::http::on("GET", "/rooms", HTTP_CODE_OK, bench::fixtures::tadoRoomsJson(6));
+
+    TadoService tado(bench::network());
+    uint32_t notifications = 0;
+    tado.setZonesCallback([&] { notifications++; });
+    tado.init();
+    bench::settle(NetLane::TADO);
+
+    state.run([&] {
+        tado.refreshZones();
+        bench::settle(NetLane::TADO);
+    });
+
+    state.counter("zones", tado.getZoneCount());
+    state.counter("notifies", notifications);
+}
+
+BENCH(tado_zones_poll_changed) {
+    host::http::clear();
+    seedTadoTokens();
+    serveAlternating("GET", "/rooms",
+                     bench::fixtures::tadoRoomsJson(6, 0),
+                     bench::fixtures::tadoRoomsJson(6, 5));
+
+    TadoService tado(bench::network());
+    uint32_t notifications = 0;
+    tado.setZonesCallback([&] { notifications++; });
+    tado.init();
+    bench::settle(NetLane::TADO);
+
+    state.run([&] {
+        tado.refreshZones();
+        bench::settle(NetLane::TADO);
+    });
+
+    state.counter("zones", tado.getZoneCount());
+    state.counter("notifies", notifications);
+}
+
+BENCH_ITERS(tado_zones_hour_full, 3600) {
+    tadoZonesHour(state, false);
+}
+
+BENCH_ITERS(tado_zones_hour_conditional, 3600) {
+    tadoZonesHour(state, true);
+}
+
+// Setpoint changes on zone 1 against a HOPS mock that fails a share of
+// them. Timed: the command call until the zones callback. Previously the
+// new setpoint showed at the next 60 s poll. After each command, 5 s of
+// I/O passes; the zone shown must then match the mock. A rollback must
+// show the polled setpoint at once. Scripted changes then check that a
+// failed request rolls back, a confirming poll settles and a superseding
+// poll wins.
+BENCH_ITERS(tado_optimistic_setpoint, 40) {
+    host::http::clear();
+    seedTadoTokens();
+    host::http::on("GET", "/me", HTTP_CODE_OK, "{\"homes\":[{\"id\":123456,\"name\":\"Home\"}]}");
+
+    auto hops = std::make_shared<FlakyDevice>();
+    hops->level = 200;  // Zone 1 setpoint in tenths of a degree
+    host::http::on("GET", "/rooms", [hops](const host::http::Request&) {
+        std::lock_guard<std::mutex> lock(hops->mutex);
+        char target[16];
+        snprintf(target, sizeof(target), "%.1f", hops->level / 10.0f);
+        host::http::Response response;
+        response.code = HTTP_CODE_OK;
+        response.body = patchValue(bench::fixtures::tadoRoomsJson(6), "\"temperature\":{\"value\":", target);
+        return response;
+    });
+    host::http::on("POST", "/manualControl", [hops](const host::http::Request& request) {
+        std::lock_guard<std::mutex> lock(hops->mutex);
+        host::http::Response response;
+        response.code = HTTP_CODE_OK;
+        switch (hops->next()) {
+            case FlakyDevice::Outcome::HTTP_ERROR:
+                response.code = 500;
+                break;
+            case FlakyDevice::Outcome::REFUSED:
+            case FlakyDevice::Outcome::IGNORED:
+                break;
+            case FlakyDevice::Outcome::APPLIED: {
+                const int value = request.body.indexOf("\"value\":");
+                if (value >= 0) hops->level = static_cast<int>(atof(request.body.c_str() + value + 8) * 10 + 0.5f);
+                break;
+            }
+        }
+        return response;
+    });
+
+    TadoService tado(bench::network());
+    uint32_t notifications = 0;
+    uint32_t rolledBackSeen = 0;
+    uint32_t staleRollbacks = 0;
+    auto showsMock = [&] {
+        return static_cast<int>(tado.getZone(0).targetTemp * 10 + 0.5f) == hops->level;
+    };
+    tado.setZonesCallback([&] {
+        notifications++;
+        if (tado.getPendingStats().rolledBack != rolledBackSeen) {
+            rolledBackSeen = tado.getPendingStats().rolledBack;
+            std::lock_guard<std::mutex> lock(hops->mutex);
+            staleRollbacks += !showsMock();
+        }
+    });
+    tado.init();
+    host::clock::advanceMs(10000);
+    runPasses(tado, NetLane::TADO, 2000);
+
+    uint32_t shownAtOnce = 0;
+    uint32_t inconsistent = 0;
+    state.samplesNs.clear();
+    for (uint32_t i = 0; i < state.iterations(); i++) {
+        const uint32_t before = notifications;
+        const uint64_t start = host::clock::wallNs();
+        tado.adjustZoneTemperature(1, (i % 3 == 2) ? -1.0f : 0.5f);
+        state.samplesNs.push_back(host::clock::wallNs() - start);
+        shownAtOnce += (notifications != before);
+
+        runPasses(tado, NetLane::TADO, 5000);
+
+        std::lock_guard<std::mutex> lock(hops->mutex);
+        inconsistent += !showsMock();
+    }
+
+    // Scripted +0.5 °C changes: each must end the expected way, showing the mock
+    auto scripted = [&](FlakyDevice::Outcome outcome, uint32_t PendingStats::*ending) {
+        {
+            std::lock_guard<std::mutex> lock(hops->mutex);
+            hops->script.assign(1, outcome);
+        }
+        const uint32_t before = tado.getPendingStats().*ending;
+        const float was = tado.getZone(0).targetTemp;
+        tado.adjustZoneTemperature(1, 0.5f);
+        const bool shown = tado.getZone(0).targetTemp > was;
+        runPasses(tado, NetLane::TADO, 5000);
+
+        std::lock_guard<std::mutex> lock(hops->mutex);
+        return shown && tado.getPendingStats().*ending == before + 1 && showsMock();
+    };
+    state.check(scripted(FlakyDevice::Outcome::HTTP_ERROR, &PendingStats::rolledBack),
+                "failed setpoint did not roll back to the polled state");
+    state.check(scripted(FlakyDevice::Outcome::APPLIED, &PendingStats::confirmed),
+                "applied setpoint was not confirmed by the next poll");
+    state.check(scripted(FlakyDevice::Outcome::IGNORED, &PendingStats::superseded),
+                "ignored setpoint was not superseded by the polled state");
+    state.check(staleRollbacks == 0, "rollback showed something other than the polled setpoint");
+    state.check(inconsistent == 0, "zone shown differs from the mock after 5 s");
+
+    const PendingStats& pending = tado.getPendingStats();
+    state.counter("connected", tado.isConnected());
+    state.counter("shown_at_once", shownAtOnce);
+    state.counter("injected_failures", hops->injected);
+    state.counter("confirmed", pending.confirmed);
+    state.counter("superseded", pending.superseded);
+    state.counter("rolled_back", pending.rolledBack);
+    state.counter("expired", pending.expired);
+    state.counter("inconsistent", inconsistent);
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+/**
+ * @file fixtures.h
+ * @brief Recorded-shape API payloads for service benchmarks
+ *
+ * Generated rather than checked in so sizes can be scaled; field layout
+ * follows real Hue v1 /groups and Tado HOPS /homes/{id}/rooms responses.
+ */
+
+#include <Arduino.h>
+#include <cstdio>
+#include <cstdlib>
+
+namespace bench {
+namespace fixtures {
+
+static const char* const ROOM_NAMES[] = {
+    "Living Room", "Kitchen", "Bedroom", "Office", "Bathroom",
+    "Hallway", "Dining", "Guest Room", "Kids Room", "Garage",
+    "Terrace", "Attic"
+};
+
+static const char* const ROOM_CLASSES[] = {
+    "Living room", "Kitchen", "Bedroom", "Office", "Bathroom", "Hallway"
+};
+
+/**
+ * @brief Hue v1 GET /api/<user>/groups response
+ *
+ * @param rooms Number of Room groups
+ * @param extraGroups Entertainment/LightGroup entries the parser must skip
+ * @param brightnessSeed Varies brightness so successive polls differ
+ */
+inline String hueGroupsJson(int rooms, int extraGroups = 4, int brightnessSeed = 0) {
+    String json;
+    json.reserve(1200 * (rooms + extraGroups));
+    json += "{";
+
+    char buf[1024];
+    int id = 1;
+    for (int i = 0; i < rooms + extraGroups; i++, id++) {
+        bool isRoom = i < rooms;
+        const char* name = ROOM_NAMES[i % 12];
+        int lights = 2 + (i % 5);
+        int bri = (37 * i + brightnessSeed) % 254 + 1;
+        bool on = (i % 3) != 0;
+
+        String lightList;
+        for (int l = 0; l < lights; l++) {
+            if (l) lightList += ",";
+            lightList += "\"" + String(id * 10 + l) + "\"";
+        }
+
+        snprintf(buf, sizeof(buf),
+                 "%s\"%d\":{\"name\":\"%s%s\",\"lights\":[%s],\"sensors\":[],"
+                 "\"type\":\"%s\",\"state\":{\"all_on\":%s,\"any_on\":%s},"
+                 "\"recycle\":false,\"class\":\"%s\","
+                 "\"action\":{\"on\":%s,\"bri\":%d,\"hue\":8417,\"sat\":140,"
+                 "\"effect\":\"none\",\"xy\":[0.4573,0.41],\"ct\":366,"
+                 "\"alert\":\"select\",\"colormode\":\"ct\"}}",
+                 i ? "," : "", id, name, isRoom ? "" : " Sync",
+                 lightList.c_str(),
+                 isRoom ? "Room" : "Entertainment",
+                 on && (i % 2) ? "true" : "false",
+                 on ? "true" : "false",
+                 ROOM_CLASSES[i % 6],
+                 on ? "true" : "false", bri);
+        json += buf;
+    }
+
+    json += "}";
+    return json;
+}
+
+/**
+ * @brief Hue v2 event stream payload: one grouped_light update
+ *
+ * The data: line the bridge sends when a room is switched or dimmed
+ * (from the app, a wall switch or this device).
+ */
+inline String hueGroupedLightEvent(const char* groupId, bool on, float brightness) {
+    char buf[512];
+    snprintf(buf, sizeof(buf),
+             "[{\"creationtime\":\"2024-01-01T18:00:00Z\",\"data\":[{"
+             "\"dimming\":{\"brightness\":%.2f},"
+             "\"id\":\"8f2a6c1e-3b7d-4e59-a0c4-%012d\",\"id_v1\":\"/groups/%s\","
+             "\"on\":{\"on\":%s},"
+             "\"owner\":{\"rid\":\"5d1e0a7c-9b3f-4c28-8e61-%012d\",\"rtype\":\"room\"},"
+             "\"type\":\"grouped_light\"}],"
+             "\"id\":\"c7e41b20-6a8d-4f3e-b915-2d0c8a7f6e31\",\"type\":\"update\"}]",
+             brightness, atoi(groupId), groupId, on ? "true" : "false", atoi(groupId));
+    return String(buf);
+}
+
+/**
+ * @brief Tado HOPS GET /homes/{id}/rooms response
+ *
+ * @param zones Number of rooms
+ * @param tempSeed Varies temperatures so successive polls differ
+ */
+inline String tadoRoomsJson(int zones, int tempSeed = 0) {
+    String json;
+    json.reserve(700 * zones);
+    json += "[";
+
+    char buf[1024];
+    for (int i = 0; i < zones; i++) {
+        float inside = 19.0f + ((i * 7 + tempSeed) % 40) / 10.0f;
+        float target = 20.0f + (i % 3);
+        bool manual = (i % 4) == 1;
+        bool heating = (i % 2) == 0;
+
+        snprintf(buf, sizeof(buf),
+                 "%s{\"id\":%d,\"name\":\"%s\","
+                 "\"sensorDataPoints\":{\"insideTemperature\":{\"value\":%.2f},"
+                 "\"humidity\":{\"percentage\":%d}},"
+                 "\"setting\":{\"power\":\"%s\",\"temperature\":{\"value\":%.1f}},"
+                 "%s"
+                 "\"heatingPower\":{\"percentage\":%d},"
+                 "\"connection\":{\"state\":\"CONNECTED\"},"
+                 "\"openWindow\":null,\"nextScheduleChange\":{\"start\":\"2024-01-01T18:00:00Z\","
+                 "\"setting\":{\"power\":\"ON\",\"temperature\":{\"value\":21.0}}},"
+                 "\"boostMode\":null,\"awayMode\":false}",
+                 i ? "," : "", i + 1, ROOM_NAMES[i % 12], inside, 40 + (i * 3) % 25,
+                 heating ? "ON" : "OFF", target,
+                 manual ? "\"manualControlTermination\":{\"type\":\"NEXT_TIME_BLOCK\","
+                          "\"remainingTimeInSeconds\":1800},"
+                        : "",
+                 heating ? 30 + (i * 11) % 70 : 0);
+        json += buf;
+    }
+
+    json += "]";
+    return json;
+}
+
+} // namespace fixtures
+} // namespace bench
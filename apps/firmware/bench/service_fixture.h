@@ -0,0 +1,61 @@
+#pragma once
+
+/**
+ * @file service_fixture.h
+ * @brief Shared setup for Hue/Tado service benchmarks
+ *
+ * Lane tasks are detached threads, so one NetworkWorker is started per
+ * process and reused. The benchmark thread stands in for the I/O task:
+ * it polls completions while it waits.
+ */
+
+#include "connectivity/network_worker.h"
+#include <Preferences.h>
+#include <chrono>
+#include <thread>
+
+namespace bench {
+
+constexpr int32_t TADO_HOME_ID = 123456;
+
+inline void seedHueCredentials() {
+    Preferences prefs;
+    prefs.begin(paperhome::config::hue::NVS_NAMESPACE, false);
+    prefs.putString(paperhome::config::hue::NVS_KEY_IP, "192.168.1.2");
+    prefs.putString(paperhome::config::hue::NVS_KEY_USERNAME, "bench-user-0123456789abcdef");
+    prefs.end();
+}
+
+inline void seedTadoTokens() {
+    Preferences prefs;
+    prefs.begin(paperhome::config::tado::NVS_NAMESPACE, false);
+    prefs.putString(paperhome::config::tado::NVS_KEY_ACCESS, "bench-access-token");
+    prefs.putString(paperhome::config::tado::NVS_KEY_REFRESH, "bench-refresh-token");
+    prefs.putInt(paperhome::config::tado::NVS_KEY_HOME_ID, TADO_HOME_ID);
+    prefs.end();
+}
+
+/**
+ * @brief Process-wide worker with its lanes started
+ */
+inline paperhome::NetworkWorker& network() {
+    static paperhome::NetworkWorker instance;
+    static bool started = instance.start();
+    (void)started;
+    return instance;
+}
+
+/**
+ * @brief Poll until every request on a lane has completed and its callback ran
+ */
+inline void settle(paperhome::NetLane lane) {
+    paperhome::NetworkWorker& worker = network();
+    // Callbacks may queue follow-up requests, so check after each poll
+    while (true) {
+        worker.poll();
+        if (worker.getPendingCount(lane) == 0) break;
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+} // namespace bench
@@ -0,0 +1,190 @@
+#ifndef PAPERHOME_HTTP_CONNECTION_H
+#define PAPERHOME_HTTP_CONNECTION_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include <functional>
+#include <memory>
+
+namespace paperhome {
+
+enum class NetMethod : uint8_t {
+    GET,
+    POST,
+    PUT,
+    DEL
+};
+
+/**
+ * @brief Parses a response body straight off the connection
+ *
+ * Runs on the lane task and gets the body as a Stream that ends with the
+ * response, so large responses never sit in RAM as a String.
+ * Returns false if the body could not be parsed.
+ */
+using BodyReader = std::function<bool(Stream& body)>;
+
+/**
+ * @brief Outbound HTTP(S) request
+ */
+struct NetRequest {
+    NetMethod method = NetMethod::GET;
+    String url;
+    String body;
+    const char* contentType = nullptr;  // Static string; nullptr = no body header
+    String authorization;               // Authorization header value, empty = none
+    String ifNoneMatch;                 // ETag of the cached body, empty = unconditional
+    bool secure = false;                // TLS (certificate not verified)
+    uint32_t timeoutMs = 5000;
+    BodyReader reader;                  // Reads a 2xx body instead of NetResponse::body
+};
+
+/**
+ * @brief Completed request
+ */
+struct NetResponse {
+    int code = 0;               // HTTP status, or negative HTTPClient error
+    String body;                // Empty if the request had a reader
+    bool parsed = false;        // Reader accepted the body
+    String etag;                // ETag response header, empty if none
+    uint32_t queuedMs = 0;      // Time waiting in the lane queue
+    uint32_t transferMs = 0;    // Time in HTTPClient
+
+    bool isSuccess() const { return code >= 200 && code < 300; }
+};
+
+/**
+ * @brief One HTTP(S) client connection, optionally kept alive between requests
+ *
+ * With keep-alive the HTTPClient and its WiFiClient outlive each request,
+ * so back-to-back requests to the same host share one TCP (and TLS)
+ * connection instead of paying a handshake each. The connection is
+ * dropped when the host changes, after idleTimeoutMs without a request
+ * (before the peer closes it under us), or on a transport error. A
+ * request that fails on a reused connection before it was fully sent is
+ * retried once on a fresh one; a GET also when the connection was lost
+ * after sending. Other methods are not repeated, the peer may already
+ * have applied them (e.g. a rotated refresh token).
+ *
+ * New connections are opened here rather than inside HTTPClient, so the
+ * connect (TCP + full TLS handshake) is timed on its own.
+ *
+ * Not thread-safe: owned by one network lane.
+ *
+ * Usage:
+ *   HttpConnection bridge(true, 10000);
+ *   NetResponse response;
+ *   bridge.execute(request, response);
+ */
+class HttpConnection {
+public:
+    struct Stats {
+        uint32_t requests = 0;      ///< Requests sent (retries included)
+        uint32_t connects = 0;      ///< New connections (full handshakes for TLS)
+        uint32_t reused = 0;        ///< Requests sent on a kept-alive connection
+        uint32_t retries = 0;       ///< Stale connections retried
+        uint32_t connectMs = 0;     ///< Total time spent connecting
+        uint32_t connectMaxMs = 0;  ///< Slowest connect
+
+        void add(const Stats& other);
+    };
+
+    /**
+     * @param keepAlive Keep the connection open between requests
+     * @param idleTimeoutMs Close a kept-alive connection idle for this long
+     */
+    HttpConnection(bool keepAlive, uint32_t idleTimeoutMs);
+
+    HttpConnection(const HttpConnection&) = delete;
+    HttpConnection& operator=(const HttpConnection&) = delete;
+
+    /**
+     * @brief Send a request and read the whole response (blocking)
+     */
+    void execute(const NetRequest& request, NetResponse& response);
+
+    /**
+     * @brief Close the connection now
+     */
+    void close();
+
+    bool isOpen();
+    const Stats& getStats() const { return _stats; }
+
+    /**
+     * @brief Host of the open connection ("" if closed)
+     */
+    const char* getHost() const { return _host; }
+    bool isSecure() const { return _hostSecure; }
+    uint32_t getLastUsed() const { return _lastUsed; }
+
+    /**
+     * @brief Split an http(s) URL into host and port
+     */
+    static void parseUrl(const String& url, char* host, size_t hostSize, uint16_t& port);
+
+    static constexpr size_t HOST_SIZE = 64;
+
+private:
+    WiFiClient _tcp;
+    WiFiClientSecure _tls;
+    HTTPClient _http;
+    const bool _keepAlive;
+    const uint32_t _idleTimeoutMs;
+
+    char _host[HOST_SIZE];      // Host of the open connection, "" if none
+    bool _hostSecure;           // Transport of the open connection
+    uint32_t _lastUsed;
+    Stats _stats;
+
+    WiFiClient& transport(bool secure) { return secure ? static_cast<WiFiClient&>(_tls) : _tcp; }
+    bool canReuse(const char* host, bool secure);
+    bool open(const char* host, uint16_t port, bool secure);
+    int send(const NetRequest& request, NetResponse& response);
+    bool readBody(const BodyReader& reader);
+
+    static bool canRetry(NetMethod method, int code);
+};
+
+/**
+ * @brief Small per-host cache of HttpConnections
+ *
+ * Requests go to the connection already open to their host; a host
+ * without one takes an unused slot, else the least recently used
+ * connection is closed and reused. Lets one lane keep its connections to
+ * several hosts (Tado login, API and HOPS) alive at once.
+ */
+class HttpConnectionPool {
+public:
+    static constexpr uint8_t MAX_CONNECTIONS = 4;
+
+    /**
+     * @param size Connections kept (1..MAX_CONNECTIONS)
+     * @param keepAlive Keep connections open between requests
+     * @param idleTimeoutMs Close a connection idle for this long
+     */
+    HttpConnectionPool(uint8_t size, bool keepAlive, uint32_t idleTimeoutMs);
+
+    HttpConnectionPool(const HttpConnectionPool&) = delete;
+    HttpConnectionPool& operator=(const HttpConnectionPool&) = delete;
+
+    void execute(const NetRequest& request, NetResponse& response);
+    void close();
+
+    /**
+     * @brief Counters summed over all connections
+     */
+    HttpConnection::Stats getStats() const;
+
+private:
+    std::unique_ptr<HttpConnection> _slots[MAX_CONNECTIONS];
+    uint8_t _size;
+
+    HttpConnection& select(const char* host, bool secure);
+};
+
+} // namespace paperhome
+
+#endif // PAPERHOME_HTTP_CONNECTION_H
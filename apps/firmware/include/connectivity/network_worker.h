@@ -0,0 +1,157 @@
+#ifndef PAPERHOME_NETWORK_WORKER_H
+#define PAPERHOME_NETWORK_WORKER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <atomic>
+#include <functional>
+#include "core/config.h"
+#include "core/spsc_ring.h"
+#include "connectivity/http_connection.h"
+
+namespace paperhome {
+
+/**
+ * @brief Network lane: one worker task per remote host
+ *
+ * Requests on one lane run one at a time; lanes run in parallel, so a
+ * slow cloud endpoint never holds up the local bridge.
+ */
+enum class NetLane : uint8_t {
+    HUE,        // Local bridge (plain HTTP)
+    TADO,       // Cloud API and OAuth (HTTPS)
+    COUNT
+};
+
+/**
+ * @brief Request priority within a lane
+ */
+enum class NetPriority : uint8_t {
+    USER,           // User commands: taken before any queued background request
+    BACKGROUND      // Polling, token refresh, discovery follow-ups
+};
+
+/**
+ * @brief Network worker: runs HTTP(S) requests off the I/O task
+ *
+ * Services submit requests from the I/O task and get a completion
+ * callback back on the I/O task (from poll()), so service state is only
+ * ever touched by one task while blocking transfers run on the lanes.
+ *
+ * - Each lane has a bounded user queue and a bounded background queue
+ *   (SpscRings, I/O task → lane); user requests always go first
+ * - Completions return through a per-lane SpscRing (lane → I/O task)
+ * - A lane sleeps on a 1-deep wake queue until work is submitted
+ * - Each lane owns an HttpConnectionPool of kept-alive connections: one
+ *   to the bridge, one per Tado host, so queued requests go out
+ *   back-to-back and most Tado requests skip the TLS handshake
+ *
+ * Usage:
+ *   NetworkWorker network;
+ *   network.start();
+ *
+ *   NetRequest request;
+ *   request.url = "http://192.168.1.2/api/user/groups";
+ *   network.submit(NetLane::HUE, NetPriority::BACKGROUND, std::move(request),
+ *                  [](const NetResponse& response) { parse(response.body); });
+ *
+ *   // In I/O loop
+ *   network.poll();
+ */
+class NetworkWorker {
+public:
+    using Callback = std::function<void(const NetResponse& response)>;
+
+    NetworkWorker();
+
+    NetworkWorker(const NetworkWorker&) = delete;
+    NetworkWorker& operator=(const NetworkWorker&) = delete;
+
+    /**
+     * @brief Create the lane tasks
+     * @return false if a task or queue could not be created
+     */
+    bool start();
+
+    /**
+     * @brief Queue a request (I/O task only)
+     *
+     * @param lane Lane for the request's host
+     * @param priority USER or BACKGROUND queue
+     * @param request Request (moved in)
+     * @param callback Called from poll() once the request completes
+     * @return false if that queue is full (callback is not called)
+     */
+    bool submit(NetLane lane, NetPriority priority, NetRequest&& request, Callback callback);
+
+    /**
+     * @brief Run callbacks of completed requests (I/O task only)
+     * @return Number of callbacks run
+     */
+    size_t poll();
+
+    /**
+     * @brief Requests queued, in flight or awaiting poll() on a lane (approximate)
+     */
+    size_t getPendingCount(NetLane lane) const;
+
+    /**
+     * @brief Requests refused because a queue was full
+     */
+    uint32_t getRejectedCount() const { return _rejected; }
+
+    /**
+     * @brief Connection counters of a lane (approximate while it runs)
+     */
+    HttpConnection::Stats getConnectionStats(NetLane lane) const {
+        return _lanes[static_cast<uint8_t>(lane)].connections->getStats();
+    }
+
+    /**
+     * @brief Close a lane's kept-alive connections (before its next request)
+     */
+    void closeConnections(NetLane lane);
+
+    /**
+     * @brief Log per-lane request, connect/handshake and reuse counters
+     */
+    void logStats() const;
+
+private:
+    struct Job {
+        NetRequest request;
+        Callback callback;
+        NetResponse response;
+        uint32_t submittedAt = 0;
+    };
+
+    struct Lane {
+        SpscRing<Job, config::tasks::NET_USER_QUEUE_SIZE> user;
+        SpscRing<Job, config::tasks::NET_BACKGROUND_QUEUE_SIZE> background;
+        SpscRing<Job, config::tasks::NET_COMPLETION_QUEUE_SIZE> done;
+        QueueHandle_t wake = nullptr;
+        TaskHandle_t task = nullptr;
+        std::atomic<uint8_t> inFlight{0};
+        std::atomic<bool> closeRequested{false};
+        NetworkWorker* owner = nullptr;
+        HttpConnectionPool* connections = nullptr;
+        const char* name = nullptr;
+    };
+
+    HttpConnectionPool _hueConnections;
+    HttpConnectionPool _tadoConnections;
+    Lane _lanes[static_cast<uint8_t>(NetLane::COUNT)];
+    uint32_t _rejected;
+
+    static void laneTask(void* param);
+    void execute(Lane& lane, Job& job);
+
+    void log(const char* msg);
+    void logf(const char* fmt, ...);
+};
+
+} // namespace paperhome
+
+#endif // PAPERHOME_NETWORK_WORKER_H
@@ -27,18 +27,54 @@ namespace tasks {
     constexpr uint8_t UI_CORE = 1;          // Display, Navigation, Input
 
     // Task priorities (higher = more important)
-    constexpr uint8_t IO_TASK_PRIORITY = 1;
+    constexpr uint8_t IO_TASK_PRIORITY = 2;     // Above network lanes: input never waits on HTTP
     constexpr uint8_t UI_TASK_PRIORITY = 2;
 
     // Stack sizes (in bytes)
     constexpr uint32_t IO_TASK_STACK = 8192;
     constexpr uint32_t UI_TASK_STACK = 8192;
 
-    // Queue sizes
+    // Panel refresh task (SPI transfer + BUSY wait, see DisplayDriver)
+    constexpr uint8_t PANEL_CORE = UI_CORE;
+    constexpr uint8_t PANEL_TASK_PRIORITY = 3;  // Above UI: mostly asleep on BUSY
+    constexpr uint32_t PANEL_TASK_STACK = 4096;
+
+    // Network worker lanes (one task per remote host, see NetworkWorker)
+    constexpr uint8_t NET_CORE = IO_CORE;
+    constexpr uint8_t NET_TASK_PRIORITY = 1;
+    constexpr uint32_t NET_TASK_STACK = 8192;   // TLS handshake needs the headroom
+
+    // Hue event stream reader (long-lived HTTPS connection, see HueEventStream)
+    constexpr uint8_t HUE_EVENTS_PRIORITY = NET_TASK_PRIORITY;
+    constexpr uint32_t HUE_EVENTS_STACK = 8192;
+
+    // Queue sizes (cross-core channels are SpscRings: powers of two)
     constexpr uint8_t SENSOR_QUEUE_SIZE = 8;
-    constexpr uint8_t HUE_CMD_QUEUE_SIZE = 4;
-    constexpr uint8_t TADO_CMD_QUEUE_SIZE = 4;
+    constexpr uint8_t HUE_CMD_QUEUE_SIZE = 8;
+    constexpr uint8_t TADO_CMD_QUEUE_SIZE = 8;
     constexpr uint8_t EVENT_QUEUE_SIZE = 16;
+    constexpr uint8_t NET_USER_QUEUE_SIZE = 8;          // Per lane
+    constexpr uint8_t NET_BACKGROUND_QUEUE_SIZE = 4;    // Per lane
+    constexpr uint8_t NET_COMPLETION_QUEUE_SIZE = 16;   // Per lane
+    constexpr uint8_t HUE_EVENT_QUEUE_SIZE = 16;        // Room deltas from the event stream
+
+    // I/O task jobs (DeadlineScheduler): interval / budget in ms.
+    // Services pace their own polling; the interval bounds command latency.
+    constexpr uint32_t IO_INPUT_INTERVAL_MS = 10;      // Controller poll (matches old 100 Hz loop)
+    constexpr uint32_t IO_INPUT_BUDGET_MS = 2;
+    constexpr uint32_t IO_NET_INTERVAL_MS = 10;        // Network completions (response parsing)
+    constexpr uint32_t IO_NET_BUDGET_MS = 30;
+    constexpr uint32_t IO_HUE_INTERVAL_MS = 20;        // Commands + discovery/polling
+    constexpr uint32_t IO_HUE_BUDGET_MS = 5;           // HTTP runs on a network lane
+    constexpr uint32_t IO_TADO_INTERVAL_MS = 50;       // Commands + auth/zone polling
+    constexpr uint32_t IO_TADO_BUDGET_MS = 5;
+    constexpr uint32_t IO_SENSOR_INTERVAL_MS = 250;    // Sensors read every 30 s internally
+    constexpr uint32_t IO_SENSOR_BUDGET_MS = 20;
+    constexpr uint32_t IO_MQTT_INTERVAL_MS = 20;
+    constexpr uint32_t IO_MQTT_BUDGET_MS = 20;
+    constexpr uint32_t IO_STATUS_INTERVAL_MS = 5000;   // Status bar, device info, telemetry
+    constexpr uint32_t IO_STATUS_BUDGET_MS = 50;
+    constexpr uint32_t IO_STATS_INTERVAL_MS = 60000;   // Job/network stats log (TASKS_DBG, NET_DBG)
 }
 
 // =============================================================================
@@ -60,9 +96,24 @@ namespace display {
     constexpr uint16_t HEIGHT = 800;
     constexpr uint8_t ROTATION = 1;  // 90° CW for portrait
 
-    // Refresh configuration
-    constexpr uint32_t FULL_REFRESH_INTERVAL_MS = 120000;  // Force full refresh every 2 min
-    constexpr uint8_t MAX_PARTIAL_BEFORE_FULL = 25;        // After this many partials
+    // Ghosting budget per 32x32 native tile (see RefreshScheduler)
+    constexpr uint8_t GHOST_PARTIAL_BUDGET = 25;           // Partial refreshes that changed the tile
+    constexpr uint32_t GHOST_FLIP_BUDGET = 8192;           // Pixel flips (8x the tile area)
+    constexpr uint32_t GHOST_IDLE_MS = 5000;               // Clean up only after this long without input
+    constexpr uint8_t GHOST_FULL_PERCENT = 50;             // Full refresh if this much is over budget
+
+    // Partial refresh cost model (dirty rects merge when cheaper)
+    constexpr int32_t REFRESH_RECT_OVERHEAD_PX = 60000;    // Fixed cost per refresh window, in pixels
+
+    // Display list (recorded frames, see DisplayList)
+    constexpr uint16_t DISPLAY_LIST_CAPACITY = 512;        // Commands per frame
+    constexpr uint16_t DISPLAY_LIST_TEXT_BYTES = 8192;     // Text arena per frame
+    constexpr int16_t DISPLAY_LIST_BAND_ROWS = 32;         // Native rows per raster band
+
+    // Asynchronous refresh: a panel task streams the frame and waits on BUSY
+    // while the UI task keeps running; requests made meanwhile coalesce
+    constexpr bool ASYNC_REFRESH = true;
+    constexpr uint32_t BUSY_WAIT_SLICE_MS = 10;            // Max sleep per BUSY check (edge IRQ wakes earlier)
 }
 
 // =============================================================================
@@ -162,8 +213,22 @@ namespace mqtt {
 // =============================================================================
 namespace hue {
     constexpr const char* DEVICE_TYPE = "paperhome#espink";
-    constexpr uint32_t POLL_INTERVAL_MS = 5000;
+    constexpr uint32_t POLL_INTERVAL_MS = 5000;        // After a change seen on the bridge
+    constexpr uint32_t POLL_INTERVAL_FAST_MS = 1000;   // After a local command
+    constexpr uint32_t POLL_INTERVAL_MAX_MS = 30000;   // Doubled up to this while nothing changes
+    constexpr bool INCREMENTAL_POLL = true;            // Hash /groups, parse only when it changed
+    constexpr bool EVENT_STREAM = true;                // API v2 push updates, polling as fallback
+    constexpr uint32_t POLL_INTERVAL_STREAM_MS = 300000;   // Resync poll while the stream is up
+    constexpr uint32_t EVENT_RECONNECT_MS = 5000;      // Doubled up to the max while the bridge refuses
+    constexpr uint32_t EVENT_RECONNECT_MAX_MS = 60000;
+    constexpr uint32_t EVENT_READ_POLL_MS = 10;        // Stream task sleep while no event is pending
+    constexpr bool COALESCE_BRIGHTNESS = true;         // One pending brightness per room, latest wins
+    constexpr uint32_t GROUP_COMMAND_INTERVAL_MS = 1000;   // Bridge limit: about one group command per second
+    constexpr uint32_t SWEEP_SETTLE_MS = 500;          // No new brightness for this long ends a sweep
+    constexpr uint8_t COMMAND_RETRIES = 2;             // Rejected brightness PUTs resent before giving up
+    constexpr uint32_t PENDING_TIMEOUT_MS = 15000;     // Optimistic room state not confirmed by then is dropped
     constexpr uint32_t REQUEST_TIMEOUT_MS = 5000;
+    constexpr uint32_t KEEPALIVE_IDLE_MS = 10000;   // Reopen rather than risk a bridge-closed socket
 
     // NVS storage
     constexpr const char* NVS_NAMESPACE = "hue";
@@ -185,8 +250,12 @@ namespace tado {
     constexpr uint32_t TOKEN_REFRESH_MS = 540000;    // 9 min (before 10 min expiry)
     constexpr uint32_t AUTH_POLL_MS = 5000;
     constexpr uint32_t REQUEST_TIMEOUT_MS = 10000;
+    constexpr uint8_t TLS_CONNECTIONS = 3;           // login, my and hops hosts kept open
+    constexpr uint32_t KEEPALIVE_IDLE_MS = 90000;    // Outlives the 60 s zone poll
     constexpr float TEMP_THRESHOLD = 0.5f;
     constexpr uint32_t SYNC_INTERVAL_MS = 300000;    // Sync sensor every 5 min
+    constexpr uint32_t PENDING_TIMEOUT_MS = 30000;   // Optimistic setpoint not confirmed by then is dropped
+    constexpr bool CONDITIONAL_POLL = true;          // Zone polls send the last /rooms ETag
 
     // NVS storage
     constexpr const char* NVS_NAMESPACE = "tado";
@@ -300,6 +369,7 @@ namespace debug {
     constexpr bool HUE_DBG = true;
     constexpr bool TADO_DBG = true;
     constexpr bool MQTT_DBG = true;
+    constexpr bool NET_DBG = true;
     constexpr bool SENSORS_DBG = true;
     constexpr bool CONTROLLER_DBG = true;
     constexpr bool POWER_DBG = true;
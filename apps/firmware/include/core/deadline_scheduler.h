@@ -0,0 +1,285 @@
+#pragma once
+
+#include <Arduino.h>
+#include <cstddef>
+#include <cstdint>
+#include "core/config.h"
+
+namespace paperhome {
+
+/**
+ * @brief Deadline-based cooperative scheduler for a task's periodic jobs
+ *
+ * Successor to the archived PeriodicScheduler (utils/periodic_scheduler.h):
+ * same add/enable/interval/runNow model, but
+ * - jobs sit in a min-heap keyed by next deadline, so runDue() only
+ *   touches jobs that are due and returns how long the task may sleep
+ * - each job has a time budget; runs over budget are counted (and
+ *   logged with TASKS_DBG) together with last/worst run time
+ * - a job that falls behind skips the deadlines it missed rather than
+ *   running back to back to catch up (counted as late)
+ *
+ * Fixed capacity and plain function pointers: no allocation after construction.
+ *
+ * Usage:
+ *   DeadlineScheduler scheduler;
+ *   scheduler.addJob("input", pollInput, 10, 2);
+ *   scheduler.addJob("status", sendStatus, 5000, 20);
+ *
+ *   while (true) {
+ *       uint32_t sleepMs = scheduler.runDue(millis());
+ *       vTaskDelay(pdMS_TO_TICKS(sleepMs));
+ *   }
+ */
+class DeadlineScheduler {
+public:
+    using JobId = uint8_t;
+    using JobFn = void (*)();
+
+    static constexpr uint8_t MAX_JOBS = 16;
+    static constexpr JobId INVALID_JOB = 0xFF;
+    static constexpr uint32_t MAX_SLEEP_MS = 1000;  // Sleep cap with no job due
+
+    struct JobStats {
+        uint32_t runs = 0;
+        uint32_t overruns = 0;      // Runs longer than the budget
+        uint32_t late = 0;          // Runs that missed one or more deadlines
+        uint32_t lastUs = 0;
+        uint32_t worstUs = 0;
+    };
+
+    DeadlineScheduler() : _jobCount(0), _heapSize(0) {}
+
+    DeadlineScheduler(const DeadlineScheduler&) = delete;
+    DeadlineScheduler& operator=(const DeadlineScheduler&) = delete;
+
+    // =========================================================================
+    // Jobs
+    // =========================================================================
+
+    /**
+     * @brief Add a periodic job
+     *
+     * @param name Name for logs (not copied)
+     * @param fn Job body
+     * @param intervalMs Time between deadlines (at least 1)
+     * @param budgetMs Expected worst run time; longer runs count as overruns
+     * @param startEnabled First deadline is now if true
+     * @return Job ID, or INVALID_JOB if MAX_JOBS are in use
+     */
+    JobId addJob(const char* name, JobFn fn, uint32_t intervalMs, uint32_t budgetMs,
+                 bool startEnabled = true) {
+        if (_jobCount >= MAX_JOBS || !fn) return INVALID_JOB;
+
+        const JobId id = _jobCount++;
+        Job& job = _jobs[id];
+        job.name = name;
+        job.fn = fn;
+        job.intervalMs = intervalMs > 0 ? intervalMs : 1;
+        job.budgetUs = budgetMs * 1000;
+        job.deadline = static_cast<uint32_t>(millis());
+        if (startEnabled) heapPush(id);
+        return id;
+    }
+
+    /**
+     * @brief Enable or disable a job
+     *
+     * A re-enabled job first runs one interval from now.
+     */
+    void setEnabled(JobId id, bool enabled) {
+        if (id >= _jobCount || enabled == isEnabled(id)) return;
+        if (enabled) {
+            _jobs[id].deadline = static_cast<uint32_t>(millis()) + _jobs[id].intervalMs;
+            heapPush(id);
+        } else {
+            heapRemove(id);
+        }
+    }
+
+    bool isEnabled(JobId id) const {
+        return id < _jobCount && _jobs[id].heapIndex != INVALID_JOB;
+    }
+
+    /**
+     * @brief Change a job's interval (takes effect from its next deadline)
+     */
+    void setInterval(JobId id, uint32_t intervalMs) {
+        if (id < _jobCount) _jobs[id].intervalMs = intervalMs > 0 ? intervalMs : 1;
+    }
+
+    uint32_t getInterval(JobId id) const {
+        return id < _jobCount ? _jobs[id].intervalMs : 0;
+    }
+
+    /**
+     * @brief Make an enabled job due now (runs on the next runDue())
+     */
+    void runNow(JobId id) {
+        if (!isEnabled(id)) return;
+        _jobs[id].deadline = static_cast<uint32_t>(millis());
+        siftUp(_jobs[id].heapIndex);
+    }
+
+    // =========================================================================
+    // Running
+    // =========================================================================
+
+    /**
+     * @brief Run every job whose deadline has passed, earliest first
+     *
+     * Each job runs at most once per call, so a job with a short interval
+     * can't starve the others.
+     *
+     * @param now Current time (ms)
+     * @return Milliseconds until the next deadline (0 if one is already
+     *         due, MAX_SLEEP_MS if nothing is enabled)
+     */
+    uint32_t runDue(uint32_t now) {
+        // Jobs rescheduled this pass have deadlines after `now`, so the
+        // loop ends once every due job has run once
+        while (_heapSize > 0) {
+            const JobId id = _heap[0];
+            Job& job = _jobs[id];
+            if (isBefore(now, job.deadline)) break;
+
+            const uint32_t startUs = static_cast<uint32_t>(micros());
+            job.fn();
+            const uint32_t elapsedUs = static_cast<uint32_t>(micros()) - startUs;
+
+            JobStats& stats = job.stats;
+            stats.runs++;
+            stats.lastUs = elapsedUs;
+            if (elapsedUs > stats.worstUs) stats.worstUs = elapsedUs;
+            if (job.budgetUs > 0 && elapsedUs > job.budgetUs) {
+                stats.overruns++;
+                if (config::debug::TASKS_DBG) {
+                    Serial.printf("[Scheduler] %s overran: %lu us (budget %lu us)\n",
+                                  job.name, (unsigned long)elapsedUs, (unsigned long)job.budgetUs);
+                }
+            }
+
+            // The job may have disabled itself
+            if (job.heapIndex == INVALID_JOB) continue;
+
+            // Keep the original cadence; skip deadlines already missed
+            job.deadline += job.intervalMs;
+            const uint32_t finished = static_cast<uint32_t>(millis());
+            if (!isBefore(finished, job.deadline)) {
+                stats.late++;
+                job.deadline = finished + job.intervalMs;
+            }
+            siftDown(job.heapIndex);
+            now = finished;
+        }
+        return getTimeUntilNext(now);
+    }
+
+    /**
+     * @brief Milliseconds until the next deadline (see runDue())
+     */
+    uint32_t getTimeUntilNext(uint32_t now) const {
+        if (_heapSize == 0) return MAX_SLEEP_MS;
+        const uint32_t deadline = _jobs[_heap[0]].deadline;
+        if (!isBefore(now, deadline)) return 0;
+        const uint32_t wait = deadline - now;
+        return wait < MAX_SLEEP_MS ? wait : MAX_SLEEP_MS;
+    }
+
+    // =========================================================================
+    // Stats
+    // =========================================================================
+
+    const JobStats& getStats(JobId id) const { return _jobs[id].stats; }
+    const char* getName(JobId id) const { return _jobs[id].name; }
+    size_t getJobCount() const { return _jobCount; }
+
+    /**
+     * @brief Log run/overrun counts for every job (TASKS_DBG)
+     */
+    void logStats() const {
+        if (!config::debug::TASKS_DBG) return;
+        for (uint8_t i = 0; i < _jobCount; i++) {
+            const JobStats& stats = _jobs[i].stats;
+            Serial.printf("[Scheduler] %-8s runs=%lu late=%lu overruns=%lu last=%lu us worst=%lu us\n",
+                          _jobs[i].name, (unsigned long)stats.runs, (unsigned long)stats.late,
+                          (unsigned long)stats.overruns, (unsigned long)stats.lastUs,
+                          (unsigned long)stats.worstUs);
+        }
+    }
+
+private:
+    struct Job {
+        const char* name = nullptr;
+        JobFn fn = nullptr;
+        uint32_t intervalMs = 0;
+        uint32_t budgetUs = 0;
+        uint32_t deadline = 0;
+        uint8_t heapIndex = INVALID_JOB;    // Position in _heap, INVALID_JOB if disabled
+        JobStats stats;
+    };
+
+    Job _jobs[MAX_JOBS];
+    uint8_t _jobCount;
+
+    // Min-heap of enabled job IDs, ordered by deadline
+    JobId _heap[MAX_JOBS];
+    uint8_t _heapSize;
+
+    // Wrap-safe: millis() rolls over after ~49 days
+    static bool isBefore(uint32_t a, uint32_t b) {
+        return static_cast<int32_t>(a - b) < 0;
+    }
+
+    bool earlier(uint8_t i, uint8_t j) const {
+        return isBefore(_jobs[_heap[i]].deadline, _jobs[_heap[j]].deadline);
+    }
+
+    void heapPush(JobId id) {
+        _heap[_heapSize] = id;
+        _jobs[id].heapIndex = _heapSize;
+        siftUp(_heapSize++);
+    }
+
+    void heapRemove(JobId id) {
+        const uint8_t index = _jobs[id].heapIndex;
+        _jobs[id].heapIndex = INVALID_JOB;
+        if (--_heapSize == index) return;
+
+        _heap[index] = _heap[_heapSize];
+        _jobs[_heap[index]].heapIndex = index;
+        siftUp(index);
+        siftDown(_jobs[_heap[index]].heapIndex);
+    }
+
+    void siftUp(uint8_t index) {
+        while (index > 0) {
+            const uint8_t parent = (index - 1) / 2;
+            if (!earlier(index, parent)) break;
+            swapNodes(index, parent);
+            index = parent;
+        }
+    }
+
+    void siftDown(uint8_t index) {
+        while (true) {
+            const uint8_t left = index * 2 + 1;
+            if (left >= _heapSize) break;
+            const uint8_t right = left + 1;
+            const uint8_t child = (right < _heapSize && earlier(right, left)) ? right : left;
+            if (!earlier(child, index)) break;
+            swapNodes(index, child);
+            index = child;
+        }
+    }
+
+    void swapNodes(uint8_t a, uint8_t b) {
+        const JobId idA = _heap[a];
+        _heap[a] = _heap[b];
+        _heap[b] = idA;
+        _jobs[_heap[a]].heapIndex = a;
+        _jobs[_heap[b]].heapIndex = b;
+    }
+};
+
+} // namespace paperhome
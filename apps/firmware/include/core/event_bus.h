@@ -1,6 +1,7 @@
 #ifndef PAPERHOME_EVENT_BUS_H
 #define PAPERHOME_EVENT_BUS_H
 
+#include <algorithm>
 #include <functional>
 #include <vector>
 #include <Arduino.h>
@@ -32,6 +33,10 @@ struct Event {
  * Uses FreeRTOS mutex for thread safety across dual cores.
  * Uses compile-time type identification for type safety without RTTI overhead.
  *
+ * Handlers are std::function and run under the mutex on the publishing
+ * task. For hot paths or cross-core delivery without heap traffic use
+ * StaticEventBus (core/static_event_bus.h).
+ *
  * Usage:
  *   // Define an event
  *   struct SensorDataEvent : Event {
@@ -172,7 +177,7 @@ public:
     }
 
 private:
-    EventBus() : _mutex(nullptr), _nextId(1), _nextTypeId(0) {}
+    EventBus() : _mutex(nullptr), _nextId(1) {}
     ~EventBus() {
         if (_mutex) {
             vSemaphoreDelete(_mutex);
@@ -213,18 +218,17 @@ private:
     mutable SemaphoreHandle_t _mutex;
     std::vector<TypedHandlerList> _handlerLists;
     SubscriptionId _nextId;
-    size_t _nextTypeId;
 
     /**
      * @brief Get a unique type ID for an event type
      *
-     * Uses a static local variable per type to generate unique IDs
-     * without needing RTTI or std::type_index
+     * The address of a per-type static tag: fixed at link time, so it is
+     * the same on both cores and needs no shared counter (no RTTI either)
      */
     template<typename T>
-    size_t getTypeId() const {
-        static size_t id = const_cast<EventBus*>(this)->_nextTypeId++;
-        return id;
+    static size_t getTypeId() {
+        static const char tag = 0;
+        return reinterpret_cast<size_t>(&tag);
     }
 
     TypedHandlerList* findOrCreateHandlerList(size_t typeId) {
@@ -1,17 +1,17 @@
 #pragma once
 
-#include <freertos/FreeRTOS.h>
-#include <freertos/queue.h>
 #include "input/input_types.h"
 #include "core/config.h"
+#include "core/spsc_ring.h"
 
 namespace paperhome {
 
 /**
- * @brief Thread-safe input queue for Core 0 → Core 1 communication
+ * @brief Lock-free input queue for Core 0 → Core 1 communication
  *
  * Allows the I/O task (Core 0) to send input events to the UI task (Core 1)
- * without blocking. Uses FreeRTOS queue internally.
+ * without blocking. Backed by an SpscRing: exactly one producer (the I/O
+ * task or an ISR) and one consumer (the UI task).
  *
  * Usage:
  *   InputQueue inputQueue;
@@ -28,23 +28,19 @@ namespace paperhome {
  */
 class InputQueue {
 public:
-    InputQueue() : _queue(nullptr) {}
+    static constexpr size_t CAPACITY = config::tasks::EVENT_QUEUE_SIZE;
 
-    ~InputQueue() {
-        if (_queue) {
-            vQueueDelete(_queue);
-        }
-    }
+    InputQueue() = default;
 
     /**
      * @brief Initialize the queue
-     * @param size Queue capacity (default from config)
-     * @return true if successful
+     *
+     * The ring is statically sized (CAPACITY), so there is nothing to
+     * allocate; kept so start-up code reads the same for every channel.
+     *
+     * @return true
      */
-    bool init(size_t size = config::tasks::EVENT_QUEUE_SIZE) {
-        _queue = xQueueCreate(size, sizeof(InputAction));
-        return _queue != nullptr;
-    }
+    bool init() { return true; }
 
     /**
      * @brief Send an input action to the queue (from I/O task)
@@ -55,41 +51,43 @@ public:
      * @return true if sent successfully
      */
     bool send(const InputAction& action) {
-        if (!_queue) return false;
-        return xQueueSend(_queue, &action, 0) == pdTRUE;
+        return _ring.push(action);
     }
 
     /**
      * @brief Send from ISR context
      *
-     * Use this if sending from an interrupt handler.
+     * The ring never blocks or enters a critical section, so this is the
+     * same as send(); the ISR must then be the only producer.
      *
      * @param action The input action to send
      * @return true if sent successfully
      */
     bool sendFromISR(const InputAction& action) {
-        if (!_queue) return false;
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        bool result = xQueueSendFromISR(_queue, &action, &xHigherPriorityTaskWoken) == pdTRUE;
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR();
-        }
-        return result;
+        return _ring.push(action);
     }
 
     /**
      * @brief Receive an input action from the queue (on UI task)
      *
-     * Non-blocking by default. Use timeout_ms for blocking behavior.
+     * Non-blocking.
      *
      * @param action Output: the received action
-     * @param timeout_ms Wait time (0 = non-blocking, portMAX_DELAY = forever)
      * @return true if action was received
      */
-    bool receive(InputAction& action, uint32_t timeout_ms = 0) {
-        if (!_queue) return false;
-        TickType_t ticks = (timeout_ms == 0) ? 0 : pdMS_TO_TICKS(timeout_ms);
-        return xQueueReceive(_queue, &action, ticks) == pdTRUE;
+    bool receive(InputAction& action) {
+        return _ring.pop(action);
+    }
+
+    /**
+     * @brief Process all pending actions in place (on UI task)
+     *
+     * @param fn Called as fn(const InputAction&) for each action
+     * @return Number of actions processed
+     */
+    template<typename Fn>
+    size_t receiveAll(Fn&& fn) {
+        return _ring.consume(std::forward<Fn>(fn));
     }
 
     /**
@@ -99,51 +97,42 @@ public:
      * @return true if queue has an item
      */
     bool peek(InputAction& action) {
-        if (!_queue) return false;
-        return xQueuePeek(_queue, &action, 0) == pdTRUE;
+        const InputAction* front = _ring.front();
+        if (!front) return false;
+        action = *front;
+        return true;
     }
 
     /**
      * @brief Check how many items are in the queue
      */
     size_t count() const {
-        if (!_queue) return 0;
-        return uxQueueMessagesWaiting(_queue);
+        return _ring.count();
     }
 
     /**
      * @brief Check if queue is empty
      */
     bool isEmpty() const {
-        return count() == 0;
+        return _ring.isEmpty();
     }
 
     /**
      * @brief Check if queue is full
      */
     bool isFull() const {
-        if (!_queue) return true;
-        return uxQueueSpacesAvailable(_queue) == 0;
+        return _ring.isFull();
     }
 
     /**
-     * @brief Clear all pending items
+     * @brief Clear all pending items (on UI task)
      */
     void clear() {
-        if (_queue) {
-            xQueueReset(_queue);
-        }
-    }
-
-    /**
-     * @brief Check if queue is initialized
-     */
-    bool isValid() const {
-        return _queue != nullptr;
+        _ring.clear();
     }
 
 private:
-    QueueHandle_t _queue;
+    SpscRing<InputAction, CAPACITY> _ring;
 
     // Non-copyable
     InputQueue(const InputQueue&) = delete;
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace paperhome {
+
+/**
+ * @brief Latest-value mailbox (seqlock) for state snapshots
+ *
+ * For "latest wins" data passed between one writer task and one reader
+ * task. The writer overwrites the single slot and never blocks or fails;
+ * the reader copies out the newest snapshot and skips any versions it
+ * missed. Nothing queues up, so nothing can overflow.
+ *
+ * - The sequence counter is odd while a write is in progress; the reader
+ *   retries if it was odd or changed during the copy
+ * - Each completed publish bumps version() by one
+ * - read() gives up after a few torn attempts (writer preempted
+ *   mid-copy) instead of spinning; the reader just tries again later
+ *
+ * Usage:
+ *   Mailbox<SensorData> sensorBox;
+ *
+ *   // Writer (Core 0):
+ *   sensorBox.publish(data);
+ *
+ *   // Reader (Core 1):
+ *   uint32_t seen = 0;
+ *   SensorData latest;
+ *   if (sensorBox.readIfNewer(latest, seen)) {
+ *       show(latest);
+ *   }
+ *
+ * @tparam T Snapshot type (trivially copyable)
+ */
+template<typename T>
+class Mailbox {
+    static_assert(std::is_trivially_copyable<T>::value, "Mailbox payloads are copied bytewise");
+
+public:
+    static constexpr uint8_t MAX_READ_ATTEMPTS = 4;
+
+    Mailbox() = default;
+
+    Mailbox(const Mailbox&) = delete;
+    Mailbox& operator=(const Mailbox&) = delete;
+
+    /**
+     * @brief Replace the snapshot (writer side, wait-free)
+     */
+    void publish(const T& value) {
+        const uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&_value, &value, sizeof(T));
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copy out the current snapshot (reader side)
+     *
+     * @param out Receives the snapshot
+     * @param version Receives its version (0 = never published)
+     * @return false if nothing was published yet or every attempt was torn
+     */
+    bool read(T& out, uint32_t& version) const {
+        for (uint8_t attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+            const uint32_t before = _seq.load(std::memory_order_acquire);
+            if (before & 1) continue;
+            if (before == 0) return false;
+
+            memcpy(&out, &_value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_seq.load(std::memory_order_relaxed) == before) {
+                version = before / 2;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Copy out the snapshot only if it is newer than seen
+     *
+     * @param out Receives the snapshot
+     * @param seen Version last read; updated on success
+     * @return true if a newer snapshot was copied
+     */
+    bool readIfNewer(T& out, uint32_t& seen) const {
+        if (version() == seen) return false;
+
+        uint32_t version = 0;
+        if (!read(out, version) || version == seen) return false;
+        seen = version;
+        return true;
+    }
+
+    /**
+     * @brief Number of completed publishes (approximate while writing)
+     */
+    uint32_t version() const {
+        return _seq.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    std::atomic<uint32_t> _seq{0};
+    T _value;
+};
+
+} // namespace paperhome
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace paperhome {
+
+/**
+ * @brief How pending mutations ended (PendingOverlay)
+ */
+struct PendingStats {
+    uint32_t applied = 0;       ///< Mutations recorded (replacements included)
+    uint32_t confirmed = 0;     ///< Fetched state matched
+    uint32_t superseded = 0;    ///< Fetched state differed and won
+    uint32_t rolledBack = 0;    ///< Request failed
+    uint32_t expired = 0;       ///< Timed out unsettled
+};
+
+/**
+ * @brief Optimistic local state: pending mutations over the last known state
+ *
+ * A service records the value a command will produce before its request
+ * goes out and overlays every pending value on the state it publishes,
+ * so the UI shows the command on its next refresh instead of after the
+ * request and the next poll. Each mutation then ends one of four ways:
+ *
+ * - Rolled back: its request failed (ack() with ok = false)
+ * - Confirmed: a fetch sent after the request completed shows the value
+ * - Superseded: such a fetch shows something else (changed elsewhere, or
+ *   not applied); the fetched state wins
+ * - Expired: no request result or fetch within the timeout
+ *
+ * Fetches sent before the request completed may predate it and never
+ * settle a mutation. A newer mutation for the same key replaces the
+ * pending one (latest wins); results for the replaced one are ignored.
+ *
+ * Fixed capacity, no allocation. Not thread-safe: owned by the I/O task.
+ *
+ * Usage:
+ *   PendingOverlay<RoomMutation, 12> pending;
+ *
+ *   // Command
+ *   uint32_t token = pending.set(roomKey, mutation, millis());
+ *   publish();  // Overlays pending.forEach()
+ *   send(..., [=](bool ok) {
+ *       if (pending.ack(roomKey, token, ok, millis())) publish();
+ *   });
+ *
+ *   // Poll
+ *   uint32_t fetch = pending.beginFetch();
+ *   get(..., [=] {
+ *       pending.reconcile(fetch, [](uint32_t key, const RoomMutation& m) { return shows(key, m); });
+ *       publish();
+ *   });
+ *
+ * @tparam Value Mutation (trivially copyable)
+ * @tparam N Maximum pending mutations (one per key)
+ */
+template<typename Value, size_t N>
+class PendingOverlay {
+public:
+    using Stats = PendingStats;
+
+    PendingOverlay() { clear(); }
+
+    PendingOverlay(const PendingOverlay&) = delete;
+    PendingOverlay& operator=(const PendingOverlay&) = delete;
+
+    /**
+     * @brief Record a mutation, replacing any pending one for key
+     * @return Token for ack(), 0 if full (nothing recorded)
+     */
+    uint32_t set(uint32_t key, const Value& value, uint32_t now) {
+        Entry* entry = find(key);
+        if (!entry) {
+            for (Entry& free : _entries) {
+                if (!free.used) {
+                    entry = &free;
+                    break;
+                }
+            }
+        }
+        if (!entry) {
+            return 0;
+        }
+
+        entry->used = true;
+        entry->key = key;
+        entry->value = value;
+        entry->token = _nextToken++;
+        if (_nextToken == 0) _nextToken = 1;
+        entry->acked = false;
+        entry->touchedAt = now;
+        _stats.applied++;
+        return entry->token;
+    }
+
+    /**
+     * @brief Pending value for key, nullptr if none
+     */
+    const Value* get(uint32_t key) const {
+        const Entry* entry = find(key);
+        return entry ? &entry->value : nullptr;
+    }
+
+    /**
+     * @brief Result of the request that carried token
+     *
+     * Ignored if the mutation was replaced since. On success the mutation
+     * waits for the next fetch; on failure it is removed.
+     *
+     * @return true if the mutation was rolled back (republish the state)
+     */
+    bool ack(uint32_t key, uint32_t token, bool ok, uint32_t now) {
+        Entry* entry = find(key);
+        if (!entry || entry->token != token) {
+            return false;
+        }
+        if (!ok) {
+            entry->used = false;
+            _stats.rolledBack++;
+            return true;
+        }
+        entry->acked = true;
+        entry->ackedFetch = _fetches;
+        entry->touchedAt = now;
+        return false;
+    }
+
+    /**
+     * @brief Drop the mutation for key (e.g. a command cancelled it)
+     */
+    void remove(uint32_t key) {
+        Entry* entry = find(key);
+        if (entry) {
+            entry->used = false;
+        }
+    }
+
+    /**
+     * @brief Number the next authoritative fetch, before sending it
+     */
+    uint32_t beginFetch() { return ++_fetches; }
+
+    /**
+     * @brief Settle mutations against the state of fetch
+     *
+     * @param fetch Number from beginFetch()
+     * @param matches bool(uint32_t key, const Value& value): the fetched
+     *        state already shows value
+     * @return true if any mutation was removed
+     */
+    template<typename Matches>
+    bool reconcile(uint32_t fetch, Matches&& matches) {
+        bool removed = false;
+        for (Entry& entry : _entries) {
+            if (!entry.used || !entry.acked || entry.ackedFetch >= fetch) {
+                continue;
+            }
+            if (matches(entry.key, entry.value)) {
+                _stats.confirmed++;
+            } else {
+                _stats.superseded++;
+            }
+            entry.used = false;
+            removed = true;
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Remove mutations untouched for timeoutMs
+     * @return true if any were removed
+     */
+    bool expire(uint32_t now, uint32_t timeoutMs) {
+        bool removed = false;
+        for (Entry& entry : _entries) {
+            if (entry.used && now - entry.touchedAt >= timeoutMs) {
+                entry.used = false;
+                _stats.expired++;
+                removed = true;
+            }
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Visit pending mutations: apply(uint32_t key, const Value& value)
+     */
+    template<typename Apply>
+    void forEach(Apply&& apply) const {
+        for (const Entry& entry : _entries) {
+            if (entry.used) {
+                apply(entry.key, entry.value);
+            }
+        }
+    }
+
+    void clear() {
+        for (Entry& entry : _entries) {
+            entry.used = false;
+        }
+    }
+
+    size_t size() const {
+        size_t count = 0;
+        for (const Entry& entry : _entries) {
+            count += entry.used ? 1 : 0;
+        }
+        return count;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    const Stats& getStats() const { return _stats; }
+
+private:
+    struct Entry {
+        Value value;
+        uint32_t key;
+        uint32_t token;
+        uint32_t ackedFetch;    // Fetches begun before the ack
+        uint32_t touchedAt;
+        bool used;
+        bool acked;
+    };
+
+    Entry _entries[N];
+    uint32_t _nextToken = 1;    // 0 is never a token
+    uint32_t _fetches = 0;
+    Stats _stats;
+
+    const Entry* find(uint32_t key) const {
+        for (const Entry& entry : _entries) {
+            if (entry.used && entry.key == key) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    Entry* find(uint32_t key) {
+        return const_cast<Entry*>(static_cast<const PendingOverlay*>(this)->find(key));
+    }
+};
+
+} // namespace paperhome
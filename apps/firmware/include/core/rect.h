@@ -111,27 +111,62 @@ struct Rect {
 /**
  * @brief Accumulator for tracking dirty regions
  *
- * Efficiently tracks the minimal bounding box of all
- * dirty regions submitted to it.
+ * Keeps up to MAX_RECTS disjoint rectangles instead of a single
+ * bounding box. Each added rect is greedily merged with an existing one
+ * only when the merged area costs less than the fixed per-refresh
+ * overhead it saves:
+ *
+ *   cost(r) = overhead + r.area()
+ *
+ * With overhead 0 rects merge only when the union adds no area beyond
+ * their overlap. Overlapping rects always merge, so the set never holds
+ * overlapping windows. When full, the pair whose union grows least is
+ * force-merged, together with any rect the union then overlaps.
  */
 class DirtyRectAccumulator {
 public:
-    DirtyRectAccumulator() { reset(); }
+    static constexpr uint8_t MAX_RECTS = 8;
+
+    explicit DirtyRectAccumulator(int32_t overhead = 0)
+        : _overhead(overhead) { reset(); }
 
     void reset() {
-        _minX = INT16_MAX;
-        _minY = INT16_MAX;
-        _maxX = INT16_MIN;
-        _maxY = INT16_MIN;
+        _count = 0;
     }
 
+    void setOverhead(int32_t overhead) { _overhead = overhead; }
+    int32_t getOverhead() const { return _overhead; }
+
     void add(const Rect& rect) {
         if (rect.isEmpty()) return;
 
-        _minX = std::min(_minX, rect.x);
-        _minY = std::min(_minY, rect.y);
-        _maxX = std::max(_maxX, rect.right());
-        _maxY = std::max(_maxY, rect.bottom());
+        Rect incoming = rect;
+
+        // Absorb into / merge with existing rects while it saves cost
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (uint8_t i = 0; i < _count; i++) {
+                if (_rects[i].contains(incoming)) return;
+
+                Rect merged = _rects[i].unionWith(incoming);
+                if (cost(merged) <= cost(_rects[i]) + cost(incoming)) {
+                    incoming = merged;
+                    removeAt(i);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+
+        // Overlapping windows would refresh the overlap twice
+        absorbOverlapping(incoming);
+
+        if (_count == MAX_RECTS) {
+            forceMergeCheapest();
+            absorbOverlapping(incoming);
+        }
+        _rects[_count++] = incoming;
     }
 
     void add(int16_t x, int16_t y, int16_t w, int16_t h) {
@@ -139,14 +174,38 @@ public:
     }
 
     bool isEmpty() const {
-        return _minX > _maxX || _minY > _maxY;
+        return _count == 0;
+    }
+
+    uint8_t count() const { return _count; }
+    const Rect& operator[](uint8_t i) const { return _rects[i]; }
+    const Rect* begin() const { return _rects; }
+    const Rect* end() const { return _rects + _count; }
+
+    /**
+     * @brief Total refresh cost of the current rect set
+     */
+    int32_t totalCost() const {
+        int32_t total = 0;
+        for (uint8_t i = 0; i < _count; i++) total += cost(_rects[i]);
+        return total;
+    }
+
+    /**
+     * @brief Total area of the current rect set
+     */
+    int32_t totalArea() const {
+        int32_t total = 0;
+        for (uint8_t i = 0; i < _count; i++) total += _rects[i].area();
+        return total;
     }
 
     Rect getBounds() const {
-        if (isEmpty()) {
-            return Rect::empty();
+        Rect bounds = Rect::empty();
+        for (uint8_t i = 0; i < _count; i++) {
+            bounds = bounds.unionWith(_rects[i]);
         }
-        return Rect(_minX, _minY, _maxX - _minX, _maxY - _minY);
+        return bounds;
     }
 
     // Clamp result to display bounds
@@ -155,7 +214,54 @@ public:
     }
 
 private:
-    int16_t _minX, _minY, _maxX, _maxY;
+    Rect _rects[MAX_RECTS];
+    uint8_t _count;
+    int32_t _overhead;
+
+    int32_t cost(const Rect& r) const { return _overhead + r.area(); }
+
+    void removeAt(uint8_t i) {
+        _rects[i] = _rects[--_count];
+    }
+
+    void forceMergeCheapest() {
+        uint8_t bestI = 0, bestJ = 1;
+        int32_t bestGrowth = INT32_MAX;
+        for (uint8_t i = 0; i < _count; i++) {
+            for (uint8_t j = i + 1; j < _count; j++) {
+                int32_t growth = _rects[i].unionWith(_rects[j]).area() - _rects[i].area() - _rects[j].area();
+                if (growth < bestGrowth) {
+                    bestGrowth = growth;
+                    bestI = i;
+                    bestJ = j;
+                }
+            }
+        }
+        Rect merged = _rects[bestI].unionWith(_rects[bestJ]);
+        removeAt(bestJ);    // bestJ > bestI: bestI stays in place
+        removeAt(bestI);
+
+        // The union may now cover other kept rects: a refresh must not
+        // get overlapping windows
+        absorbOverlapping(merged);
+        _rects[_count++] = merged;
+    }
+
+    // Merge every kept rect that overlaps r into r (removing it)
+    void absorbOverlapping(Rect& r) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (uint8_t i = 0; i < _count; i++) {
+                if (_rects[i].intersects(r)) {
+                    r = r.unionWith(_rects[i]);
+                    removeAt(i);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
 };
 
 } // namespace paperhome
@@ -1,9 +1,10 @@
 #pragma once
 
-#include <freertos/FreeRTOS.h>
-#include <freertos/queue.h>
 #include <cstring>
 #include "core/config.h"
+#include "core/mailbox.h"
+#include "core/snapshot_store.h"
+#include "core/spsc_ring.h"
 #include "ui/status_bar.h"
 #include "ui/screens/hue_dashboard.h"
 #include "ui/screens/sensor_dashboard.h"
@@ -11,24 +12,9 @@
 #include "ui/screens/settings_info.h"
 #include "hue/hue_types.h"
 #include "tado/tado_types.h"
-#include <vector>
-#include <memory>
 
 namespace paperhome {
 
-/**
- * @brief Types of service data updates
- */
-enum class ServiceDataType : uint8_t {
-    STATUS_UPDATE,      // StatusBarData for status bar
-    HUE_ROOMS,          // std::vector<HueRoom> update
-    HUE_STATE,          // HueState update
-    TADO_ZONES,         // std::vector<TadoZone> update
-    TADO_STATE,         // TadoState update (with auth info if applicable)
-    SENSOR_DATA,        // SensorData update
-    DEVICE_INFO,        // DeviceInfo for settings screen
-};
-
 // =============================================================================
 // Hue Command Queue (UI → I/O)
 // =============================================================================
@@ -79,37 +65,22 @@ struct HueCommand {
 };
 
 /**
- * @brief Thread-safe command queue for UI → I/O communication
+ * @brief Lock-free command queue for UI → I/O communication (SpscRing)
  */
 class HueCommandQueue {
 public:
-    HueCommandQueue() : _queue(nullptr) {}
-
-    ~HueCommandQueue() {
-        if (_queue) {
-            vQueueDelete(_queue);
-        }
-    }
-
-    bool init(size_t size = 8) {
-        _queue = xQueueCreate(size, sizeof(HueCommand));
-        return _queue != nullptr;
-    }
+    bool init() { return true; }
 
     bool send(const HueCommand& cmd) {
-        if (!_queue) return false;
-        return xQueueSend(_queue, &cmd, 0) == pdTRUE;
+        return _ring.push(cmd);
     }
 
     bool receive(HueCommand& cmd) {
-        if (!_queue) return false;
-        return xQueueReceive(_queue, &cmd, 0) == pdTRUE;
+        return _ring.pop(cmd);
     }
 
-    bool isValid() const { return _queue != nullptr; }
-
 private:
-    QueueHandle_t _queue;
+    SpscRing<HueCommand, config::tasks::HUE_CMD_QUEUE_SIZE> _ring;
 };
 
 // =============================================================================
@@ -209,37 +180,22 @@ struct TadoCommand {
 };
 
 /**
- * @brief Thread-safe command queue for Tado UI → I/O communication
+ * @brief Lock-free command queue for Tado UI → I/O communication (SpscRing)
  */
 class TadoCommandQueue {
 public:
-    TadoCommandQueue() : _queue(nullptr) {}
-
-    ~TadoCommandQueue() {
-        if (_queue) {
-            vQueueDelete(_queue);
-        }
-    }
-
-    bool init(size_t size = 8) {
-        _queue = xQueueCreate(size, sizeof(TadoCommand));
-        return _queue != nullptr;
-    }
+    bool init() { return true; }
 
     bool send(const TadoCommand& cmd) {
-        if (!_queue) return false;
-        return xQueueSend(_queue, &cmd, 0) == pdTRUE;
+        return _ring.push(cmd);
     }
 
     bool receive(TadoCommand& cmd) {
-        if (!_queue) return false;
-        return xQueueReceive(_queue, &cmd, 0) == pdTRUE;
+        return _ring.pop(cmd);
     }
 
-    bool isValid() const { return _queue != nullptr; }
-
 private:
-    QueueHandle_t _queue;
+    SpscRing<TadoCommand, config::tasks::TADO_CMD_QUEUE_SIZE> _ring;
 };
 
 /**
@@ -342,90 +298,20 @@ struct DeviceInfoData {
 };
 
 /**
- * @brief Service data update message
+ * @brief Lock-free service data channel for Core 0 → Core 1 communication
  *
- * Uses shared_ptr for variable-size data (rooms, zones).
- * StatusBarData and SensorData are copied directly.
- */
-struct ServiceUpdate {
-    ServiceDataType type;
-    uint32_t timestamp;
-
-    // Data payloads (only one is valid based on type)
-    StatusBarData statusData;
-    SensorData sensorData;
-    HueStateData hueStateData;
-    TadoStateData tadoStateData;
-    DeviceInfoData deviceInfoData;
-
-    // For variable-size data, we use indices into a shared buffer
-    // managed by the ServiceDataQueue
-    uint8_t roomCount;
-    uint8_t zoneCount;
-
-    // Factory methods
-    static ServiceUpdate status(const StatusBarData& data) {
-        ServiceUpdate update;
-        update.type = ServiceDataType::STATUS_UPDATE;
-        update.timestamp = millis();
-        update.statusData = data;
-        return update;
-    }
-
-    static ServiceUpdate sensor(const SensorData& data) {
-        ServiceUpdate update;
-        update.type = ServiceDataType::SENSOR_DATA;
-        update.timestamp = millis();
-        update.sensorData = data;
-        return update;
-    }
-
-    static ServiceUpdate hueRooms(uint8_t count) {
-        ServiceUpdate update;
-        update.type = ServiceDataType::HUE_ROOMS;
-        update.timestamp = millis();
-        update.roomCount = count;
-        return update;
-    }
-
-    static ServiceUpdate hueState(const HueStateData& data) {
-        ServiceUpdate update;
-        update.type = ServiceDataType::HUE_STATE;
-        update.timestamp = millis();
-        update.hueStateData = data;
-        return update;
-    }
-
-    static ServiceUpdate tadoZones(uint8_t count) {
-        ServiceUpdate update;
-        update.type = ServiceDataType::TADO_ZONES;
-        update.timestamp = millis();
-        update.zoneCount = count;
-        return update;
-    }
-
-    static ServiceUpdate tadoState(const TadoStateData& data) {
-        ServiceUpdate update;
-        update.type = ServiceDataType::TADO_STATE;
-        update.timestamp = millis();
-        update.tadoStateData = data;
-        return update;
-    }
-
-    static ServiceUpdate deviceInfo(const DeviceInfoData& data) {
-        ServiceUpdate update;
-        update.type = ServiceDataType::DEVICE_INFO;
-        update.timestamp = millis();
-        update.deviceInfoData = data;
-        return update;
-    }
-};
-
-/**
- * @brief Thread-safe service data queue for Core 0 → Core 1 communication
+ * Allows I/O services to hand data to the UI task without blocking; the
+ * UI polls it once per loop.
  *
- * Allows I/O services to send data updates to the UI task without blocking.
- * Uses FreeRTOS queue with shared buffers for variable-size data.
+ * State snapshots (status bar, sensor data, Hue/Tado state, device info)
+ * are "latest wins": each has a Mailbox the I/O core overwrites and the
+ * UI core reads with read*(), which only returns a snapshot newer than
+ * the last one it read. Bursts collapse into one update and never drop.
+ *
+ * Room and zone tables live in SnapshotStores: the I/O core builds the
+ * next table in place (begin*() / commit*()) and the UI gets a pointer
+ * plus a generation, so unchanged tables cost nothing and no vectors or
+ * strings are allocated per update.
  *
  * Usage:
  *   ServiceDataQueue serviceQueue;
@@ -433,104 +319,67 @@ struct ServiceUpdate {
  *
  *   // Core 0 (I/O task):
  *   serviceQueue.sendStatus(statusData);
- *   serviceQueue.sendHueRooms(rooms);
+ *   HueRoomTable& rooms = serviceQueue.beginHueRooms();
+ *   fillRooms(rooms);
+ *   serviceQueue.commitHueRooms();
  *
  *   // Core 1 (UI task):
- *   ServiceUpdate update;
- *   while (serviceQueue.receive(update)) {
- *       switch (update.type) {
- *           case ServiceDataType::STATUS_UPDATE:
- *               statusBar.setData(update.statusData);
- *               break;
- *           // ...
- *       }
+ *   StatusBarData status;
+ *   if (serviceQueue.readStatus(status)) {
+ *       statusBar.setData(status);
  *   }
+ *   auto rooms = serviceQueue.readHueRooms();
+ *   hueDashboard.setRooms(*rooms.table, rooms.generation);
  */
 class ServiceDataQueue {
 public:
-    static constexpr size_t MAX_ROOMS = 12;
-    static constexpr size_t MAX_ZONES = 8;
+    using HueRoomSnapshot = SnapshotStore<HueRoomTable>::Snapshot;
+    using TadoZoneSnapshot = SnapshotStore<TadoZoneTable>::Snapshot;
 
-    ServiceDataQueue() : _queue(nullptr) {}
+    static constexpr size_t MAX_ROOMS = HueRoomTable::MAX_ROOMS;
+    static constexpr size_t MAX_ZONES = TadoZoneTable::MAX_ZONES;
 
-    ~ServiceDataQueue() {
-        if (_queue) {
-            vQueueDelete(_queue);
-        }
-    }
+    ServiceDataQueue() = default;
 
     /**
-     * @brief Initialize the queue
+     * @brief Initialize the channel (statically sized, nothing to allocate)
      */
-    bool init(size_t size = 8) {
-        _queue = xQueueCreate(size, sizeof(ServiceUpdate));
-        return _queue != nullptr;
-    }
+    bool init() { return true; }
 
     // =========================================================================
     // Send methods (Core 0 / I/O task)
     // =========================================================================
 
     /**
-     * @brief Send status bar update
+     * @brief Publish status bar state (replaces any unread snapshot)
      */
-    bool sendStatus(const StatusBarData& data) {
-        if (!_queue) return false;
-        ServiceUpdate update = ServiceUpdate::status(data);
-        return xQueueSend(_queue, &update, 0) == pdTRUE;
+    void sendStatus(const StatusBarData& data) {
+        _statusBox.publish(data);
     }
 
     /**
-     * @brief Send sensor data update
+     * @brief Publish sensor data (replaces any unread snapshot)
      */
-    bool sendSensorData(const SensorData& data) {
-        if (!_queue) return false;
-        ServiceUpdate update = ServiceUpdate::sensor(data);
-        return xQueueSend(_queue, &update, 0) == pdTRUE;
+    void sendSensorData(const SensorData& data) {
+        _sensorBox.publish(data);
     }
 
     /**
-     * @brief Send Hue rooms update
-     *
-     * Copies rooms to internal buffer and sends notification.
+     * @brief Table to build the next Hue rooms update in (then commitHueRooms())
      */
-    bool sendHueRooms(const std::vector<HueRoom>& rooms) {
-        if (!_queue) return false;
-
-        // Copy to shared buffer (protected by mutex would be ideal, but
-        // we're single-writer so it's safe)
-        size_t count = std::min(rooms.size(), MAX_ROOMS);
-        for (size_t i = 0; i < count; i++) {
-            _roomBuffer[i] = rooms[i];
-        }
-        _roomCount = count;
-
-        ServiceUpdate update = ServiceUpdate::hueRooms(count);
-        return xQueueSend(_queue, &update, 0) == pdTRUE;
-    }
+    HueRoomTable& beginHueRooms() { return _hueRooms.beginWrite(); }
+    uint32_t commitHueRooms() { return _hueRooms.commit(); }
 
     /**
-     * @brief Send Tado zones update
+     * @brief Table to build the next Tado zones update in (then commitTadoZones())
      */
-    bool sendTadoZones(const std::vector<TadoZone>& zones) {
-        if (!_queue) return false;
-
-        size_t count = std::min(zones.size(), MAX_ZONES);
-        for (size_t i = 0; i < count; i++) {
-            _zoneBuffer[i] = zones[i];
-        }
-        _zoneCount = count;
-
-        ServiceUpdate update = ServiceUpdate::tadoZones(count);
-        return xQueueSend(_queue, &update, 0) == pdTRUE;
-    }
+    TadoZoneTable& beginTadoZones() { return _tadoZones.beginWrite(); }
+    uint32_t commitTadoZones() { return _tadoZones.commit(); }
 
     /**
-     * @brief Send Hue connection state update
+     * @brief Publish Hue connection state (replaces any unread snapshot)
      */
-    bool sendHueState(HueState state, const char* bridgeIP = nullptr, uint8_t roomCount = 0) {
-        if (!_queue) return false;
-
+    void sendHueState(HueState state, const char* bridgeIP = nullptr, uint8_t roomCount = 0) {
         HueStateData data;
         data.state = state;
         data.roomCount = roomCount;
@@ -540,17 +389,13 @@ public:
         } else {
             data.bridgeIP[0] = '\0';
         }
-
-        ServiceUpdate update = ServiceUpdate::hueState(data);
-        return xQueueSend(_queue, &update, 0) == pdTRUE;
+        _hueStateBox.publish(data);
     }
 
     /**
-     * @brief Send Tado connection state update
+     * @brief Publish Tado connection state (replaces any unread snapshot)
      */
-    bool sendTadoState(TadoState state, uint8_t zoneCount = 0, const TadoAuthInfo* authInfo = nullptr) {
-        if (!_queue) return false;
-
+    void sendTadoState(TadoState state, uint8_t zoneCount = 0, const TadoAuthInfo* authInfo = nullptr) {
         TadoStateData data;
         data.state = state;
         data.zoneCount = zoneCount;
@@ -559,18 +404,14 @@ public:
         } else {
             memset(&data.authInfo, 0, sizeof(data.authInfo));
         }
-
-        ServiceUpdate update = ServiceUpdate::tadoState(data);
-        return xQueueSend(_queue, &update, 0) == pdTRUE;
+        _tadoStateBox.publish(data);
     }
 
     /**
-     * @brief Send device info update
+     * @brief Publish device info (replaces any unread snapshot)
      */
-    bool sendDeviceInfo(const DeviceInfoData& data) {
-        if (!_queue) return false;
-        ServiceUpdate update = ServiceUpdate::deviceInfo(data);
-        return xQueueSend(_queue, &update, 0) == pdTRUE;
+    void sendDeviceInfo(const DeviceInfoData& data) {
+        _deviceInfoBox.publish(data);
     }
 
     // =========================================================================
@@ -578,66 +419,41 @@ public:
     // =========================================================================
 
     /**
-     * @brief Receive next update (non-blocking)
+     * @brief Read the newest state snapshot if it changed since the last read
+     * @return true if out was updated
      */
-    bool receive(ServiceUpdate& update) {
-        if (!_queue) return false;
-        return xQueueReceive(_queue, &update, 0) == pdTRUE;
-    }
+    bool readStatus(StatusBarData& out) { return _statusBox.readIfNewer(out, _statusSeen); }
+    bool readSensorData(SensorData& out) { return _sensorBox.readIfNewer(out, _sensorSeen); }
+    bool readHueState(HueStateData& out) { return _hueStateBox.readIfNewer(out, _hueStateSeen); }
+    bool readTadoState(TadoStateData& out) { return _tadoStateBox.readIfNewer(out, _tadoStateSeen); }
+    bool readDeviceInfo(DeviceInfoData& out) { return _deviceInfoBox.readIfNewer(out, _deviceInfoSeen); }
 
     /**
-     * @brief Get Hue rooms from buffer
+     * @brief Newest Hue rooms / Tado zones table (generation 0 = none yet)
      *
-     * Call after receiving HUE_ROOMS update.
+     * The table stays valid until the next call for the same table.
      */
-    std::vector<HueRoom> getHueRooms() const {
-        std::vector<HueRoom> rooms;
-        rooms.reserve(_roomCount);
-        for (size_t i = 0; i < _roomCount; i++) {
-            rooms.push_back(_roomBuffer[i]);
-        }
-        return rooms;
-    }
-
-    /**
-     * @brief Get Tado zones from buffer
-     *
-     * Call after receiving TADO_ZONES update.
-     */
-    std::vector<TadoZone> getTadoZones() const {
-        std::vector<TadoZone> zones;
-        zones.reserve(_zoneCount);
-        for (size_t i = 0; i < _zoneCount; i++) {
-            zones.push_back(_zoneBuffer[i]);
-        }
-        return zones;
-    }
-
-    /**
-     * @brief Check if queue has pending updates
-     */
-    bool hasPending() const {
-        if (!_queue) return false;
-        return uxQueueMessagesWaiting(_queue) > 0;
-    }
-
-    /**
-     * @brief Check if initialized
-     */
-    bool isValid() const {
-        return _queue != nullptr;
-    }
+    HueRoomSnapshot readHueRooms() { return _hueRooms.acquire(); }
+    TadoZoneSnapshot readTadoZones() { return _tadoZones.acquire(); }
 
 private:
-    QueueHandle_t _queue;
-
-    // Shared buffers for variable-size data
-    // Single-writer (Core 0), single-reader (Core 1)
-    HueRoom _roomBuffer[MAX_ROOMS];
-    size_t _roomCount = 0;
-
-    TadoZone _zoneBuffer[MAX_ZONES];
-    size_t _zoneCount = 0;
+    // Tables (built on Core 0, read on Core 1)
+    SnapshotStore<HueRoomTable> _hueRooms;
+    SnapshotStore<TadoZoneTable> _tadoZones;
+
+    // State snapshots (written on Core 0, read on Core 1)
+    Mailbox<StatusBarData> _statusBox;
+    Mailbox<SensorData> _sensorBox;
+    Mailbox<HueStateData> _hueStateBox;
+    Mailbox<TadoStateData> _tadoStateBox;
+    Mailbox<DeviceInfoData> _deviceInfoBox;
+
+    // Versions last read (Core 1 only)
+    uint32_t _statusSeen = 0;
+    uint32_t _sensorSeen = 0;
+    uint32_t _hueStateSeen = 0;
+    uint32_t _tadoStateSeen = 0;
+    uint32_t _deviceInfoSeen = 0;
 
     // Non-copyable
     ServiceDataQueue(const ServiceDataQueue&) = delete;
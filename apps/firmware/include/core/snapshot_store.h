@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace paperhome {
+
+/**
+ * @brief Versioned snapshot store for tables shared between two tasks
+ *
+ * The writer builds the next table in a preallocated buffer and commits
+ * it; the reader gets a pointer to the newest committed table plus its
+ * generation, and can skip work when the generation hasn't changed.
+ * Tables are never copied between tasks and never allocated after
+ * construction, so steady-state updates cause no heap traffic (members
+ * such as std::string are assigned in place and keep their capacity).
+ *
+ * Three buffers rotate (triple buffering): the writer always has a spare
+ * to build into, and the reader's table stays untouched until its next
+ * acquire(), so neither side ever waits on the other.
+ *
+ * Usage:
+ *   SnapshotStore<HueRoomTable> rooms;
+ *
+ *   // Writer (Core 0):
+ *   HueRoomTable& table = rooms.beginWrite();
+ *   fill(table);
+ *   rooms.commit();
+ *
+ *   // Reader (Core 1):
+ *   auto snapshot = rooms.acquire();
+ *   if (snapshot.generation != shownGeneration) {
+ *       show(*snapshot.table);
+ *   }
+ *
+ * @tparam T Table type
+ */
+template<typename T>
+class SnapshotStore {
+public:
+    struct Snapshot {
+        const T* table;         // Valid until the reader's next acquire()
+        uint32_t generation;    // 0 = nothing committed yet
+    };
+
+    SnapshotStore() = default;
+
+    SnapshotStore(const SnapshotStore&) = delete;
+    SnapshotStore& operator=(const SnapshotStore&) = delete;
+
+    // =========================================================================
+    // Writer side
+    // =========================================================================
+
+    /**
+     * @brief Buffer to build the next table in
+     *
+     * Holds whatever table last occupied it (an older generation); the
+     * writer overwrites what it needs.
+     */
+    T& beginWrite() { return _buffers[_back]; }
+
+    /**
+     * @brief Publish the table built since beginWrite()
+     * @return Generation of the published table
+     */
+    uint32_t commit() {
+        const uint32_t generation = ++_writerGeneration;
+        _generations[_back] = generation;
+        const uint8_t previous = _middle.exchange(_back | FRESH, std::memory_order_acq_rel);
+        _back = previous & INDEX_MASK;
+        return generation;
+    }
+
+    // =========================================================================
+    // Reader side
+    // =========================================================================
+
+    /**
+     * @brief Take the newest committed table
+     *
+     * Releases the table returned by the previous call.
+     */
+    Snapshot acquire() {
+        if (_middle.load(std::memory_order_relaxed) & FRESH) {
+            const uint8_t latest = _middle.exchange(_front, std::memory_order_acq_rel);
+            _front = latest & INDEX_MASK;
+        }
+        return Snapshot{&_buffers[_front], _generations[_front]};
+    }
+
+    /**
+     * @brief Whether a table newer than the reader's is waiting
+     */
+    bool hasNewer() const {
+        return (_middle.load(std::memory_order_relaxed) & FRESH) != 0;
+    }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x03;
+    static constexpr uint8_t FRESH = 0x04;
+
+    T _buffers[3];
+    uint32_t _generations[3] = {0, 0, 0};
+
+    uint8_t _back = 0;                  // Writer only
+    std::atomic<uint8_t> _middle{1};    // Exchanged by both (index | FRESH)
+    uint8_t _front = 2;                 // Reader only
+    uint32_t _writerGeneration = 0;     // Writer only
+};
+
+} // namespace paperhome
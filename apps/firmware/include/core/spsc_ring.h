@@ -0,0 +1,220 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace paperhome {
+
+/**
+ * @brief Cache line size used to keep producer and consumer state apart
+ *
+ * ESP32-S3 data cache lines are 32 or 64 bytes (sdkconfig); 64 covers
+ * both and matches typical hosts.
+ */
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * @brief Lock-free single-producer/single-consumer ring
+ *
+ * For one-way channels between exactly one producer task and one consumer
+ * task (e.g. I/O core → UI core). No kernel calls and no critical
+ * sections: send and receive are a slot copy plus one atomic store, so
+ * the producer can also be an ISR.
+ *
+ * - head is written only by the producer, tail only by the consumer; each
+ *   sits on its own cache line next to that side's cached copy of the
+ *   other index, so the hot path rarely touches the other core's line
+ * - emplace()/emplaceWith() construct the item directly in its slot
+ * - consume() processes every queued item in place and publishes the
+ *   freed slots once (batch dequeue)
+ *
+ * Usage:
+ *   SpscRing<InputAction, 16> ring;
+ *
+ *   // Producer (Core 0):
+ *   ring.emplace(InputAction::button(InputEvent::BUTTON_A));
+ *
+ *   // Consumer (Core 1):
+ *   ring.consume([](InputAction& action) { handle(action); });
+ *
+ * @tparam T Item type
+ * @tparam N Capacity (power of two)
+ */
+template<typename T, size_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() = default;
+
+    ~SpscRing() {
+        clear();
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // =========================================================================
+    // Producer side
+    // =========================================================================
+
+    /**
+     * @brief Construct an item in the next free slot
+     * @return false if the ring is full (nothing constructed)
+     */
+    template<typename... Args>
+    bool emplace(Args&&... args) {
+        const uint32_t head = _head.load(std::memory_order_relaxed);
+        if (!hasSpace(head)) return false;
+
+        ::new (slot(head)) T(std::forward<Args>(args)...);
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Default-construct an item in the next free slot, then fill it
+     *
+     * For large items built field by field: avoids building a temporary
+     * and copying it in. Members without initializers are left as they
+     * are, so fill must set everything the consumer reads.
+     *
+     * @param fill Called as fill(T&) before the item is published
+     * @return false if the ring is full (fill not called)
+     */
+    template<typename Fill>
+    bool emplaceWith(Fill&& fill) {
+        const uint32_t head = _head.load(std::memory_order_relaxed);
+        if (!hasSpace(head)) return false;
+
+        T* item = ::new (slot(head)) T;
+        fill(*item);
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool push(const T& item) { return emplace(item); }
+    bool push(T&& item) { return emplace(std::move(item)); }
+
+    // =========================================================================
+    // Consumer side
+    // =========================================================================
+
+    /**
+     * @brief Move the oldest item out
+     * @return false if the ring is empty
+     */
+    bool pop(T& out) {
+        const uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (!hasItems(tail)) return false;
+
+        T* item = slot(tail);
+        out = std::move(*item);
+        item->~T();
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Oldest item without removing it, or nullptr if empty
+     */
+    T* front() {
+        const uint32_t tail = _tail.load(std::memory_order_relaxed);
+        return hasItems(tail) ? slot(tail) : nullptr;
+    }
+
+    /**
+     * @brief Move up to max items out
+     * @return Number of items dequeued
+     */
+    size_t popBatch(T* out, size_t max) {
+        size_t count = 0;
+        consume([&](T& item) { out[count++] = std::move(item); }, max);
+        return count;
+    }
+
+    /**
+     * @brief Process queued items in place, oldest first
+     *
+     * Slots are released together after the last item, so one atomic
+     * store covers the whole batch. Items the producer adds meanwhile are
+     * left for the next call.
+     *
+     * @param fn Called as fn(T&) for each item
+     * @param max Maximum items to process
+     * @return Number of items processed
+     */
+    template<typename Fn>
+    size_t consume(Fn&& fn, size_t max = N) {
+        const uint32_t tail = _tail.load(std::memory_order_relaxed);
+        const uint32_t head = _head.load(std::memory_order_acquire);
+        _cachedHead = head;
+
+        size_t count = head - tail;
+        if (count > max) count = max;
+        for (size_t i = 0; i < count; i++) {
+            T* item = slot(tail + i);
+            fn(*item);
+            item->~T();
+        }
+        if (count) _tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Drop all queued items (consumer side)
+     */
+    void clear() {
+        consume([](T&) {});
+    }
+
+    // =========================================================================
+    // State (approximate while the other side is active)
+    // =========================================================================
+
+    size_t count() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    bool isEmpty() const { return count() == 0; }
+    bool isFull() const { return count() >= N; }
+    size_t freeSpaces() const { return N - count(); }
+    static constexpr size_t capacity() { return N; }
+
+private:
+    static constexpr uint32_t MASK = N - 1;
+
+    using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    // Producer line: head + producer's view of tail
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> _head{0};
+    uint32_t _cachedTail = 0;
+
+    // Consumer line: tail + consumer's view of head
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> _tail{0};
+    uint32_t _cachedHead = 0;
+
+    alignas(CACHE_LINE_SIZE) Storage _slots[N];
+
+    T* slot(uint32_t index) {
+        return std::launder(reinterpret_cast<T*>(&_slots[index & MASK]));
+    }
+
+    bool hasSpace(uint32_t head) {
+        if (head - _cachedTail < N) return true;
+        _cachedTail = _tail.load(std::memory_order_acquire);
+        return head - _cachedTail < N;
+    }
+
+    bool hasItems(uint32_t tail) {
+        if (_cachedHead != tail) return true;
+        _cachedHead = _head.load(std::memory_order_acquire);
+        return _cachedHead != tail;
+    }
+};
+
+} // namespace paperhome
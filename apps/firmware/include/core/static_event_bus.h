@@ -0,0 +1,224 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "core/spsc_ring.h"
+
+namespace paperhome {
+
+/**
+ * @brief List of event types for a StaticEventBus
+ */
+template<typename... Events>
+struct EventList {};
+
+/**
+ * @brief Zero-allocation event bus with static dispatch tables
+ *
+ * Counterpart to EventBus for hot or cross-core paths:
+ * - Type IDs are each event's index in the EventList (compile time)
+ * - Each type has MaxHandlers fixed slots holding a plain function or
+ *   member-function thunk; no std::function, no heap, no mutex
+ * - publish() delivers inline on the calling task
+ * - post() copies the event into an SpscRing; dispatch() delivers queued
+ *   events later on the consuming task, so a publisher on Core 0 never
+ *   runs UI handlers itself
+ *
+ * Threading: subscribe()/unsubscribe() during setup or from the task
+ * that delivers (publish() caller / dispatch() caller). post() has one
+ * producer task per bus.
+ *
+ * Usage:
+ *   struct RoomsChanged { uint8_t count; };
+ *   struct SensorTick { uint16_t co2; };
+ *   using UiBus = StaticEventBus<EventList<RoomsChanged, SensorTick>>;
+ *   UiBus uiBus;
+ *
+ *   uiBus.subscribe<SensorTick, SensorDashboard, &SensorDashboard::onTick>(&dashboard);
+ *
+ *   // Core 0 (I/O task):
+ *   uiBus.post(SensorTick{650});
+ *
+ *   // Core 1 (UI task):
+ *   uiBus.dispatch();
+ *
+ * @tparam Events EventList of event types (trivially copyable to post)
+ * @tparam MaxHandlers Handler slots per event type
+ * @tparam QueueDepth Deferred queue capacity (power of two)
+ */
+template<typename Events, size_t MaxHandlers = 8, size_t QueueDepth = 16>
+class StaticEventBus;
+
+template<typename... Events, size_t MaxHandlers, size_t QueueDepth>
+class StaticEventBus<EventList<Events...>, MaxHandlers, QueueDepth> {
+    static_assert(sizeof...(Events) > 0 && sizeof...(Events) < 256, "1-255 event types");
+    static_assert(MaxHandlers > 0 && MaxHandlers < 256, "1-255 handlers per type");
+
+public:
+    using SubscriptionId = uint32_t;
+    static constexpr SubscriptionId INVALID_SUBSCRIPTION = 0;
+    static constexpr size_t TYPE_COUNT = sizeof...(Events);
+
+    StaticEventBus() = default;
+
+    StaticEventBus(const StaticEventBus&) = delete;
+    StaticEventBus& operator=(const StaticEventBus&) = delete;
+
+    /**
+     * @brief Compile-time ID of an event type (its index in the EventList)
+     */
+    template<typename E>
+    static constexpr uint8_t typeId() {
+        static_assert(indexOf<E, Events...>() < TYPE_COUNT, "Event type not in this bus");
+        return static_cast<uint8_t>(indexOf<E, Events...>());
+    }
+
+    // =========================================================================
+    // Subscription
+    // =========================================================================
+
+    /**
+     * @brief Subscribe a function taking the event and a context pointer
+     * @return Subscription ID, or INVALID_SUBSCRIPTION if the type's slots are full
+     */
+    template<typename E>
+    SubscriptionId subscribe(void (*fn)(const E&, void*), void* context = nullptr) {
+        Slot slot;
+        slot.invoke = &invokeFunction<E>;
+        slot.fn = reinterpret_cast<void (*)()>(fn);
+        slot.context = context;
+        return install(typeId<E>(), slot);
+    }
+
+    /**
+     * @brief Subscribe a member function of obj
+     * @return Subscription ID, or INVALID_SUBSCRIPTION if the type's slots are full
+     */
+    template<typename E, typename T, void (T::*Method)(const E&)>
+    SubscriptionId subscribe(T* obj) {
+        Slot slot;
+        slot.invoke = &invokeMember<E, T, Method>;
+        slot.context = obj;
+        return install(typeId<E>(), slot);
+    }
+
+    /**
+     * @brief Remove a subscription (its slot becomes reusable)
+     */
+    void unsubscribe(SubscriptionId id) {
+        if (id == INVALID_SUBSCRIPTION) return;
+        const uint8_t type = static_cast<uint8_t>((id - 1) >> 8);
+        const uint8_t index = static_cast<uint8_t>((id - 1) & 0xFF);
+        if (type >= TYPE_COUNT || index >= MaxHandlers) return;
+        _slots[type][index] = Slot();
+    }
+
+    template<typename E>
+    size_t getSubscriberCount() const {
+        size_t count = 0;
+        const uint8_t type = typeId<E>();
+        for (uint8_t i = 0; i < _used[type]; i++) {
+            if (_slots[type][i].invoke) count++;
+        }
+        return count;
+    }
+
+    // =========================================================================
+    // Delivery
+    // =========================================================================
+
+    /**
+     * @brief Deliver an event to its subscribers now, on the calling task
+     */
+    template<typename E>
+    void publish(const E& event) const {
+        deliver(typeId<E>(), &event);
+    }
+
+    /**
+     * @brief Queue an event for dispatch() (producer task, non-blocking)
+     * @return false if the queue is full
+     */
+    template<typename E>
+    bool post(const E& event) {
+        static_assert(std::is_trivially_copyable<E>::value, "Posted events are copied bytewise");
+        return _queue.emplaceWith([&](Envelope& envelope) {
+            envelope.type = typeId<E>();
+            memcpy(envelope.data, &event, sizeof(E));
+        });
+    }
+
+    /**
+     * @brief Deliver queued events, oldest first (consumer task)
+     * @return Number of events delivered
+     */
+    size_t dispatch() {
+        return _queue.consume([this](Envelope& envelope) {
+            deliver(envelope.type, envelope.data);
+        });
+    }
+
+    bool hasPending() const { return !_queue.isEmpty(); }
+
+private:
+    struct Slot {
+        void (*invoke)(const Slot&, const void* event) = nullptr;
+        void (*fn)() = nullptr;
+        void* context = nullptr;
+    };
+
+    static constexpr size_t MAX_EVENT_SIZE = std::max({sizeof(Events)...});
+    static constexpr size_t MAX_EVENT_ALIGN = std::max({alignof(Events)...});
+
+    struct Envelope {
+        uint8_t type;
+        alignas(MAX_EVENT_ALIGN) uint8_t data[MAX_EVENT_SIZE];
+    };
+
+    Slot _slots[TYPE_COUNT][MaxHandlers];
+    uint8_t _used[TYPE_COUNT] = {};    // Slots ever used per type (scan bound)
+    SpscRing<Envelope, QueueDepth> _queue;
+
+    template<typename E, typename First, typename... Rest>
+    static constexpr size_t indexOf() {
+        if constexpr (std::is_same<E, First>::value) {
+            return 0;
+        } else if constexpr (sizeof...(Rest) == 0) {
+            return 1;   // Not found: past the end
+        } else {
+            return 1 + indexOf<E, Rest...>();
+        }
+    }
+
+    template<typename E>
+    static void invokeFunction(const Slot& slot, const void* event) {
+        reinterpret_cast<void (*)(const E&, void*)>(slot.fn)(*static_cast<const E*>(event), slot.context);
+    }
+
+    template<typename E, typename T, void (T::*Method)(const E&)>
+    static void invokeMember(const Slot& slot, const void* event) {
+        (static_cast<T*>(slot.context)->*Method)(*static_cast<const E*>(event));
+    }
+
+    SubscriptionId install(uint8_t type, const Slot& slot) {
+        for (uint8_t i = 0; i < MaxHandlers; i++) {
+            if (_slots[type][i].invoke) continue;
+            _slots[type][i] = slot;
+            if (i >= _used[type]) _used[type] = i + 1;
+            return (static_cast<SubscriptionId>(type) << 8 | i) + 1;
+        }
+        return INVALID_SUBSCRIPTION;
+    }
+
+    void deliver(uint8_t type, const void* event) const {
+        const Slot* slots = _slots[type];
+        for (uint8_t i = 0; i < _used[type]; i++) {
+            if (slots[i].invoke) slots[i].invoke(slots[i], event);
+        }
+    }
+};
+
+} // namespace paperhome
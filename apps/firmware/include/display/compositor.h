@@ -1,93 +1,11 @@
 #pragma once
 
 #include "display/display_driver.h"
+#include "display/display_list.h"
 #include "core/rect.h"
 
 namespace paperhome {
 
-// =============================================================================
-// Legacy DrawCommand support (for screen compatibility)
-// =============================================================================
-
-/**
- * @brief Draw command types (legacy compatibility)
- */
-enum class DrawCommandType : uint8_t {
-    FILL_RECT,
-    DRAW_RECT,
-    FILL_ROUND_RECT,
-    DRAW_ROUND_RECT,
-    DRAW_LINE,
-    DRAW_HLINE,
-    DRAW_VLINE,
-    FILL_CIRCLE,
-    DRAW_CIRCLE,
-    DRAW_TEXT,
-    FILL_SCREEN,
-    INVERT_RECT
-};
-
-/**
- * @brief Draw command structure (legacy compatibility)
- *
- * Kept for backward compatibility with existing screens.
- * New code should use Compositor's direct drawing methods.
- */
-struct DrawCommand {
-    DrawCommandType type;
-    int16_t x, y;
-    int16_t w, h;
-    int16_t extra1;     // radius for circles/round rects
-    int16_t extra2;     // second coordinate for lines
-    bool black;
-    const void* data;   // text pointer
-
-    // Factory methods
-    static DrawCommand fillRect(int16_t x, int16_t y, int16_t w, int16_t h, bool black) {
-        return {DrawCommandType::FILL_RECT, x, y, w, h, 0, 0, black, nullptr};
-    }
-
-    static DrawCommand drawRect(int16_t x, int16_t y, int16_t w, int16_t h, bool black) {
-        return {DrawCommandType::DRAW_RECT, x, y, w, h, 0, 0, black, nullptr};
-    }
-
-    static DrawCommand fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool black) {
-        return {DrawCommandType::FILL_ROUND_RECT, x, y, w, h, r, 0, black, nullptr};
-    }
-
-    static DrawCommand drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool black) {
-        return {DrawCommandType::DRAW_ROUND_RECT, x, y, w, h, r, 0, black, nullptr};
-    }
-
-    static DrawCommand drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool black) {
-        return {DrawCommandType::DRAW_LINE, x0, y0, 0, 0, x1, y1, black, nullptr};
-    }
-
-    static DrawCommand drawHLine(int16_t x, int16_t y, int16_t w, bool black) {
-        return {DrawCommandType::DRAW_HLINE, x, y, w, 0, 0, 0, black, nullptr};
-    }
-
-    static DrawCommand drawVLine(int16_t x, int16_t y, int16_t h, bool black) {
-        return {DrawCommandType::DRAW_VLINE, x, y, 0, h, 0, 0, black, nullptr};
-    }
-
-    static DrawCommand fillCircle(int16_t x, int16_t y, int16_t r, bool black) {
-        return {DrawCommandType::FILL_CIRCLE, x, y, 0, 0, r, 0, black, nullptr};
-    }
-
-    static DrawCommand drawCircle(int16_t x, int16_t y, int16_t r, bool black) {
-        return {DrawCommandType::DRAW_CIRCLE, x, y, 0, 0, r, 0, black, nullptr};
-    }
-
-    static DrawCommand fillScreen(bool white) {
-        return {DrawCommandType::FILL_SCREEN, 0, 0, 0, 0, 0, 0, !white, nullptr};
-    }
-
-    static DrawCommand invertRect(int16_t x, int16_t y, int16_t w, int16_t h) {
-        return {DrawCommandType::INVERT_RECT, x, y, w, h, 0, 0, false, nullptr};
-    }
-};
-
 /**
  * @brief Simplified compositor for e-paper rendering
  *
@@ -95,6 +13,7 @@ struct DrawCommand {
  * - Tracks dirty regions during drawing
  * - Provides convenient drawing helpers
  * - Handles selection highlight via XOR inversion
+ * - Optionally records a frame as a display list (FrameMode::RECORDED)
  *
  * Usage:
  *   // Draw content
@@ -107,9 +26,22 @@ struct DrawCommand {
  *   compositor.endFrame();  // partial refresh of dirty region
  *   // OR
  *   compositor.endFrameFull();  // full hardware refresh
+ *
+ * In a recorded frame, drawing calls only append to a DisplayList. At
+ * endFrame() the list is diffed against the previous recorded frame and
+ * only commands touching the changed regions are rasterized, band by band
+ * under a clip. Screens that redraw everything each frame then cost work
+ * proportional to what changed. A recording must describe the whole
+ * screen (start with fillScreen()); frames drawn immediately in between
+ * make the next recording rasterize in full.
  */
 class Compositor {
 public:
+    enum class FrameMode : uint8_t {
+        IMMEDIATE,  // Draw calls hit the framebuffer directly
+        RECORDED    // Draw calls are recorded and rasterized at endFrame()
+    };
+
     explicit Compositor(DisplayDriver& display);
 
     // =========================================================================
@@ -119,17 +51,22 @@ public:
     /**
      * @brief Begin a new frame
      *
-     * Resets dirty tracking. Call before drawing.
+     * Resets dirty tracking. Call before drawing. Falls back to immediate
+     * mode if the display list arenas cannot be allocated.
      */
-    void beginFrame();
+    void beginFrame(FrameMode mode = FrameMode::IMMEDIATE);
+
+    bool isRecording() const { return _recording; }
 
     /**
      * @brief End frame with partial refresh
      *
-     * Refreshes only the dirty region accumulated during drawing.
+     * Diffs each dirty rect accumulated during drawing against the last
+     * refreshed frame, merges the changes into the cheapest set of
+     * windows (see DirtyRectAccumulator) and partial-refreshes each one.
      * Fast (~200-500ms) but may accumulate ghosting.
      *
-     * @return true if display was refreshed
+     * @return true if display was refreshed (false if nothing changed)
      */
     bool endFrame();
 
@@ -145,14 +82,14 @@ public:
     bool endFrameFull();
 
     // =========================================================================
-    // Legacy API (for screen compatibility)
+    // Command API
     // =========================================================================
 
     /**
-     * @brief Submit a draw command (legacy compatibility)
+     * @brief Submit a draw command
      *
-     * Executes the command immediately. Kept for backward compatibility
-     * with existing screens. New code should use direct methods.
+     * Recorded in a recorded frame, executed immediately otherwise. The
+     * drawing methods below all go through here.
      */
     void submit(const DrawCommand& cmd);
 
@@ -219,8 +156,8 @@ public:
     /**
      * @brief Update selection highlight via XOR inversion
      *
-     * Un-inverts old selection, inverts new selection.
-     * Fast operation in GxEPD2 buffer.
+     * Un-inverts old selection, inverts new selection with word-wide XOR
+     * in the framebuffer. Both rects are marked dirty for endFrame().
      *
      * @param oldRect Previous selection (will be un-inverted)
      * @param newRect New selection (will be inverted)
@@ -279,16 +216,69 @@ public:
     uint32_t getFrameCount() const { return _frameCount; }
     uint32_t getLastFrameTimeMs() const { return _lastFrameTime; }
 
+    /**
+     * @brief Bounding box of the regions refreshed by the last frame
+     */
+    Rect getLastRefreshBounds() const { return _lastRefreshBounds; }
+
+    /**
+     * @brief Pixels refreshed by the last frame (sum over all windows)
+     */
+    uint32_t getLastFramePixels() const { return _lastFramePixels; }
+
+    /**
+     * @brief Refresh windows issued by the last frame
+     */
+    uint8_t getLastFrameWindows() const { return _lastFrameWindows; }
+
+    uint64_t getTotalPixelsRefreshed() const { return _totalPixelsRefreshed; }
+
+    /**
+     * @brief Commands recorded by the last recorded frame
+     */
+    uint16_t getLastRecordedCommands() const { return _lastRecordedCommands; }
+
+    /**
+     * @brief Command executions needed to rasterize the last recorded frame
+     */
+    uint32_t getLastReplayedCommands() const { return _lastReplayedCommands; }
+
+    /**
+     * @brief Recording of the last recorded frame (empty if none)
+     */
+    const DisplayList& getLastRecording() const { return _lists[_current ^ 1]; }
+
+    uint32_t getAveragePixelsPerFrame() const {
+        return _frameCount ? static_cast<uint32_t>(_totalPixelsRefreshed / _frameCount) : 0;
+    }
+
 private:
     DisplayDriver& _display;
     DirtyRectAccumulator _dirtyAccum;
 
     uint32_t _frameCount;
     uint32_t _lastFrameTime;
+    Rect _lastRefreshBounds;
+    uint32_t _lastFramePixels;
+    uint8_t _lastFrameWindows;
+    uint64_t _totalPixelsRefreshed;
     bool _inFrame;
 
+    // Recorded frames: current list and the previous frame's, swapped
+    DisplayList _lists[2];
+    uint8_t _current = 0;
+    bool _recording = false;
+    bool _previousValid = false;    // Framebuffer matches _lists[_current ^ 1]
+    uint16_t _lastRecordedCommands = 0;
+    uint32_t _lastReplayedCommands = 0;
+
     // Add dirty region for a drawing operation
     void addDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+    void addDirty(const Rect& rect) { addDirty(rect.x, rect.y, rect.width, rect.height); }
+
+    void record(const DrawCommand& cmd);
+    void finishFrame();
+    void abandonRecording();
 };
 
 } // namespace paperhome
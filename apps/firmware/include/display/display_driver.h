@@ -3,34 +3,47 @@
 #define ENABLE_GxEPD2_GFX 0
 
 #include <GxEPD2_BW.h>
-#include <Fonts/FreeMonoBold24pt7b.h>
-#include <Fonts/FreeMonoBold18pt7b.h>
-#include <Fonts/FreeMonoBold12pt7b.h>
-#include <Fonts/FreeMonoBold9pt7b.h>
-#include <Fonts/FreeMono9pt7b.h>
-#include <Fonts/FreeSansBold18pt7b.h>
-#include <Fonts/FreeSansBold12pt7b.h>
-#include <Fonts/FreeSansBold9pt7b.h>
-#include <Fonts/FreeSans12pt7b.h>
-#include <Fonts/FreeSans9pt7b.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <atomic>
 
 #include "core/config.h"
 #include "core/rect.h"
+#include "display/font_cache.h"
+#include "display/fonts.h"
+#include "display/frame_diff.h"
+#include "display/refresh_scheduler.h"
+#include "display/framebuffer.h"
 
 namespace paperhome {
 
-// Display type for GDEQ0426T82 (800x480)
-using GxEPD2Display = GxEPD2_BW<GxEPD2_426_GDEQ0426T82, GxEPD2_426_GDEQ0426T82::HEIGHT>;
+// Panel driver for GDEQ0426T82 (800x480, SSD1677)
+using EpdPanel = GxEPD2_426_GDEQ0426T82;
+
+static_assert(EpdPanel::WIDTH == Framebuffer::NATIVE_WIDTH &&
+              EpdPanel::HEIGHT == Framebuffer::NATIVE_HEIGHT,
+              "Framebuffer must match the panel's native resolution");
 
 /**
- * @brief Simplified E-ink display driver using native GxEPD2
+ * @brief E-ink display driver with its own framebuffer
  *
- * Clean wrapper around GxEPD2 with simple refresh API:
+ * Draws into the back buffer of a double-buffered 1-bpp Framebuffer
+ * (PSRAM) and streams the front buffer to the GxEPD2 panel driver directly:
  * - fullRefresh() for screen changes (~2s, guaranteed clean)
  * - partialRefresh(rect) for selection changes (~200-500ms)
- * - invertRect(rect) for XOR selection highlight
+ * - Refreshes are asynchronous: a panel task does the SPI transfer and
+ *   sleeps until the BUSY pin's falling-edge interrupt, while the UI task
+ *   keeps handling input and drawing. Requests made while the panel is
+ *   busy coalesce and are issued by service() once it is idle, which
+ *   flips the buffers (pointer swap) and re-syncs only the stale windows
+ * - diffFrame() to find what changed since the last refresh (back vs front)
+ * - Ghosting is tracked per tile (RefreshScheduler); once input has been
+ *   idle for a while, service() cleans only the over-budget regions
+ * - invertRect(rect) for true XOR selection highlight (word-wide)
  *
- * No custom framebuffer or diff engine - uses GxEPD2's native buffer.
+ * Text in GFX fonts is blitted from pre-rotated glyph atlases (FontCache);
+ * the drawText* methods return the exact inked rect for dirty tracking.
  */
 class DisplayDriver {
 public:
@@ -67,6 +80,8 @@ public:
      * Use for:
      * - Screen changes (LB/RB, Menu, B, Xbox)
      * - Anti-ghosting (View button)
+     *
+     * Returns once the frame is captured; pending partials are dropped.
      */
     void fullRefresh();
 
@@ -77,27 +92,84 @@ public:
      * - Selection changes (D-pad navigation)
      * - Small content updates
      *
+     * Returns once the region is captured (or queued, if the panel is
+     * busy; queued regions merge into the next refresh).
+     *
      * @param rect Region to refresh
      */
     void partialRefresh(const Rect& rect);
 
+    /**
+     * @brief Partial refresh of several regions drawn in the same frame
+     *
+     * The back buffer is flipped once, after all regions are queued;
+     * everything drawn since the last refresh must lie inside them.
+     */
+    void partialRefresh(const Rect* rects, uint8_t count);
+
+    /**
+     * @brief Issue coalesced refreshes if the panel has become idle
+     *
+     * With nothing queued, issues any ghosting clean-up that is due.
+     * Call from the UI loop.
+     */
+    void service();
+
+    /**
+     * @brief Record user input (postpones ghosting clean-up)
+     */
+    void noteInput() { _scheduler.noteInput(millis()); }
+
+    /**
+     * @brief Check if the panel task is transferring or waiting on BUSY
+     */
+    bool isRefreshing() const { return _refreshing.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Check if refreshes are queued behind the current one
+     */
+    bool hasPendingRefresh() const { return _pendingFull || !_pending.isEmpty(); }
+
+    /**
+     * @brief Issue pending refreshes and wait until the panel is idle
+     * @return false on timeout
+     */
+    bool waitIdle(uint32_t timeoutMs = 10000);
+
+    /**
+     * @brief Enable/disable the panel task (disabled: refreshes block)
+     */
+    void setAsyncRefresh(bool enabled);
+    bool isAsyncRefresh() const { return _async; }
+
     /**
      * @brief XOR invert pixels in a rectangle (for selection highlight)
      *
-     * Toggles black/white pixels in the region.
-     * Call partialRefresh() after to make visible.
+     * Toggles black/white pixels in the region; inverting the same rect
+     * again restores it. Call partialRefresh() after to make visible.
      *
      * @param rect Region to invert
      */
     void invertRect(const Rect& rect);
 
+    /**
+     * @brief Find regions where the framebuffer differs from the panel
+     *
+     * Diffs the back buffer against the front buffer (see FrameDiff) and adds
+     * byte-aligned rects ready for partialRefresh() to out.
+     *
+     * @param search Region to scan (e.g. one of the compositor's dirty rects)
+     * @param out Receives changed rects (logical coordinates)
+     */
+    void diffFrame(const Rect& search, DirtyRectAccumulator& out);
+
     /**
      * @brief Clear entire screen to white
      */
     void clearScreen();
 
     // =========================================================================
-    // Drawing Primitives (direct GxEPD2 pass-through)
+    // Drawing Primitives (framebuffer pass-through)
     // =========================================================================
 
     void fillScreen(bool white = true);
@@ -114,7 +186,7 @@ public:
     void fillCircle(int16_t x, int16_t y, int16_t r, bool black = true);
 
     // =========================================================================
-    // Text Rendering (direct GxEPD2)
+    // Text Rendering
     // =========================================================================
 
     void setFont(const GFXfont* font);
@@ -122,13 +194,39 @@ public:
     void setCursor(int16_t x, int16_t y);
     void print(const char* text);
     void println(const char* text);
-    void drawText(const char* text, int16_t x, int16_t y);
-    void drawTextCentered(const char* text, int16_t x, int16_t y, int16_t w);
-    void drawTextRight(const char* text, int16_t x, int16_t y, int16_t w);
+
+    /**
+     * @brief Draw a single line of text with its baseline at y
+     * @return Exact bounds of the inked pixels (empty if nothing drawn)
+     */
+    Rect drawText(const char* text, int16_t x, int16_t y);
+
+    /**
+     * @brief Draw text centered horizontally within [x, x + w)
+     * @return Exact bounds of the inked pixels
+     */
+    Rect drawTextCentered(const char* text, int16_t x, int16_t y, int16_t w);
+
+    /**
+     * @brief Draw text right-aligned to x + w
+     * @return Exact bounds of the inked pixels
+     */
+    Rect drawTextRight(const char* text, int16_t x, int16_t y, int16_t w);
+
     void getTextBounds(const char* text, int16_t x, int16_t y,
                        int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
     uint16_t getTextWidth(const char* text);
 
+    /**
+     * @brief Exact ink bounds of text in the current font (cached)
+     */
+    TextBounds measureText(const char* text);
+
+    /**
+     * @brief Glyph atlases and bounds cache (for statistics)
+     */
+    const FontCache& fontCache() const { return _fonts; }
+
     // =========================================================================
     // Bitmap Rendering
     // =========================================================================
@@ -141,9 +239,14 @@ public:
     // =========================================================================
 
     /**
-     * @brief Get underlying GxEPD2 display (for advanced operations)
+     * @brief Get the framebuffer (for advanced operations)
+     */
+    Framebuffer& framebuffer() { return _framebuffer; }
+
+    /**
+     * @brief Get the underlying GxEPD2 panel driver
      */
-    GxEPD2Display& raw() { return _display; }
+    EpdPanel& panel() { return _panel; }
 
     // =========================================================================
     // Statistics
@@ -152,12 +255,61 @@ public:
     uint32_t getRefreshCount() const { return _refreshCount; }
     uint32_t getLastRefreshTimeMs() const { return _lastRefreshTime; }
 
+    /**
+     * @brief Refresh requests merged into a later refresh (panel was busy)
+     */
+    uint32_t getCoalescedCount() const { return _coalescedCount; }
+
+    /**
+     * @brief Ghosting clean-ups issued while idle (regional or full)
+     */
+    uint32_t getCleanupCount() const { return _cleanupCount; }
+
+    const RefreshScheduler& refreshScheduler() const { return _scheduler; }
+
 private:
-    GxEPD2Display _display;
+    EpdPanel _panel;
+    Framebuffer _framebuffer;
+    FrameDiff _diff;
+    RefreshScheduler _scheduler;
+    FontCache _fonts;
+    const GFXfont* _font = nullptr;
+    bool _textBlack = true;
 
     bool _powered;
-    uint32_t _refreshCount;
-    uint32_t _lastRefreshTime;
+    std::atomic<uint32_t> _refreshCount;
+    std::atomic<uint32_t> _lastRefreshTime;
+
+    // Refresh pipeline. Jobs stream from the front buffer, which only the
+    // UI task flips, and only while the panel is idle.
+    enum class RefreshKind : uint8_t {
+        PARTIAL,
+        FULL,
+        CLEAN       // Inverted flash of each window (ghosting clean-up)
+    };
+
+    struct RefreshJob {
+        RefreshKind kind;
+        uint8_t count;
+        Rect windows[DirtyRectAccumulator::MAX_RECTS];  // Native
+    };
+
+    QueueHandle_t _jobQueue = nullptr;
+    TaskHandle_t _panelTask = nullptr;
+    std::atomic<bool> _refreshing{false};
+    bool _async = false;
+    bool _pendingFull = false;
+    DirtyRectAccumulator _pending{config::display::REFRESH_RECT_OVERHEAD_PX};  // Logical
+    uint32_t _coalescedCount = 0;
+    uint32_t _cleanupCount = 0;
+
+    void serviceGhosting();
+    void issue(const RefreshJob& job);
+    bool startPanelTask();
+    void runJob(const RefreshJob& job);
+    static void panelTask(void* param);
+    static void waitForBusy(const void* param);
+    static void IRAM_ATTR onBusyFalling();
 
     void log(const char* msg);
     void logf(const char* fmt, ...);
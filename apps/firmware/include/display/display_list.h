@@ -0,0 +1,225 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include <cstdint>
+
+#include "core/rect.h"
+
+namespace paperhome {
+
+class DisplayDriver;
+
+// =============================================================================
+// Draw Commands
+// =============================================================================
+
+/**
+ * @brief Draw command types
+ */
+enum class DrawCommandType : uint8_t {
+    FILL_RECT,
+    DRAW_RECT,
+    FILL_ROUND_RECT,
+    DRAW_ROUND_RECT,
+    DRAW_LINE,
+    DRAW_HLINE,
+    DRAW_VLINE,
+    FILL_CIRCLE,
+    DRAW_CIRCLE,
+    DRAW_TEXT,
+    FILL_SCREEN,
+    INVERT_RECT,
+    DRAW_BITMAP
+};
+
+/**
+ * @brief Draw command structure
+ *
+ * Screens can submit these to the compositor directly; the compositor's
+ * drawing methods build them internally. In a recorded frame they are
+ * stored in a DisplayList and rasterized at endFrame().
+ */
+struct DrawCommand {
+    DrawCommandType type;
+    int16_t x, y;
+    int16_t w, h;
+    int16_t extra1;     // radius for circles/round rects, x1 for lines
+    int16_t extra2;     // y1 for lines
+    bool black;
+    const void* data;   // text (DRAW_TEXT) or bitmap (DRAW_BITMAP)
+    const GFXfont* font;
+
+    // Factory methods
+    static DrawCommand fillRect(int16_t x, int16_t y, int16_t w, int16_t h, bool black) {
+        return {DrawCommandType::FILL_RECT, x, y, w, h, 0, 0, black, nullptr, nullptr};
+    }
+
+    static DrawCommand drawRect(int16_t x, int16_t y, int16_t w, int16_t h, bool black) {
+        return {DrawCommandType::DRAW_RECT, x, y, w, h, 0, 0, black, nullptr, nullptr};
+    }
+
+    static DrawCommand fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool black) {
+        return {DrawCommandType::FILL_ROUND_RECT, x, y, w, h, r, 0, black, nullptr, nullptr};
+    }
+
+    static DrawCommand drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool black) {
+        return {DrawCommandType::DRAW_ROUND_RECT, x, y, w, h, r, 0, black, nullptr, nullptr};
+    }
+
+    static DrawCommand drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool black) {
+        return {DrawCommandType::DRAW_LINE, x0, y0, 0, 0, x1, y1, black, nullptr, nullptr};
+    }
+
+    static DrawCommand drawHLine(int16_t x, int16_t y, int16_t w, bool black) {
+        return {DrawCommandType::DRAW_HLINE, x, y, w, 0, 0, 0, black, nullptr, nullptr};
+    }
+
+    static DrawCommand drawVLine(int16_t x, int16_t y, int16_t h, bool black) {
+        return {DrawCommandType::DRAW_VLINE, x, y, 0, h, 0, 0, black, nullptr, nullptr};
+    }
+
+    static DrawCommand fillCircle(int16_t x, int16_t y, int16_t r, bool black) {
+        return {DrawCommandType::FILL_CIRCLE, x, y, 0, 0, r, 0, black, nullptr, nullptr};
+    }
+
+    static DrawCommand drawCircle(int16_t x, int16_t y, int16_t r, bool black) {
+        return {DrawCommandType::DRAW_CIRCLE, x, y, 0, 0, r, 0, black, nullptr, nullptr};
+    }
+
+    static DrawCommand text(const char* text, int16_t x, int16_t y, const GFXfont* font, bool black) {
+        return {DrawCommandType::DRAW_TEXT, x, y, 0, 0, 0, 0, black, text, font};
+    }
+
+    static DrawCommand fillScreen(bool white) {
+        return {DrawCommandType::FILL_SCREEN, 0, 0, 0, 0, 0, 0, !white, nullptr, nullptr};
+    }
+
+    static DrawCommand invertRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+        return {DrawCommandType::INVERT_RECT, x, y, w, h, 0, 0, false, nullptr, nullptr};
+    }
+
+    static DrawCommand bitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, bool black) {
+        return {DrawCommandType::DRAW_BITMAP, x, y, w, h, 0, 0, black, bitmap, nullptr};
+    }
+};
+
+// =============================================================================
+// Display List
+// =============================================================================
+
+/**
+ * @brief One frame's draw commands, recorded for deferred rasterization
+ *
+ * Commands and their text live in fixed-capacity arenas allocated once
+ * (PSRAM); reset() rewinds them, so recording a frame never allocates.
+ * Each entry stores its conservative bounds and a content hash.
+ *
+ * A recording describes the whole screen starting from white. Diffing two
+ * consecutive recordings yields the regions whose commands changed, and
+ * only those need to be rasterized again.
+ *
+ * Bitmaps are recorded by pointer and hashed by content, so a buffer
+ * redrawn in place still diffs; it must stay valid until endFrame().
+ */
+class DisplayList {
+public:
+    struct Entry {
+        DrawCommand cmd;
+        Rect bounds;        // Logical, conservative
+        uint32_t hash;
+    };
+
+    DisplayList() = default;
+    ~DisplayList();
+
+    DisplayList(const DisplayList&) = delete;
+    DisplayList& operator=(const DisplayList&) = delete;
+
+    /**
+     * @brief Allocate the arenas (PSRAM, falls back to internal RAM)
+     * @return true if allocated
+     */
+    bool begin(uint16_t capacity, uint16_t textBytes);
+
+    bool isAllocated() const { return _entries != nullptr; }
+
+    /**
+     * @brief Discard all commands (keeps the arenas)
+     */
+    void reset();
+
+    /**
+     * @brief Append a command, copying its text into the arena
+     * @return false if the list or text arena is full (command not added)
+     */
+    bool add(const DrawCommand& cmd, const Rect& bounds);
+
+    uint16_t size() const { return _count; }
+    uint16_t capacity() const { return _capacity; }
+    uint16_t getTextBytesUsed() const { return _textUsed; }
+    const Entry& operator[](uint16_t index) const { return _entries[index]; }
+    const Entry* begin() const { return _entries; }
+    const Entry* end() const { return _entries + _count; }
+
+    /**
+     * @brief Add bounds of commands that appear in only one of the lists
+     *
+     * Commands are matched in recording order (content hash, then fields
+     * and text), so a re-recorded but unchanged scene yields nothing while
+     * reordered overlapping commands still show up.
+     */
+    void diff(const DisplayList& previous, DirtyRectAccumulator& out) const;
+
+    /**
+     * @brief Draw every command directly (no culling or clipping)
+     *
+     * Used to render a recording into another target, e.g. a host-side
+     * image dump.
+     */
+    void rasterize(DisplayDriver& display) const;
+
+    /**
+     * @brief Rasterize only what intersects the dirty rects
+     *
+     * Culls commands outside every dirty rect and sorts the rest by first
+     * native row, then walks the dirty area in bands of panel-native rows
+     * (contiguous framebuffer memory). In each band, every dirty rect is
+     * clipped, cleared to white and the commands spanning the band that
+     * overlap it are replayed in recording order.
+     *
+     * @param bandRows Native rows per band
+     * @return Number of command executions
+     */
+    uint32_t rasterize(DisplayDriver& display, const DirtyRectAccumulator& dirty, int16_t bandRows);
+
+    /**
+     * @brief Execute one command on a display
+     * @return Region touched by the command (logical)
+     */
+    static Rect execute(const DrawCommand& cmd, DisplayDriver& display);
+
+    /**
+     * @brief Conservative bounds of a command (text needs the display's font metrics)
+     */
+    static Rect boundsOf(const DrawCommand& cmd, DisplayDriver& display);
+
+private:
+    // Previous commands a command is matched against before it counts as new
+    static constexpr uint16_t DIFF_WINDOW = 32;
+
+    Entry* _entries = nullptr;
+    uint16_t* _culled = nullptr;    // Surviving entry indices by native top (raster scratch)
+    uint16_t* _active = nullptr;    // Entry indices spanning the band (raster scratch)
+    Rect* _native = nullptr;        // Native bounds per entry (raster scratch)
+    char* _text = nullptr;
+    uint16_t _capacity = 0;
+    uint16_t _textBytes = 0;
+    uint16_t _count = 0;
+    uint16_t _textUsed = 0;
+
+    void release();
+    static bool sameCommand(const Entry& a, const Entry& b);
+    static uint32_t hashCommand(const DrawCommand& cmd);
+};
+
+} // namespace paperhome
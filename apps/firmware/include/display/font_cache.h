@@ -0,0 +1,142 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "core/rect.h"
+
+namespace paperhome {
+
+/**
+ * @brief Exact ink bounds of a string, relative to the cursor origin
+ */
+struct TextBounds {
+    int16_t x1 = 0;         // Left of first inked pixel (relative to cursor x)
+    int16_t y1 = 0;         // Top of tallest glyph (relative to baseline)
+    uint16_t width = 0;
+    uint16_t height = 0;
+    int16_t advance = 0;    // Cursor advance (sum of xAdvance)
+
+    bool isEmpty() const { return width == 0 || height == 0; }
+
+    /**
+     * @brief Bounds of the text drawn with its cursor at (x, y)
+     */
+    Rect at(int16_t x, int16_t y) const {
+        return isEmpty() ? Rect::empty() : Rect(x + x1, y + y1, width, height);
+    }
+};
+
+/**
+ * @brief One GFX font pre-rasterized for a framebuffer rotation
+ *
+ * GFXfont bitmaps are bit-packed across rows, so Adafruit GFX walks them
+ * pixel by pixel. The atlas unpacks every glyph once into byte-aligned
+ * 1-bpp rows, already rotated into panel-native orientation, so drawing a
+ * glyph is a shifted row blit (Framebuffer::blitNative).
+ */
+class GlyphAtlas {
+public:
+    struct Glyph {
+        uint32_t offset;        // Into the atlas bitmap
+        uint8_t stride;         // Bytes per native row
+        uint8_t nativeWidth;    // Native box (rotated glyph)
+        uint8_t nativeHeight;
+        uint8_t width;          // Logical glyph box
+        uint8_t height;
+        int8_t xOffset;
+        int8_t yOffset;
+        uint8_t xAdvance;
+    };
+
+    GlyphAtlas() = default;
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    /**
+     * @brief Unpack all glyphs of font for a rotation (PSRAM)
+     * @return true if built
+     */
+    bool build(const GFXfont* font, uint8_t rotation);
+
+    const GFXfont* getFont() const { return _font; }
+    uint8_t getRotation() const { return _rotation; }
+    uint8_t getYAdvance() const { return _font ? _font->yAdvance : 0; }
+    uint32_t getBitmapBytes() const { return _bitmapBytes; }
+
+    /**
+     * @brief Glyph for a character, or nullptr if not in the font
+     */
+    const Glyph* glyph(uint8_t c) const {
+        if (!_glyphs || c < _font->first || c > _font->last) return nullptr;
+        return &_glyphs[c - _font->first];
+    }
+
+    const uint8_t* bitmap(const Glyph& g) const { return _bitmap + g.offset; }
+
+private:
+    const GFXfont* _font = nullptr;
+    uint8_t _rotation = 0;
+    Glyph* _glyphs = nullptr;
+    uint8_t* _bitmap = nullptr;
+    uint32_t _bitmapBytes = 0;
+
+    void release();
+};
+
+/**
+ * @brief Glyph atlases plus an LRU cache of string bounds
+ *
+ * Atlases are built lazily on first use of a font. String bounds are
+ * memoized by (font, FNV-1a hash, length) in a small LRU, so layout code
+ * that measures the same labels every frame doesn't re-walk the glyphs.
+ */
+class FontCache {
+public:
+    static constexpr uint8_t MAX_FONTS = 12;
+    static constexpr uint8_t BOUNDS_CACHE_SIZE = 64;
+
+    FontCache() = default;
+
+    /**
+     * @brief Atlas for a font at a rotation (built on first use)
+     * @return nullptr if the font is null or the atlas could not be built
+     *         (counted in getFallbacks(); the caller draws with GFX print)
+     */
+    const GlyphAtlas* atlas(const GFXfont* font, uint8_t rotation);
+
+    /**
+     * @brief Exact ink bounds of text in font (cached)
+     *
+     * Single line: characters outside the font (including '\n') are skipped.
+     */
+    TextBounds measure(const GFXfont* font, const char* text);
+
+    uint32_t getHits() const { return _hits; }
+    uint32_t getMisses() const { return _misses; }
+    uint8_t getAtlasCount() const;
+    uint32_t getFallbacks() const { return _fallbacks; }
+
+private:
+    struct BoundsEntry {
+        const GFXfont* font = nullptr;
+        uint32_t hash = 0;
+        uint16_t length = 0;
+        uint32_t lastUse = 0;
+        TextBounds bounds;
+    };
+
+    GlyphAtlas _atlases[MAX_FONTS];
+    BoundsEntry _bounds[BOUNDS_CACHE_SIZE];
+    uint32_t _useCounter = 0;
+    uint32_t _hits = 0;
+    uint32_t _misses = 0;
+    uint32_t _fallbacks = 0;
+
+    static TextBounds compute(const GFXfont* font, const char* text);
+};
+
+} // namespace paperhome
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+
+/**
+ * @brief The Adafruit GFX fonts used by the UI, defined once in fonts.cpp
+ *
+ * The <Fonts/...> headers define const (internal linkage) objects, so
+ * including them from a header gives every translation unit its own copy.
+ * FontCache keys glyph atlases by GFXfont address, so all code must share
+ * one object per font: include this header, never the font headers.
+ */
+
+extern const GFXfont FreeMonoBold24pt7b;
+extern const GFXfont FreeMonoBold18pt7b;
+extern const GFXfont FreeMonoBold12pt7b;
+extern const GFXfont FreeMonoBold9pt7b;
+extern const GFXfont FreeMono9pt7b;
+extern const GFXfont FreeSansBold18pt7b;
+extern const GFXfont FreeSansBold12pt7b;
+extern const GFXfont FreeSansBold9pt7b;
+extern const GFXfont FreeSans12pt7b;
+extern const GFXfont FreeSans9pt7b;
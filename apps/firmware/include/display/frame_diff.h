@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core/rect.h"
+#include "display/framebuffer.h"
+
+namespace paperhome {
+
+/**
+ * @brief Framebuffer diff engine for minimal partial refresh regions
+ *
+ * Compares the next frame (back buffer) against what the panel shows
+ * (front buffer) in 32-byte tiles (one 32-bit word x 8 rows, native
+ * layout), so a tile row is a single 25-bit mask.
+ *
+ * Changed tiles become row runs that are stacked vertically, tightened to
+ * the exact changed bytes/rows, then added to a DirtyRectAccumulator,
+ * which merges them by its refresh cost model.
+ *
+ * All rects are in native panel coordinates and byte-aligned in x.
+ */
+class FrameDiff {
+public:
+    static constexpr int16_t TILE_WIDTH = 32;   // Pixels (one word)
+    static constexpr int16_t TILE_HEIGHT = 8;   // Rows
+    static constexpr uint8_t TILE_COLS = Framebuffer::NATIVE_WIDTH / TILE_WIDTH;
+    static constexpr uint8_t TILE_ROWS = Framebuffer::NATIVE_HEIGHT / TILE_HEIGHT;
+    static constexpr size_t MAX_CANDIDATES = 48;
+
+    static_assert(TILE_COLS <= 32, "Tile row must fit in a 32-bit mask");
+
+    /**
+     * @brief Compute refresh rects where frame differs from the panel
+     *
+     * @param shown Frame on the panel (front buffer, native layout)
+     * @param frame Next frame (back buffer, native layout)
+     * @param search Native region to scan (pixels outside are assumed unchanged)
+     * @param out Receives changed rects (native coordinates)
+     */
+    void compute(const uint8_t* shown, const uint8_t* frame, const Rect& search,
+                 DirtyRectAccumulator& out) const;
+
+private:
+    Rect tighten(const uint8_t* shown, const uint8_t* frame, const Rect& tileRect) const;
+};
+
+} // namespace paperhome
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include <cstdint>
+#include <utility>
+
+#include "core/rect.h"
+
+namespace paperhome {
+
+/**
+ * @brief Packed 1-bpp framebuffer in panel-native orientation
+ *
+ * Owned by DisplayDriver and streamed to the panel controller directly,
+ * replacing GxEPD2_BW's private page buffer.
+ *
+ * Double-buffered: drawing always targets the back buffer, while the
+ * front buffer holds the frame on (or being streamed to) the panel.
+ * swapBuffers() flips the two pointers; copyFrontToBack() then brings the
+ * stale regions of the new back buffer up to date, so incremental drawing
+ * continues from the frame just shown.
+ *
+ * Layout matches what the SSD1677 expects: 800x480 native pixels,
+ * MSB-first, 1 = white, 100-byte rows. Rows are 32-bit aligned so
+ * fills and XOR inversion work on whole words.
+ *
+ * Drawing uses logical (rotated) coordinates through the Adafruit GFX
+ * API; fillRect/fast lines/invertRect map the rectangle to native
+ * coordinates once and operate on row spans instead of per pixel.
+ *
+ * An optional clip rectangle restricts every drawing operation (used by
+ * the compositor to rasterize a display list band by band).
+ */
+class Framebuffer : public Adafruit_GFX {
+public:
+    static constexpr int16_t NATIVE_WIDTH = 800;
+    static constexpr int16_t NATIVE_HEIGHT = 480;
+    static constexpr uint16_t STRIDE_BYTES = NATIVE_WIDTH / 8;
+    static constexpr uint16_t STRIDE_WORDS = STRIDE_BYTES / 4;
+    static constexpr uint32_t SIZE_BYTES = static_cast<uint32_t>(STRIDE_BYTES) * NATIVE_HEIGHT;
+
+    Framebuffer();
+    ~Framebuffer();
+
+    Framebuffer(const Framebuffer&) = delete;
+    Framebuffer& operator=(const Framebuffer&) = delete;
+
+    /**
+     * @brief Allocate front and back buffers (PSRAM, falls back to internal RAM)
+     * @return true if both allocated
+     */
+    bool begin();
+
+    bool isAllocated() const { return _buffer != nullptr && _front != nullptr; }
+
+    // =========================================================================
+    // Adafruit GFX overrides
+    // =========================================================================
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+    // =========================================================================
+    // Framebuffer operations
+    // =========================================================================
+
+    /**
+     * @brief XOR-invert all pixels in a logical rectangle
+     *
+     * Self-inverting: applying twice restores the original pixels.
+     */
+    void invertRect(const Rect& rect);
+
+    /**
+     * @brief Restrict all drawing to a logical rectangle
+     */
+    void setClip(const Rect& rect);
+
+    /**
+     * @brief Remove the clip rectangle
+     */
+    void clearClip() { _clipping = false; }
+
+    bool isClipping() const { return _clipping; }
+
+    /**
+     * @brief Map a logical rectangle to native panel coordinates
+     *
+     * Clips to the screen; returns an empty rect if nothing is visible.
+     */
+    Rect toNative(const Rect& rect) const;
+
+    /**
+     * @brief Map a logical rectangle to native coordinates without clipping
+     */
+    Rect mapToNative(const Rect& rect) const;
+
+    /**
+     * @brief Map a native panel rectangle back to logical coordinates
+     */
+    Rect toLogical(const Rect& native) const;
+
+    /**
+     * @brief Blit a 1-bpp mask in native coordinates
+     *
+     * Set bits in src (MSB-first, byte-aligned rows) are drawn in the given
+     * color; clear bits leave the framebuffer untouched. Rows are shifted
+     * into place a byte at a time; anything off-screen or outside the clip
+     * rectangle is skipped.
+     *
+     * @param src Mask rows, stride bytes each
+     * @param native Destination box (width/height in pixels)
+     */
+    void blitNative(const uint8_t* src, uint8_t stride, const Rect& native, bool black);
+
+    // =========================================================================
+    // Page flipping
+    // =========================================================================
+
+    /**
+     * @brief Make the back buffer the front buffer and vice versa
+     *
+     * Pointer swap only; the new back buffer holds the older frame until
+     * copyFrontToBack() is called for the regions that changed.
+     */
+    void swapBuffers() { std::swap(_buffer, _front); }
+
+    /**
+     * @brief Copy a native window from the front to the back buffer
+     *
+     * x is widened to byte boundaries.
+     */
+    void copyFrontToBack(const Rect& native);
+
+    /**
+     * @brief Copy the whole front buffer to the back buffer
+     */
+    void copyFrontToBack();
+
+    /**
+     * @brief Back (drawing) buffer (native layout, SIZE_BYTES long)
+     */
+    const uint8_t* getBuffer() const { return reinterpret_cast<const uint8_t*>(_buffer); }
+
+    /**
+     * @brief Front (shown) buffer (native layout, SIZE_BYTES long)
+     */
+    const uint8_t* getFrontBuffer() const { return reinterpret_cast<const uint8_t*>(_front); }
+
+private:
+    enum class SpanOp : uint8_t {
+        SET,        // White
+        CLEAR,      // Black
+        INVERT
+    };
+
+    uint32_t* _buffer;      // Back: drawing target
+    uint32_t* _front;       // Shown: streamed to the panel
+    Rect _clip;             // Logical
+    Rect _clipNative;
+    bool _clipping = false;
+
+    void applyNative(const Rect& native, SpanOp op);
+    void applyLogical(int16_t x, int16_t y, int16_t w, int16_t h, SpanOp op);
+};
+
+} // namespace paperhome
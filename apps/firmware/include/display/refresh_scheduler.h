@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+
+#include "core/rect.h"
+#include "display/framebuffer.h"
+
+namespace paperhome {
+
+/**
+ * @brief Ghosting-aware scheduler for clean-up refreshes
+ *
+ * Partial refreshes leave residue on e-ink that builds up where pixels
+ * flip repeatedly. Instead of a fixed "full refresh every N partials",
+ * a heat map of 32x32 native tiles records per tile:
+ * - how many partial refreshes changed it
+ * - how many pixels flipped in it
+ *
+ * A tile past either budget is over budget. Clean-up is deferred until
+ * there has been no input for a while; then only the over-budget tiles
+ * are cleaned (inverted flash, see DisplayDriver), or the whole panel
+ * gets a full refresh if most of it is over budget.
+ *
+ * All rects are in native panel coordinates.
+ */
+class RefreshScheduler {
+public:
+    static constexpr int16_t TILE_SIZE = 32;    // Pixels (one word wide)
+    static constexpr uint8_t TILE_COLS = Framebuffer::NATIVE_WIDTH / TILE_SIZE;
+    static constexpr uint8_t TILE_ROWS = Framebuffer::NATIVE_HEIGHT / TILE_SIZE;
+    static constexpr uint16_t TILE_COUNT = static_cast<uint16_t>(TILE_COLS) * TILE_ROWS;
+
+    static_assert(Framebuffer::NATIVE_WIDTH % TILE_SIZE == 0 &&
+                  Framebuffer::NATIVE_HEIGHT % TILE_SIZE == 0,
+                  "Tiles must cover the panel exactly");
+
+    enum class Action : uint8_t {
+        NONE,
+        CLEAN,      // Clean the returned regions
+        FULL        // Full refresh
+    };
+
+    RefreshScheduler();
+
+    /**
+     * @brief Account for a partial refresh of a window
+     *
+     * Call before the window is shown, with the frame on the panel and
+     * the frame about to replace it.
+     */
+    void recordPartial(const uint8_t* shown, const uint8_t* next, const Rect& native);
+
+    /**
+     * @brief Account for a full refresh (clears the heat map)
+     */
+    void recordFull();
+
+    /**
+     * @brief Account for a clean of a window (clears tiles it covers)
+     */
+    void recordClean(const Rect& native);
+
+    /**
+     * @brief User activity: postpones clean-up
+     */
+    void noteInput(uint32_t now) { _lastInput = now; }
+
+    /**
+     * @brief Decide whether clean-up is due
+     *
+     * @param now Current time (ms)
+     * @param regions Receives the regions to clean (Action::CLEAN)
+     */
+    Action poll(uint32_t now, DirtyRectAccumulator& regions) const;
+
+    bool isOverBudget(uint8_t col, uint8_t row) const;
+    uint16_t getTilesOverBudget() const;
+    uint8_t getPartialCount(uint8_t col, uint8_t row) const { return _partials[row][col]; }
+    uint32_t getFlipCount(uint8_t col, uint8_t row) const { return _flips[row][col]; }
+
+    static Rect tileRect(uint8_t col, uint8_t row) {
+        return Rect(col * TILE_SIZE, row * TILE_SIZE, TILE_SIZE, TILE_SIZE);
+    }
+
+private:
+    uint8_t _partials[TILE_ROWS][TILE_COLS];
+    uint32_t _flips[TILE_ROWS][TILE_COLS];
+    uint32_t _lastInput;
+};
+
+} // namespace paperhome
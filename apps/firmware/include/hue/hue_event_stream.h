@@ -0,0 +1,124 @@
+#ifndef PAPERHOME_HUE_EVENT_STREAM_H
+#define PAPERHOME_HUE_EVENT_STREAM_H
+
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+#include "core/config.h"
+#include "core/spsc_ring.h"
+
+class HTTPClient;
+
+namespace paperhome {
+
+/**
+ * @brief Hue API v2 event stream (server-sent events) reader
+ *
+ * Holds GET https://<bridge>/eventstream/clip/v2 open on its own task and
+ * turns grouped_light updates into per-room deltas (v1 group ID, on,
+ * brightness) for the I/O task. Changes the deltas cannot express (a
+ * light switching, which may change a room's all_on; rooms added or
+ * removed; a reconnect after missed events; a full delta ring) raise a
+ * resync flag instead, answered with one /groups fetch.
+ *
+ * The stream uses its own TLS connection, so it never holds up commands
+ * on the Hue network lane. When it drops, the task retries with
+ * doubling back-off while the service polls.
+ *
+ * Usage:
+ *   HueEventStream events;
+ *   events.start(bridgeIP, username);
+ *
+ *   // In I/O loop
+ *   HueEventStream::Delta delta;
+ *   while (events.pop(delta)) { apply(delta); }
+ *   if (events.takeResync()) { fetchRooms(); }
+ */
+class HueEventStream {
+public:
+    enum Field : uint8_t {
+        ON = 1 << 0,
+        BRIGHTNESS = 1 << 1
+    };
+
+    /**
+     * @brief Change to one room (v1 group)
+     */
+    struct Delta {
+        char roomId[8] = {};
+        uint8_t fields = 0;         // Field bits present
+        bool on = false;            // grouped_light on: any light in the room on
+        uint8_t brightness = 0;     // 0-254
+    };
+
+    struct Stats {
+        uint32_t connects = 0;
+        uint32_t drops = 0;         // Connections lost (not stopped by us)
+        uint32_t events = 0;        // data: lines parsed
+        uint32_t deltas = 0;        // Room deltas queued
+    };
+
+    HueEventStream();
+    ~HueEventStream();
+
+    HueEventStream(const HueEventStream&) = delete;
+    HueEventStream& operator=(const HueEventStream&) = delete;
+
+    /**
+     * @brief Start the stream task for a bridge
+     * @return false if the task could not be created
+     */
+    bool start(const char* bridgeIP, const char* appKey);
+
+    /**
+     * @brief Close the stream and wait for the task to end
+     */
+    void stop();
+
+    bool isRunning() const { return _task != nullptr; }
+    bool isConnected() const { return _connected.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Next room delta (I/O task only)
+     */
+    bool pop(Delta& delta) { return _deltas.pop(delta); }
+
+    /**
+     * @brief Whether rooms must be fetched again; clears the flag
+     */
+    bool takeResync() { return _resync.exchange(false, std::memory_order_acq_rel); }
+
+    Stats getStats() const;
+
+private:
+    SpscRing<Delta, config::tasks::HUE_EVENT_QUEUE_SIZE> _deltas;
+    TaskHandle_t _task;
+    std::atomic<bool> _stopRequested;
+    std::atomic<bool> _taskDone;
+    std::atomic<bool> _connected;
+    std::atomic<bool> _resync;
+
+    std::atomic<uint32_t> _connects;
+    std::atomic<uint32_t> _drops;
+    std::atomic<uint32_t> _events;
+    std::atomic<uint32_t> _deltaCount;
+
+    char _bridgeIP[16];
+    char _appKey[48];
+
+    static void streamTask(void* param);
+    void run();
+    bool open(HTTPClient& http, WiFiClientSecure& client);
+    void readEvents(WiFiClientSecure& client);
+    int nextByte(WiFiClientSecure& client);
+    void queue(const Delta& delta);
+
+    void log(const char* msg);
+    void logf(const char* fmt, ...);
+};
+
+} // namespace paperhome
+
+#endif // PAPERHOME_HUE_EVENT_STREAM_H
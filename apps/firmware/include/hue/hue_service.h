@@ -3,11 +3,13 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <HTTPClient.h>
 #include <WiFiUdp.h>
 #include <functional>
 #include "core/config.h"
+#include "core/pending_overlay.h"
 #include "core/state_machine.h"
+#include "connectivity/network_worker.h"
+#include "hue/hue_event_stream.h"
 #include "hue/hue_types.h"
 
 namespace paperhome {
@@ -18,11 +20,29 @@ namespace paperhome {
  * Handles SSDP discovery, authentication, room polling, and control.
  * Uses NVS for credential persistence.
  *
+ * HTTP requests run on the NetworkWorker's Hue lane; their results are
+ * applied when the worker's poll() runs the completion on the I/O task.
+ * Commands return once the request is queued.
+ *
+ * While connected, room changes arrive through the bridge's event stream
+ * (HueEventStream) and are applied in update(); /groups polling only
+ * resyncs while the stream is up and takes over when it drops.
+ *
+ * Commands are optimistic: the room list shows their result right away
+ * (a PendingOverlay over the last bridge state) until a fetch after the
+ * request confirms it, or the request fails and it rolls back.
+ *
+ * Brightness commands are coalesced per room: each call replaces the
+ * room's pending target, which is sent at the bridge's group command
+ * rate. A sweep of several PUTs ends with a confirmation PUT of the
+ * final value.
+ *
  * Usage:
- *   HueService hue;
+ *   HueService hue(network);
  *   hue.init();
  *
  *   // In I/O loop
+ *   network.poll();
  *   hue.update();
  *
  *   // When connected
@@ -41,7 +61,7 @@ namespace paperhome {
  */
 class HueService {
 public:
-    HueService();
+    explicit HueService(NetworkWorker& network);
 
     /**
      * @brief Initialize the Hue service
@@ -55,6 +75,8 @@ public:
      * @brief Update service state (call in I/O loop)
      *
      * Handles discovery, authentication polling, and room state updates.
+     * Never blocks: SSDP replies are read without waiting and HTTP goes
+     * through the network worker.
      */
     void update();
 
@@ -88,7 +110,7 @@ public:
     const HueRoomData& getRoom(uint8_t index) const;
 
     /**
-     * @brief Get all rooms array
+     * @brief Get all rooms array (pending commands applied)
      */
     const HueRoomData* getRooms() const { return _rooms; }
 
@@ -99,12 +121,27 @@ public:
      */
     const HueRoomData* findRoom(const char* roomId) const;
 
+    /**
+     * @brief Parse a GET /groups body into rooms
+     *
+     * Walks the body one group at a time and parses each through a filter
+     * document, so RAM use stays at one group however many groups and
+     * entertainment areas the bridge has. Keeps Room and Zone groups, up
+     * to HUE_MAX_ROOMS.
+     *
+     * @param body Response body
+     * @param rooms Output, HUE_MAX_ROOMS entries
+     * @param count Set to the number of rooms written
+     * @return false if the body is not a groups object
+     */
+    static bool parseRooms(Stream& body, HueRoomData* rooms, uint8_t& count);
+
     // Room control
 
     /**
      * @brief Toggle room on/off
      * @param roomId Room ID
-     * @return true if command sent successfully
+     * @return true if the request was queued
      */
     bool toggleRoom(const char* roomId);
 
@@ -112,23 +149,27 @@ public:
      * @brief Set room on/off state
      * @param roomId Room ID
      * @param on true to turn on, false to turn off
-     * @return true if command sent successfully
+     * @return true if the request was queued
      */
     bool setRoomState(const char* roomId, bool on);
 
     /**
      * @brief Set room brightness
+     *
+     * With coalescing the room shows the new brightness at once and the
+     * PUT follows at the group command rate, latest value wins.
+     *
      * @param roomId Room ID
      * @param brightness Brightness level (0-254)
-     * @return true if command sent successfully
+     * @return true if the request was queued (or coalesced)
      */
     bool setRoomBrightness(const char* roomId, uint8_t brightness);
 
     /**
      * @brief Adjust room brightness relatively
      * @param roomId Room ID
-     * @param delta Brightness change (-254 to +254)
-     * @return true if command sent successfully
+     * @param delta Brightness change (-254 to +254), applied to the pending target if any
+     * @return true if the request was queued (or coalesced)
      */
     bool adjustRoomBrightness(const char* roomId, int16_t delta);
 
@@ -150,10 +191,62 @@ public:
 
     /**
      * @brief Force refresh room data
-     * @return true if fetch was successful
+     * @return true if the fetch was queued
      */
     bool refreshRooms();
 
+    /**
+     * @brief Poll counters (incremental polling)
+     */
+    struct PollStats {
+        uint32_t polls = 0;         ///< Timed /groups polls
+        uint32_t unchanged = 0;     ///< Polls whose body hash matched (not parsed)
+        uint32_t parses = 0;        ///< Bodies parsed into rooms
+    };
+    const PollStats& getPollStats() const { return _pollStats; }
+
+    /**
+     * @brief Enable or disable incremental polling (default: config::hue::INCREMENTAL_POLL)
+     *
+     * Incremental polls only hash the /groups body and parse it again when
+     * the hash changed. The interval doubles from POLL_INTERVAL_MS up to
+     * POLL_INTERVAL_MAX_MS while nothing changes and drops to
+     * POLL_INTERVAL_FAST_MS after a local command. Disabled, every
+     * POLL_INTERVAL_MS poll is parsed.
+     */
+    void setIncrementalPolling(bool enabled);
+
+    /**
+     * @brief Enable or disable the event stream (default: config::hue::EVENT_STREAM)
+     */
+    void setEventStream(bool enabled);
+
+    /**
+     * @brief Brightness command counters (coalescing)
+     */
+    struct CommandStats {
+        uint32_t requested = 0;     ///< Brightness changes asked for
+        uint32_t sent = 0;          ///< Brightness PUTs sent, confirmations included
+        uint32_t confirmations = 0; ///< Final PUTs after a sweep
+        uint32_t failed = 0;        ///< PUTs the bridge rejected or that failed
+    };
+    const CommandStats& getCommandStats() const { return _commandStats; }
+
+    /**
+     * @brief How optimistic room changes were settled
+     */
+    const PendingStats& getPendingStats() const { return _pending.getStats(); }
+
+    /**
+     * @brief Enable or disable brightness coalescing (default: config::hue::COALESCE_BRIGHTNESS)
+     *
+     * Disabled, every brightness change is its own PUT.
+     */
+    void setBrightnessCoalescing(bool enabled);
+
+    bool isEventStreamConnected() const { return _events.isConnected(); }
+    HueEventStream::Stats getEventStreamStats() const { return _events.getStats(); }
+
     // Callbacks
 
     /**
@@ -178,14 +271,64 @@ private:
     // Credentials (stored in NVS)
     char _bridgeIP[16];
     char _username[48];
+    char _baseUrl[80];      // "http://<ip>/api/<username>", set with credentials
 
-    // Room data
+    // Room data as shown: bridge state with pending commands applied
     HueRoomData _rooms[HUE_MAX_ROOMS];
     uint8_t _roomCount;
 
+    // Last bridge state (fetches and events)
+    HueRoomData _bridgeRooms[HUE_MAX_ROOMS];
+    uint8_t _bridgeCount;
+
+    // Expected result of commands not yet seen in a fetch, by room ID
+    struct RoomMutation {
+        bool on;
+        bool setsBrightness;
+        uint8_t brightness;
+    };
+    PendingOverlay<RoomMutation, HUE_MAX_ROOMS> _pending;
+
+    // Parsed by the Hue lane, applied by the fetch completion
+    HueRoomData _fetchedRooms[HUE_MAX_ROOMS];
+    uint8_t _fetchedCount;
+    uint32_t _fetchedHash;
+
+    // Incremental polling
+    uint32_t _roomsHash;        // Body hash behind _rooms, 0 = none yet
+    uint32_t _pollIntervalMs;
+    bool _incrementalPoll;
+    PollStats _pollStats;
+
+    // Push updates (API v2 event stream)
+    HueEventStream _events;
+    bool _eventStream;      // Enabled
+    bool _streamUp;         // Connected as of the last update()
+
+    // Brightness coalescing: one pending target per room
+    struct BrightnessTarget {
+        char roomId[sizeof(HueRoomData::id)];   // "" = slot free
+        uint8_t value;          // Latest brightness asked for
+        uint8_t sends;          // PUTs sent this sweep
+        uint8_t failures;       // Rejected PUTs in a row
+        bool dirty;             // value not sent yet
+        bool inFlight;
+        uint16_t sweep;         // Bumped when the slot is freed; stale completions check it
+        uint32_t token;         // _pending token of value
+        uint32_t changedAt;
+    };
+    BrightnessTarget _targets[HUE_MAX_ROOMS];
+    uint32_t _lastGroupCommandAt;
+    bool _coalesce;
+    CommandStats _commandStats;
+
     // Networking
+    NetworkWorker& _network;
     WiFiUDP _udp;
-    HTTPClient _http;
+    bool _ssdpListening;
+    bool _fetchPending;     // Room fetch queued or in flight
+    bool _refetchQueued;    // Full fetch asked for while one was pending
+    bool _authPending;      // Auth request queued or in flight
 
     // Timing
     uint32_t _lastPollTime;
@@ -197,18 +340,35 @@ private:
     void handleDiscovering();
     void handleWaitingForButton();
     void handleConnected();
+    void applyEvents();
+    void sendBrightness();
 
     // Discovery
     void sendSSDPRequest();
+    void readSSDPResponses();
     bool parseDiscoveryResponse(const char* response);
 
     // Authentication
     bool sendAuthRequest();
+    void handleAuthResponse(const String& response);
 
     // Room management
-    bool fetchRooms();
-    bool parseRoomsResponse(const String& response);
-    bool roomsChanged(const HueRoomData* newRooms, uint8_t newCount);
+    bool fetchRooms(NetPriority priority = NetPriority::BACKGROUND, bool probe = false);
+    void onFetchComplete(const NetResponse& response, bool probe, uint32_t fetch);
+    void pollSoon();
+    void applyRooms(const HueRoomData* newRooms, uint8_t newCount);
+    void publishRooms();
+    static bool roomDiffers(const HueRoomData& a, const HueRoomData& b);
+    static uint32_t roomKey(const char* roomId);
+    void onCommandComplete(uint32_t key, uint32_t token, const NetResponse& response);
+
+    // Brightness coalescing
+    BrightnessTarget* findTarget(const char* roomId);
+    BrightnessTarget* claimTarget(const char* roomId);
+    void releaseTarget(BrightnessTarget& target);
+    void finishSweep(BrightnessTarget& target);
+    void onBrightnessComplete(uint8_t slot, uint16_t sweep, bool confirm, const NetResponse& response);
+    bool putBrightness(const char* roomId, uint8_t brightness, NetworkWorker::Callback callback);
 
     // Credentials
     bool loadCredentials();
@@ -216,10 +376,12 @@ private:
     void clearCredentials();
 
     // HTTP helpers
-    String buildUrl(const String& path);
-    bool httpGet(const String& url, String& response);
-    bool httpPut(const String& url, const String& body, String& response);
-    bool httpPost(const String& url, const String& body, String& response);
+    static constexpr size_t URL_SIZE = 128;
+    void updateBaseUrl();
+    void formatUrl(char* out, const char* pathTemplate, const char* id = "");
+    bool submit(NetMethod method, const char* url, const char* body,
+                NetPriority priority, NetworkWorker::Callback callback,
+                BodyReader reader = nullptr);
 
     // State transition
     void onStateTransition(HueState oldState, HueState newState, const char* message);
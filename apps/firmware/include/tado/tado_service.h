@@ -2,11 +2,11 @@
 #define PAPERHOME_TADO_SERVICE_H
 
 #include <Arduino.h>
-#include <WiFiClientSecure.h>
-#include <HTTPClient.h>
 #include <functional>
 #include "core/config.h"
+#include "core/pending_overlay.h"
 #include "core/state_machine.h"
+#include "connectivity/network_worker.h"
 #include "tado/tado_types.h"
 
 namespace paperhome {
@@ -17,11 +17,28 @@ namespace paperhome {
  * Handles OAuth device flow authentication, zone polling, and temperature control.
  * Uses NVS for token persistence.
  *
+ * HTTPS requests run on the NetworkWorker's Tado lane; multi-step flows
+ * (token → home → zones) continue from completion callbacks on the I/O
+ * task. Only one background step is outstanding at a time; commands are
+ * queued at user priority and return once queued.
+ *
+ * Setpoint commands are optimistic: the zone list shows the new target
+ * right away (a PendingOverlay over the last polled state) and zones are
+ * fetched as soon as the command completes, which confirms it. A failed
+ * command rolls back to the polled state.
+ *
+ * Zone polls are conditional when HOPS sends an ETag: an unchanged zone
+ * list answers 304 and is not parsed. A changed one is parsed on the lane
+ * straight off the connection. Each publish records which fields of which
+ * zones changed (getZoneChanges()), and the zones callback only runs when
+ * a field changed at the resolution the UI shows it.
+ *
  * Usage:
- *   TadoService tado;
+ *   TadoService tado(network);
  *   tado.init();
  *
  *   // In I/O loop
+ *   network.poll();
  *   tado.update();
  *
  *   // When connected
@@ -37,7 +54,7 @@ namespace paperhome {
  */
 class TadoService {
 public:
-    TadoService();
+    explicit TadoService(NetworkWorker& network);
 
     /**
      * @brief Initialize the Tado service
@@ -79,10 +96,17 @@ public:
     const TadoZoneData& getZone(uint8_t index) const;
 
     /**
-     * @brief Get all zones array
+     * @brief Get all zones array (pending setpoints applied)
      */
     const TadoZoneData* getZones() const { return _zones; }
 
+    /**
+     * @brief Fields of a zone changed by the last zones callback
+     * @param index Zone index (0 to zoneCount-1)
+     * @return TadoZoneField mask, 0 if unchanged
+     */
+    uint8_t getZoneChanges(uint8_t index) const;
+
     /**
      * @brief Get home name
      */
@@ -100,7 +124,7 @@ public:
      * @param zoneId Zone ID
      * @param temp Target temperature in Celsius
      * @param durationSeconds Duration of override (0 = until next schedule block)
-     * @return true if command sent successfully
+     * @return true if the request was queued
      */
     bool setZoneTemperature(int32_t zoneId, float temp, int durationSeconds = 0);
 
@@ -108,14 +132,14 @@ public:
      * @brief Adjust zone temperature relatively
      * @param zoneId Zone ID
      * @param delta Temperature change (e.g., +0.5 or -0.5)
-     * @return true if command sent successfully
+     * @return true if the request was queued
      */
     bool adjustZoneTemperature(int32_t zoneId, float delta);
 
     /**
      * @brief Resume schedule for a zone (cancel manual override)
      * @param zoneId Zone ID
-     * @return true if command sent successfully
+     * @return true if the request was queued
      */
     bool resumeSchedule(int32_t zoneId);
 
@@ -138,10 +162,37 @@ public:
 
     /**
      * @brief Force refresh zone data
-     * @return true if fetch was successful
+     * @return true if the fetch was queued
      */
     bool refreshZones();
 
+    /**
+     * @brief How optimistic setpoints were settled
+     */
+    const PendingStats& getPendingStats() const { return _pending.getStats(); }
+
+    /**
+     * @brief Zone poll statistics
+     */
+    struct ZoneStats {
+        uint32_t fetches = 0;       ///< /rooms responses received
+        uint32_t notModified = 0;   ///< 304: ETag matched, nothing parsed
+        uint32_t parses = 0;        ///< Bodies parsed into zones
+        uint32_t bytes = 0;         ///< Body bytes read
+        uint32_t parseUs = 0;       ///< Time reading and parsing bodies
+        uint32_t publishes = 0;     ///< Zones callbacks
+        uint32_t zoneUpdates = 0;   ///< Zones changed in those callbacks
+        uint32_t fieldUpdates = 0;  ///< Fields changed in those callbacks
+    };
+    const ZoneStats& getZoneStats() const { return _zoneStats; }
+
+    /**
+     * @brief Enable or disable conditional zone polls (default: config::tado::CONDITIONAL_POLL)
+     *
+     * Disabled, every poll downloads and parses the full zone list.
+     */
+    void setConditionalPolling(bool enabled);
+
     // Callbacks
 
     /**
@@ -167,6 +218,9 @@ public:
     void setAuthInfoCallback(AuthInfoCallback callback) { _authInfoCallback = callback; }
 
 private:
+    // Result of an API call: success per the endpoint's rules, plus body
+    using ResultCallback = std::function<void(bool ok, const String& response)>;
+
     StateMachine<TadoState> _stateMachine;
     StateCallback _stateCallback;
     ZonesCallback _zonesCallback;
@@ -184,10 +238,37 @@ private:
     // Auth info for display
     TadoAuthInfo _authInfo;
 
-    // Zone data
+    // Zone data as shown: polled state with pending setpoints applied
     TadoZoneData _zones[TADO_MAX_ZONES];
     uint8_t _zoneCount;
 
+    uint8_t _zoneChanges[TADO_MAX_ZONES];   // TadoZoneField masks of the last publish
+
+    // Last polled state
+    TadoZoneData _polledZones[TADO_MAX_ZONES];
+    uint8_t _polledCount;
+    String _zonesEtag;              // ETag of the polled state, empty = none
+
+    // Staging for a zone fetch: written by the lane, read by its completion
+    TadoZoneData _fetchedZones[TADO_MAX_ZONES];
+    uint8_t _fetchedCount;
+    uint32_t _fetchedBytes;
+    uint32_t _fetchedUs;
+    bool _fetchPending;             // One zone fetch at a time
+    bool _refetchQueued;            // Fetch again once it completes
+    bool _conditionalPoll;
+    ZoneStats _zoneStats;
+
+    // Setpoints not yet seen in a poll, by zone ID
+    struct ZoneMutation {
+        float targetTemp;
+    };
+    PendingOverlay<ZoneMutation, TADO_MAX_ZONES> _pending;
+
+    // Networking
+    NetworkWorker& _network;
+    uint8_t _backgroundPending;     // Background requests queued or in flight
+
     // Timing
     uint32_t _lastPollTime;
     uint32_t _lastTokenRefresh;
@@ -208,12 +289,19 @@ private:
 
     // OAuth methods
     bool requestDeviceCode();
+    bool handleDeviceCodeResponse(const String& response);
     bool pollForToken();
+    bool handleTokenResponse(const String& response);
     bool refreshAccessToken();
 
     // API methods
-    bool fetchHomeId();
+    bool fetchHomeId(std::function<void(bool ok)> done);
     bool fetchZones();
+    void onZonesFetched(const NetResponse& response, uint32_t fetch);
+    static bool parseZones(Stream& body, TadoZoneData* zones, uint8_t& count);
+    void publishZones();
+    static uint8_t zoneChanges(const TadoZoneData& shown, const TadoZoneData& zone);
+    void onHomeVerified(const char* message);
     bool sendManualControl(int32_t zoneId, float temp, int durationSeconds);
     bool sendResumeSchedule(int32_t zoneId);
 
@@ -222,12 +310,12 @@ private:
     void saveTokens();
     void clearTokens();
 
-    // HTTP helpers
-    bool httpsGet(const String& url, String& response);
-    bool httpsPost(const String& url, const String& body, String& response,
-                   const char* contentType = "application/x-www-form-urlencoded");
-    bool httpsPostJson(const String& url, const String& jsonBody, String& response);
-    bool httpsDelete(const String& url);
+    // HTTP helpers (queue on the Tado lane; callback runs on the I/O task)
+    bool httpsGet(const String& url, NetPriority priority, ResultCallback callback);
+    bool httpsPost(const String& url, const String& body, NetPriority priority, ResultCallback callback);
+    bool httpsPostJson(const String& url, const String& jsonBody, ResultCallback callback);
+    bool httpsDelete(const String& url, ResultCallback callback);
+    bool submit(NetRequest&& request, NetPriority priority, NetworkWorker::Callback callback);
 
     // State transition
     void onStateTransition(TadoState oldState, TadoState newState, const char* message);
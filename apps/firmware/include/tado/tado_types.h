@@ -1,6 +1,7 @@
 #ifndef PAPERHOME_TADO_TYPES_H
 #define PAPERHOME_TADO_TYPES_H
 
+#include <cmath>
 #include <cstdint>
 
 namespace paperhome {
@@ -53,6 +54,36 @@ struct TadoZoneData {
     uint8_t heatingPower;       // Heating power percentage (0-100)
 };
 
+/**
+ * @brief TadoZoneData fields as a change mask (TadoService::getZoneChanges)
+ *
+ * Temperatures count as changed at the 0.1 °C and humidity at the 1 %
+ * the UI shows them with.
+ */
+enum TadoZoneField : uint8_t {
+    TADO_ZONE_ADDED         = 1 << 0,   // Zone new at this index: every field
+    TADO_ZONE_NAME          = 1 << 1,
+    TADO_ZONE_CURRENT_TEMP  = 1 << 2,
+    TADO_ZONE_TARGET_TEMP   = 1 << 3,
+    TADO_ZONE_HUMIDITY      = 1 << 4,
+    TADO_ZONE_HEATING       = 1 << 5,   // heating or heatingPower
+    TADO_ZONE_MANUAL        = 1 << 6
+};
+
+/**
+ * @brief Temperature as the UI shows it: tenths of a degree
+ */
+inline int32_t tadoTenths(float celsius) {
+    return static_cast<int32_t>(lroundf(celsius * 10.0f));
+}
+
+/**
+ * @brief Humidity as the UI shows it: whole percent
+ */
+inline int32_t tadoPercent(float humidity) {
+    return static_cast<int32_t>(lroundf(humidity));
+}
+
 /**
  * @brief Auth info for display during OAuth device flow
  */
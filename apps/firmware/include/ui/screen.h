@@ -3,7 +3,10 @@
 #include "navigation/nav_types.h"
 #include "display/compositor.h"
 #include "core/rect.h"
+#include "ui/widget.h"
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace paperhome {
 
@@ -18,6 +21,11 @@ namespace paperhome {
  *
  * Screens are stateless renderers that receive data and events,
  * then submit draw commands to the compositor.
+ *
+ * Retained screens (GridScreen, ListScreen) keep a widget tree and only
+ * repaint invalidated nodes; the caller must not clear the framebuffer
+ * between their frames. Other screens expect a cleared screen and
+ * redraw everything.
  */
 class Screen {
 public:
@@ -94,6 +102,26 @@ public:
      */
     virtual void clearDirty() { _dirty = false; }
 
+    /**
+     * @brief Check if render() only repaints invalidated widgets
+     *
+     * If true, the framebuffer must keep the previous frame; otherwise
+     * the caller clears the screen before render().
+     */
+    virtual bool isRetained() const { return false; }
+
+    /**
+     * @brief Force the next render() to repaint everything
+     *
+     * Called after the framebuffer was cleared (e.g. screen change).
+     */
+    virtual void invalidateAll() { markDirty(); }
+
+    /**
+     * @brief Whether the status bar is drawn above this screen
+     */
+    virtual bool hasStatusBar() const { return true; }
+
     /**
      * @brief Get the currently selected item's bounding rect
      *
@@ -128,6 +156,13 @@ public:
     GridScreen(int16_t cols, int16_t rows, int16_t itemWidth, int16_t itemHeight,
                int16_t startX = 0, int16_t startY = 0, int16_t spacing = 0);
 
+    /**
+     * @brief Repaint invalidated cells (or everything after markDirty())
+     */
+    void render(Compositor& compositor) override;
+    bool isRetained() const override { return true; }
+    void invalidateAll() override;
+
     bool handleEvent(NavEvent event) override;
 
     Rect getSelectionRect() const override;
@@ -168,6 +203,30 @@ protected:
      */
     virtual int16_t getItemCount() const { return _cols * _rows; }
 
+    /**
+     * @brief Draw everything outside the cells (title, page dots, ...)
+     *
+     * Called when the whole screen repaints, after its area is cleared.
+     */
+    virtual void renderChrome(Compositor& compositor) { (void)compositor; }
+
+    /**
+     * @brief Draw one cell (bounds are already cleared)
+     *
+     * Only called for index < getItemCount().
+     */
+    virtual void renderCell(Compositor& compositor, int16_t index, const Rect& bounds) = 0;
+
+    /**
+     * @brief Repaint a single cell on the next render()
+     */
+    void invalidateCell(int16_t index);
+
+    /**
+     * @brief Area repainted on a full redraw (default: below status bar)
+     */
+    virtual Rect getContentBounds() const;
+
     int16_t _cols;
     int16_t _rows;
     int16_t _itemWidth;
@@ -182,8 +241,12 @@ private:
     int16_t _prevSelectedCol = 0;
     int16_t _prevSelectedRow = 0;
 
+    DrawWidget _root;
+    std::vector<std::unique_ptr<DrawWidget>> _cells;
+
     void moveSelection(int8_t dx, int8_t dy);
     Rect rectForCell(int16_t col, int16_t row) const;
+    void buildTree();
 };
 
 /**
@@ -196,6 +259,13 @@ class ListScreen : public Screen {
 public:
     ListScreen(int16_t itemHeight, int16_t startY = 0, int16_t marginX = 20);
 
+    /**
+     * @brief Repaint invalidated items (or everything after markDirty())
+     */
+    void render(Compositor& compositor) override;
+    bool isRetained() const override { return true; }
+    void invalidateAll() override;
+
     bool handleEvent(NavEvent event) override;
 
     Rect getSelectionRect() const override;
@@ -232,6 +302,30 @@ protected:
      */
     virtual int16_t getItemWidth() const;
 
+    /**
+     * @brief Draw everything outside the items (title, hints, ...)
+     *
+     * Called when the whole screen repaints, after its area is cleared.
+     */
+    virtual void renderChrome(Compositor& compositor) { (void)compositor; }
+
+    /**
+     * @brief Draw one item (bounds are already cleared)
+     *
+     * Bounds span the full item pitch (_itemHeight), including spacing.
+     */
+    virtual void renderItem(Compositor& compositor, int16_t index, const Rect& bounds) = 0;
+
+    /**
+     * @brief Repaint a single item on the next render()
+     */
+    void invalidateItem(int16_t index);
+
+    /**
+     * @brief Area repainted on a full redraw (default: below status bar)
+     */
+    virtual Rect getContentBounds() const;
+
     int16_t _itemHeight;
     int16_t _startY;
     int16_t _marginX;
@@ -240,8 +334,12 @@ private:
     int16_t _selectedIndex = 0;
     int16_t _prevSelectedIndex = 0;
 
+    DrawWidget _root;
+    std::vector<std::unique_ptr<DrawWidget>> _items;
+
     void moveSelection(int8_t direction);
     Rect rectForIndex(int16_t index) const;
+    void syncItems();
 };
 
 } // namespace paperhome
@@ -17,6 +17,23 @@ struct HueRoom {
     uint8_t brightness = 0;     // 0-100
     uint8_t lightCount = 0;
     bool reachable = true;
+
+    bool operator==(const HueRoom& other) const {
+        return id == other.id && name == other.name && isOn == other.isOn &&
+               brightness == other.brightness && lightCount == other.lightCount &&
+               reachable == other.reachable;
+    }
+    bool operator!=(const HueRoom& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Fixed-capacity room table (shared via SnapshotStore)
+ */
+struct HueRoomTable {
+    static constexpr size_t MAX_ROOMS = 12;
+
+    HueRoom rooms[MAX_ROOMS];
+    uint8_t count = 0;
 };
 
 /**
@@ -27,6 +44,8 @@ struct HueRoom {
  * - A toggles the selected room on/off
  * - LT/RT adjusts brightness
  *
+ * Each tile is a widget; a room update repaints only its tile.
+ *
  * Layout:
  * ┌─────────────────────────────────────────┐
  * │              Status Bar (40px)          │
@@ -48,16 +67,27 @@ public:
     HueDashboard();
 
     ScreenId getId() const override { return ScreenId::HUE_DASHBOARD; }
-    void render(Compositor& compositor) override;
     void onEnter() override;
 
     /**
      * @brief Update room data
      *
+     * Invalidates only tiles whose room changed (all if the count changed).
+     *
      * @param rooms Vector of room data to display
      */
     void setRooms(const std::vector<HueRoom>& rooms);
 
+    /**
+     * @brief Update room data from a table snapshot
+     *
+     * Returns immediately if generation is the one already shown.
+     *
+     * @param table Room table (only read during the call)
+     * @param generation Snapshot generation of table
+     */
+    void setRooms(const HueRoomTable& table, uint32_t generation);
+
     /**
      * @brief Get currently selected room
      *
@@ -86,9 +116,14 @@ protected:
     bool onConfirm() override;
     void onSelectionChanged() override;
     int16_t getItemCount() const override;
+    void renderChrome(Compositor& compositor) override;
+    void renderCell(Compositor& compositor, int16_t index, const Rect& bounds) override;
 
 private:
+    void applyRooms(const HueRoom* rooms, size_t count);
+
     std::vector<HueRoom> _rooms;
+    uint32_t _roomsGeneration = 0;
     RoomToggleCallback _onRoomToggle;
     BrightnessCallback _onBrightnessChange;
 
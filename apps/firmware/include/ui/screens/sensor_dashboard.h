@@ -61,11 +61,12 @@ public:
     SensorDashboard();
 
     ScreenId getId() const override { return ScreenId::SENSOR_DASHBOARD; }
-    void render(Compositor& compositor) override;
     void onEnter() override;
 
     /**
      * @brief Update sensor data
+     *
+     * Invalidates only panels whose displayed value, status or trend changed.
      */
     void setSensorData(const SensorData& data);
 
@@ -73,6 +74,8 @@ protected:
     bool onConfirm() override;
     void onSelectionChanged() override;
     int16_t getItemCount() const override { return 6; }  // 6 panels
+    void renderChrome(Compositor& compositor) override;
+    void renderCell(Compositor& compositor, int16_t index, const Rect& bounds) override;
 
 private:
     SensorData _data;
@@ -96,6 +99,11 @@ private:
     void renderPanel(Compositor& compositor, int16_t index, int16_t x, int16_t y);
     void renderPageIndicator(Compositor& compositor, int currentPage, int totalPages);
 
+    // Panel state
+    bool isConnected(int16_t index) const;
+    bool getTrend(int16_t index, float& current, float& previous) const;
+    void formatPanelKey(int16_t index, char* buffer, size_t size) const;
+
     // Value formatting
     void formatValue(int16_t index, char* buffer, size_t size) const;
     const char* getLabel(int16_t index) const;
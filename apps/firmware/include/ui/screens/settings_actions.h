@@ -28,7 +28,6 @@ public:
     SettingsActions();
 
     ScreenId getId() const override { return ScreenId::SETTINGS_ACTIONS; }
-    void render(Compositor& compositor) override;
     void onEnter() override;
 
     /**
@@ -40,6 +39,14 @@ public:
 protected:
     bool onConfirm() override;
     int16_t getItemCount() const override { return static_cast<int16_t>(DeviceAction::COUNT); }
+    void renderChrome(Compositor& compositor) override;
+    void renderItem(Compositor& compositor, int16_t index, const Rect& bounds) override;
+
+    // Settings header replaces the status bar
+    bool hasStatusBar() const override { return false; }
+    Rect getContentBounds() const override {
+        return Rect::full(config::display::WIDTH, config::display::HEIGHT);
+    }
 
 private:
     ActionCallback _onAction;
@@ -2,6 +2,7 @@
 
 #include "ui/screen.h"
 #include "core/config.h"
+#include "tado/tado_types.h"
 #include <vector>
 #include <string>
 
@@ -20,6 +21,38 @@ struct TadoZone {
     uint8_t heatingPower = 0;      // 0-100
     bool isAway = false;
     bool connected = true;
+
+    /**
+     * @brief What differs from shown, at the resolution it is drawn with
+     *
+     * Same rules as TadoService::getZoneChanges(). A different id, away
+     * or connection state counts as TADO_ZONE_ADDED (every field).
+     *
+     * @return TadoZoneField mask, 0 if the zone would look the same
+     */
+    uint8_t changesFrom(const TadoZone& shown) const {
+        if (id != shown.id || isAway != shown.isAway || connected != shown.connected) {
+            return TADO_ZONE_ADDED;
+        }
+
+        uint8_t mask = 0;
+        if (name != shown.name) mask |= TADO_ZONE_NAME;
+        if (tadoTenths(currentTemp) != tadoTenths(shown.currentTemp)) mask |= TADO_ZONE_CURRENT_TEMP;
+        if (tadoTenths(targetTemp) != tadoTenths(shown.targetTemp)) mask |= TADO_ZONE_TARGET_TEMP;
+        if (tadoPercent(humidity) != tadoPercent(shown.humidity)) mask |= TADO_ZONE_HUMIDITY;
+        if (heatingOn != shown.heatingOn || heatingPower != shown.heatingPower) mask |= TADO_ZONE_HEATING;
+        return mask;
+    }
+};
+
+/**
+ * @brief Fixed-capacity zone table (shared via SnapshotStore)
+ */
+struct TadoZoneTable {
+    static constexpr size_t MAX_ZONES = 8;
+
+    TadoZone zones[MAX_ZONES];
+    uint8_t count = 0;
 };
 
 /**
@@ -55,14 +88,23 @@ public:
     TadoControl();
 
     ScreenId getId() const override { return ScreenId::TADO_CONTROL; }
-    void render(Compositor& compositor) override;
     void onEnter() override;
 
     /**
      * @brief Update zone data
+     *
+     * Invalidates only zones that look different (TadoZone::changesFrom),
+     * all if the count changed.
      */
     void setZones(const std::vector<TadoZone>& zones);
 
+    /**
+     * @brief Update zone data from a table snapshot
+     *
+     * Returns immediately if generation is the one already shown.
+     */
+    void setZones(const TadoZoneTable& table, uint32_t generation);
+
     /**
      * @brief Get currently selected zone
      */
@@ -83,9 +125,14 @@ protected:
     bool onConfirm() override;
     void onSelectionChanged() override;
     int16_t getItemCount() const override;
+    void renderChrome(Compositor& compositor) override;
+    void renderItem(Compositor& compositor, int16_t index, const Rect& bounds) override;
 
 private:
+    void applyZones(const TadoZone* zones, size_t count);
+
     std::vector<TadoZone> _zones;
+    uint32_t _zonesGeneration = 0;
     TempCallback _onTempChange;
 
     // Layout constants (accounting for 32px status bar + title)
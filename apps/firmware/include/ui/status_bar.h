@@ -2,6 +2,7 @@
 
 #include "display/compositor.h"
 #include "core/config.h"
+#include "ui/theme.h"
 #include <cstdint>
 
 namespace paperhome {
@@ -46,7 +47,7 @@ struct StatusBarData {
  */
 class StatusBar {
 public:
-    static constexpr int16_t HEIGHT = 32;
+    static constexpr int16_t HEIGHT = theme::STATUS_BAR_HEIGHT;
     static constexpr int16_t Y = 0;
 
     /**
@@ -4,6 +4,12 @@
 
 namespace paperhome::theme {
 
+// =============================================================================
+// LAYOUT
+// =============================================================================
+
+constexpr int16_t STATUS_BAR_HEIGHT = 32;  // Status bar strip at top of screen
+
 // =============================================================================
 // BORDERS
 // =============================================================================
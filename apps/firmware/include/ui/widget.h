@@ -0,0 +1,141 @@
+#pragma once
+
+#include "display/compositor.h"
+#include "core/rect.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace paperhome {
+
+/**
+ * @brief Node in a retained widget tree
+ *
+ * Each node has bounds and two dirty bits: one for itself and one meaning
+ * "some descendant is dirty". render() walks only dirty paths:
+ * - A dirty node clears its bounds (if opaque), draws itself and repaints
+ *   its whole subtree
+ * - A clean node with dirty descendants just descends into them
+ *
+ * A data update therefore invalidates only the affected node, and the
+ * compositor sees draw calls (and dirty rects) for that subtree only.
+ *
+ * Children are not owned; they are usually members of the owning screen
+ * and must outlive the tree. Sibling bounds are expected not to overlap.
+ */
+class Widget {
+public:
+    Widget() = default;
+    explicit Widget(const Rect& bounds) : _bounds(bounds) {}
+    virtual ~Widget() = default;
+
+    Widget(const Widget&) = delete;
+    Widget& operator=(const Widget&) = delete;
+
+    // =========================================================================
+    // Tree
+    // =========================================================================
+
+    void addChild(Widget* child);
+    void clearChildren();
+
+    Widget* getParent() const { return _parent; }
+    size_t getChildCount() const { return _children.size(); }
+    Widget* getChild(size_t index) const { return _children[index]; }
+
+    // =========================================================================
+    // Properties
+    // =========================================================================
+
+    const Rect& getBounds() const { return _bounds; }
+
+    /**
+     * @brief Move/resize the node (repaints the parent if bounds change)
+     */
+    void setBounds(const Rect& bounds);
+
+    bool isVisible() const { return _visible; }
+    void setVisible(bool visible);
+
+    /**
+     * @brief Opaque nodes clear their bounds to white before drawing
+     */
+    bool isOpaque() const { return _opaque; }
+    void setOpaque(bool opaque) { _opaque = opaque; }
+
+    // =========================================================================
+    // Dirty Tracking
+    // =========================================================================
+
+    /**
+     * @brief Mark this node (and so its subtree) for repaint
+     */
+    void invalidate();
+
+    /**
+     * @brief Check if this node itself needs repaint
+     */
+    bool isDirty() const { return _dirty & DIRTY_SELF; }
+
+    /**
+     * @brief Check if this node or any descendant needs repaint
+     */
+    bool needsRender() const { return _dirty != 0; }
+
+    // =========================================================================
+    // Rendering
+    // =========================================================================
+
+    /**
+     * @brief Repaint dirty nodes in this subtree and clear their dirty bits
+     */
+    void render(Compositor& compositor);
+
+protected:
+    /**
+     * @brief Draw this node's own content (children are drawn after)
+     */
+    virtual void draw(Compositor& compositor) { (void)compositor; }
+
+private:
+    static constexpr uint8_t DIRTY_SELF = 1 << 0;
+    static constexpr uint8_t DIRTY_CHILDREN = 1 << 1;
+
+    Rect _bounds;
+    Widget* _parent = nullptr;
+    std::vector<Widget*> _children;
+    uint8_t _dirty = DIRTY_SELF;
+    bool _visible = true;
+    bool _opaque = true;
+
+    void markChildDirty();
+    void paint(Compositor& compositor);
+};
+
+/**
+ * @brief Widget whose content is drawn by a callback
+ *
+ * Lets screens keep their existing render helpers (renderTile etc.)
+ * while the tree handles dirty tracking.
+ */
+class DrawWidget : public Widget {
+public:
+    using DrawFn = std::function<void(Compositor& compositor, const Rect& bounds)>;
+
+    DrawWidget() = default;
+    explicit DrawWidget(DrawFn drawFn) : _drawFn(std::move(drawFn)) {}
+    DrawWidget(const Rect& bounds, DrawFn drawFn)
+        : Widget(bounds), _drawFn(std::move(drawFn)) {}
+
+    void setDrawFn(DrawFn drawFn) { _drawFn = std::move(drawFn); }
+
+protected:
+    void draw(Compositor& compositor) override {
+        if (_drawFn) _drawFn(compositor, getBounds());
+    }
+
+private:
+    DrawFn _drawFn;
+};
+
+} // namespace paperhome
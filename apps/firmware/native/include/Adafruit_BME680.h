@@ -0,0 +1,49 @@
+#pragma once
+
+// Host stand-in for the Adafruit BME680 driver (synthetic readings)
+
+#include <Wire.h>
+#include "host/sensors.h"
+
+#define BME680_OS_NONE 0
+#define BME680_OS_1X   1
+#define BME680_OS_2X   2
+#define BME680_OS_4X   3
+#define BME680_OS_8X   4
+#define BME680_OS_16X  5
+
+#define BME680_FILTER_SIZE_0   0
+#define BME680_FILTER_SIZE_1   1
+#define BME680_FILTER_SIZE_3   2
+#define BME680_FILTER_SIZE_7   3
+#define BME680_FILTER_SIZE_15  4
+
+class Adafruit_BME680 {
+public:
+    explicit Adafruit_BME680(TwoWire* = &Wire) {}
+
+    bool begin(uint8_t = 0x77, TwoWire* = &Wire) { return true; }
+
+    bool setTemperatureOversampling(uint8_t) { return true; }
+    bool setHumidityOversampling(uint8_t) { return true; }
+    bool setPressureOversampling(uint8_t) { return true; }
+    bool setIIRFilterSize(uint8_t) { return true; }
+    bool setGasHeater(uint16_t, uint16_t) { return true; }
+
+    unsigned long beginReading() { return millis() + 1; }
+
+    bool endReading() {
+        temperature = host::sensors::temperature();
+        humidity = host::sensors::humidity();
+        pressure = host::sensors::pressurePa();
+        gas_resistance = host::sensors::gasResistance();
+        return true;
+    }
+
+    bool performReading() { return endReading(); }
+
+    float temperature = 0;
+    float humidity = 0;
+    uint32_t pressure = 0;
+    uint32_t gas_resistance = 0;
+};
@@ -0,0 +1,433 @@
+#pragma once
+
+/**
+ * @file Adafruit_GFX.h
+ * @brief Host re-implementation of the Adafruit GFX drawing core
+ *
+ * Same primitive algorithms, rotation handling and custom-font text layout
+ * as Adafruit_GFX, without the SPI/BusIO dependencies, so frame timings on
+ * the host exercise the same per-pixel work as the device.
+ */
+
+#include <Arduino.h>
+#include <cstdlib>
+#include <utility>
+#include "gfxfont.h"
+
+class Adafruit_GFX : public Print {
+public:
+    Adafruit_GFX(int16_t w, int16_t h)
+        : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    // =========================================================================
+    // Primitives
+    // =========================================================================
+
+    virtual void startWrite() {}
+    virtual void endWrite() {}
+    virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+        for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, color);
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        for (int16_t i = x; i < x + w; i++) drawFastVLine(i, y, h, color);
+    }
+
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        if (x0 == x1) {
+            if (y0 > y1) std::swap(y0, y1);
+            drawFastVLine(x0, y0, y1 - y0 + 1, color);
+            return;
+        }
+        if (y0 == y1) {
+            if (x0 > x1) std::swap(x0, x1);
+            drawFastHLine(x0, y0, x1 - x0 + 1, color);
+            return;
+        }
+
+        bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+        if (steep) {
+            std::swap(x0, y0);
+            std::swap(x1, y1);
+        }
+        if (x0 > x1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+
+        int16_t dx = x1 - x0;
+        int16_t dy = std::abs(y1 - y0);
+        int16_t err = dx / 2;
+        int16_t ystep = (y0 < y1) ? 1 : -1;
+
+        for (; x0 <= x1; x0++) {
+            if (steep) writePixel(y0, x0, color);
+            else writePixel(x0, y0, color);
+            err -= dy;
+            if (err < 0) {
+                y0 += ystep;
+                err += dx;
+            }
+        }
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        drawFastHLine(x, y, w, color);
+        drawFastHLine(x, y + h - 1, w, color);
+        drawFastVLine(x, y, h, color);
+        drawFastVLine(x + w - 1, y, h, color);
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+
+        writePixel(x0, y0 + r, color);
+        writePixel(x0, y0 - r, color);
+        writePixel(x0 + r, y0, color);
+        writePixel(x0 - r, y0, color);
+
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+
+            writePixel(x0 + x, y0 + y, color);
+            writePixel(x0 - x, y0 + y, color);
+            writePixel(x0 + x, y0 - y, color);
+            writePixel(x0 - x, y0 - y, color);
+            writePixel(x0 + y, y0 + x, color);
+            writePixel(x0 - y, y0 + x, color);
+            writePixel(x0 + y, y0 - x, color);
+            writePixel(x0 - y, y0 - x, color);
+        }
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+        drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+        fillCircleHelper(x0, y0, r, 3, 0, color);
+    }
+
+    void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+        int16_t maxRadius = ((w < h) ? w : h) / 2;
+        if (r > maxRadius) r = maxRadius;
+        drawFastHLine(x + r, y, w - 2 * r, color);
+        drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+        drawFastVLine(x, y + r, h - 2 * r, color);
+        drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+        drawCircleHelper(x + r, y + r, r, 1, color);
+        drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+        drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+        drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+    }
+
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+        int16_t maxRadius = ((w < h) ? w : h) / 2;
+        if (r > maxRadius) r = maxRadius;
+        fillRect(x + r, y, w - 2 * r, h, color);
+        fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+        fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+    }
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+                    uint16_t color) {
+        int16_t byteWidth = (w + 7) / 8;
+        uint8_t b = 0;
+        for (int16_t j = 0; j < h; j++, y++) {
+            for (int16_t i = 0; i < w; i++) {
+                if (i & 7) b <<= 1;
+                else b = bitmap[j * byteWidth + i / 8];
+                if (b & 0x80) writePixel(x + i, y, color);
+            }
+        }
+    }
+
+    // =========================================================================
+    // Text
+    // =========================================================================
+
+    void setFont(const GFXfont* f) {
+        if (f && !_gfxFont) _cursorY += 6;
+        else if (!f && _gfxFont) _cursorY -= 6;
+        _gfxFont = const_cast<GFXfont*>(f);
+    }
+
+    void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+    void setTextColor(uint16_t c) { _textColor = _textBgColor = c; }
+    void setTextColor(uint16_t c, uint16_t bg) { _textColor = c; _textBgColor = bg; }
+    void setTextSize(uint8_t s) { _textSizeX = _textSizeY = s ? s : 1; }
+    void setTextWrap(bool w) { _wrap = w; }
+
+    int16_t getCursorX() const { return _cursorX; }
+    int16_t getCursorY() const { return _cursorY; }
+
+    size_t write(uint8_t c) override {
+        if (!_gfxFont) {
+            // Classic 6x8 cell; glyphs are not rendered on the host
+            if (c == '\n') {
+                _cursorX = 0;
+                _cursorY += _textSizeY * 8;
+            } else if (c != '\r') {
+                _cursorX += _textSizeX * 6;
+            }
+            return 1;
+        }
+
+        if (c == '\n') {
+            _cursorX = 0;
+            _cursorY += static_cast<int16_t>(_textSizeY) * _gfxFont->yAdvance;
+        } else if (c != '\r') {
+            uint8_t first = _gfxFont->first;
+            if (c >= first && c <= _gfxFont->last) {
+                const GFXglyph* glyph = &_gfxFont->glyph[c - first];
+                uint8_t w = glyph->width;
+                uint8_t h = glyph->height;
+                if (w > 0 && h > 0) {
+                    int16_t xo = glyph->xOffset;
+                    if (_wrap && ((_cursorX + _textSizeX * (xo + w)) > _width)) {
+                        _cursorX = 0;
+                        _cursorY += static_cast<int16_t>(_textSizeY) * _gfxFont->yAdvance;
+                    }
+                    drawChar(_cursorX, _cursorY, c, _textColor, _textBgColor, _textSizeX, _textSizeY);
+                }
+                _cursorX += glyph->xAdvance * static_cast<int16_t>(_textSizeX);
+            }
+        }
+        return 1;
+    }
+
+    using Print::write;
+
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t /*bg*/,
+                  uint8_t sizeX, uint8_t sizeY) {
+        if (!_gfxFont) return;
+
+        c -= _gfxFont->first;
+        const GFXglyph* glyph = &_gfxFont->glyph[c];
+        const uint8_t* bitmap = _gfxFont->bitmap;
+
+        uint16_t bo = glyph->bitmapOffset;
+        uint8_t w = glyph->width;
+        uint8_t h = glyph->height;
+        int8_t xo = glyph->xOffset;
+        int8_t yo = glyph->yOffset;
+        uint8_t bits = 0;
+        uint8_t bit = 0;
+
+        startWrite();
+        for (uint8_t yy = 0; yy < h; yy++) {
+            for (uint8_t xx = 0; xx < w; xx++) {
+                if (!(bit++ & 7)) bits = bitmap[bo++];
+                if (bits & 0x80) {
+                    if (sizeX == 1 && sizeY == 1) {
+                        writePixel(x + xo + xx, y + yo + yy, color);
+                    } else {
+                        fillRect(x + (xo + xx) * sizeX, y + (yo + yy) * sizeY, sizeX, sizeY, color);
+                    }
+                }
+                bits <<= 1;
+            }
+        }
+        endWrite();
+    }
+
+    void getTextBounds(const char* str, int16_t x, int16_t y,
+                       int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+        int16_t minx = _width, miny = _height, maxx = -1, maxy = -1;
+        *x1 = x;
+        *y1 = y;
+        *w = *h = 0;
+
+        uint8_t c;
+        while ((c = static_cast<uint8_t>(*str++))) {
+            charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+        }
+
+        if (maxx >= minx) {
+            *x1 = minx;
+            *w = maxx - minx + 1;
+        }
+        if (maxy >= miny) {
+            *y1 = miny;
+            *h = maxy - miny + 1;
+        }
+    }
+
+    void getTextBounds(const String& str, int16_t x, int16_t y,
+                       int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+        getTextBounds(str.c_str(), x, y, x1, y1, w, h);
+    }
+
+    // =========================================================================
+    // Geometry
+    // =========================================================================
+
+    virtual void setRotation(uint8_t r) {
+        _rotation = r & 3;
+        if (_rotation & 1) {
+            _width = HEIGHT;
+            _height = WIDTH;
+        } else {
+            _width = WIDTH;
+            _height = HEIGHT;
+        }
+    }
+
+    uint8_t getRotation() const { return _rotation; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+protected:
+    const int16_t WIDTH;
+    const int16_t HEIGHT;
+    int16_t _width;
+    int16_t _height;
+    int16_t _cursorX = 0;
+    int16_t _cursorY = 0;
+    uint16_t _textColor = 0xFFFF;
+    uint16_t _textBgColor = 0xFFFF;
+    uint8_t _textSizeX = 1;
+    uint8_t _textSizeY = 1;
+    uint8_t _rotation = 0;
+    bool _wrap = true;
+    GFXfont* _gfxFont = nullptr;
+
+private:
+    void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corner, uint16_t color) {
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (corner & 0x4) {
+                writePixel(x0 + x, y0 + y, color);
+                writePixel(x0 + y, y0 + x, color);
+            }
+            if (corner & 0x2) {
+                writePixel(x0 + x, y0 - y, color);
+                writePixel(x0 + y, y0 - x, color);
+            }
+            if (corner & 0x8) {
+                writePixel(x0 - y, y0 + x, color);
+                writePixel(x0 - x, y0 + y, color);
+            }
+            if (corner & 0x1) {
+                writePixel(x0 - y, y0 - x, color);
+                writePixel(x0 - x, y0 - y, color);
+            }
+        }
+    }
+
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta,
+                          uint16_t color) {
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+        int16_t px = x;
+        int16_t py = y;
+
+        delta++;
+
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (x < (y + 1)) {
+                if (corners & 1) drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+                if (corners & 2) drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+            }
+            if (y != py) {
+                if (corners & 1) drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+                if (corners & 2) drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    void charBounds(unsigned char c, int16_t* x, int16_t* y,
+                    int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy) {
+        if (!_gfxFont) {
+            if (c == '\n') {
+                *x = 0;
+                *y += _textSizeY * 8;
+            } else if (c != '\r') {
+                int16_t x2 = *x + _textSizeX * 6 - 1;
+                int16_t y2 = *y + _textSizeY * 8 - 1;
+                if (*x < *minx) *minx = *x;
+                if (*y < *miny) *miny = *y;
+                if (x2 > *maxx) *maxx = x2;
+                if (y2 > *maxy) *maxy = y2;
+                *x += _textSizeX * 6;
+            }
+            return;
+        }
+
+        if (c == '\n') {
+            *x = 0;
+            *y += _textSizeY * _gfxFont->yAdvance;
+            return;
+        }
+        if (c == '\r') return;
+
+        uint8_t first = _gfxFont->first;
+        if (c < first || c > _gfxFont->last) return;
+
+        const GFXglyph* glyph = &_gfxFont->glyph[c - first];
+        uint8_t gw = glyph->width;
+        uint8_t gh = glyph->height;
+        uint8_t xa = glyph->xAdvance;
+        int8_t xo = glyph->xOffset;
+        int8_t yo = glyph->yOffset;
+
+        if (_wrap && ((*x + ((xo + gw) * _textSizeX)) > _width)) {
+            *x = 0;
+            *y += _textSizeY * _gfxFont->yAdvance;
+        }
+
+        int16_t x1 = *x + xo * _textSizeX;
+        int16_t y1 = *y + yo * _textSizeY;
+        int16_t x2 = x1 + gw * _textSizeX - 1;
+        int16_t y2 = y1 + gh * _textSizeY - 1;
+        if (x1 < *minx) *minx = x1;
+        if (y1 < *miny) *miny = y1;
+        if (x2 > *maxx) *maxx = x2;
+        if (y2 > *maxy) *maxy = y2;
+        *x += xa * _textSizeX;
+    }
+};
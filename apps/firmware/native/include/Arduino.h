@@ -0,0 +1,169 @@
+#pragma once
+
+/**
+ * @file Arduino.h
+ * @brief Host stand-in for the ESP32 Arduino core
+ *
+ * Provides just enough of the Arduino API (String, Serial, timing, GPIO,
+ * ESP object) for the firmware core to compile and run on Linux under
+ * the PlatformIO `native` environment.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include "WString.h"
+#include "Print.h"
+#include "IPAddress.h"
+#include "host/clock.h"
+
+// =============================================================================
+// Constants
+// =============================================================================
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr)   (*(void* const*)(addr))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// =============================================================================
+// Timing
+// =============================================================================
+
+inline unsigned long millis() {
+    return static_cast<unsigned long>(host::clock::nowUs() / 1000);
+}
+
+inline unsigned long micros() {
+    return static_cast<unsigned long>(host::clock::nowUs());
+}
+
+/**
+ * @brief Advances virtual time without sleeping (see host/clock.h)
+ */
+inline void delay(uint32_t ms) {
+    host::clock::advanceMs(ms);
+}
+
+inline void delayMicroseconds(uint32_t) {}
+
+inline void yield() {}
+
+// =============================================================================
+// GPIO (no-op)
+// =============================================================================
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+inline uint16_t analogRead(uint8_t) { return 0; }
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+
+/**
+ * @brief Interrupts never fire on the host (no pins)
+ */
+inline void attachInterrupt(int, void (*)(), int) {}
+inline void detachInterrupt(int) {}
+
+// =============================================================================
+// Math helpers
+// =============================================================================
+
+template<typename T, typename L, typename H>
+inline T constrain(T value, L low, H high) {
+    return value < low ? static_cast<T>(low) : (value > high ? static_cast<T>(high) : value);
+}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+inline long random(long maxValue) { return maxValue > 0 ? std::rand() % maxValue : 0; }
+inline long random(long minValue, long maxValue) { return minValue + random(maxValue - minValue); }
+
+// =============================================================================
+// Serial
+// =============================================================================
+
+/**
+ * @brief stdout-backed serial port
+ *
+ * Benchmarks mute it so firmware debug logging doesn't dominate timings.
+ */
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    void flush() { fflush(stdout); }
+    operator bool() const { return true; }
+
+    void setMuted(bool muted) { _muted = muted; }
+    bool isMuted() const { return _muted; }
+
+    size_t write(uint8_t c) override {
+        if (_muted) return 1;
+        return fputc(c, stdout) == EOF ? 0 : 1;
+    }
+
+    size_t write(const uint8_t* buffer, size_t size) override {
+        if (_muted) return size;
+        return fwrite(buffer, 1, size, stdout);
+    }
+
+    using Print::write;
+
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+
+private:
+    bool _muted = false;
+};
+
+inline HardwareSerial Serial;
+
+// =============================================================================
+// ESP object
+// =============================================================================
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() const { return 256 * 1024; }
+    uint32_t getHeapSize() const { return 320 * 1024; }
+    uint32_t getMinFreeHeap() const { return 200 * 1024; }
+    uint32_t getPsramSize() const { return 8 * 1024 * 1024; }
+    uint32_t getFreePsram() const { return 8 * 1024 * 1024; }
+    uint32_t getCpuFreqMHz() const { return 240; }
+    const char* getChipModel() const { return "host"; }
+    uint64_t getEfuseMac() const { return 0x0000A1B2C3D4E5F6ULL; }
+    const char* getSdkVersion() const { return "native"; }
+
+    [[noreturn]] void restart() { std::exit(0); }
+};
+
+inline EspClass ESP;
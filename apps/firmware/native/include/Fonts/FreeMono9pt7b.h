@@ -0,0 +1,7 @@
+#pragma once
+
+// Host stand-in for Adafruit GFX FreeMono9pt7b (synthetic glyphs, same metrics)
+
+#include "host/font_maker.h"
+
+const GFXfont FreeMono9pt7b = host::fonts::make(9, host::fonts::MONO);
@@ -0,0 +1,7 @@
+#pragma once
+
+// Host stand-in for Adafruit GFX FreeMonoBold18pt7b (synthetic glyphs, same metrics)
+
+#include "host/font_maker.h"
+
+const GFXfont FreeMonoBold18pt7b = host::fonts::make(18, host::fonts::MONO_BOLD);
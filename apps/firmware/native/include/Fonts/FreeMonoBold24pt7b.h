@@ -0,0 +1,7 @@
+#pragma once
+
+// Host stand-in for Adafruit GFX FreeMonoBold24pt7b (synthetic glyphs, same metrics)
+
+#include "host/font_maker.h"
+
+const GFXfont FreeMonoBold24pt7b = host::fonts::make(24, host::fonts::MONO_BOLD);
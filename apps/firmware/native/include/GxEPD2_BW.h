@@ -0,0 +1,312 @@
+#pragma once
+
+/**
+ * @file GxEPD2_BW.h
+ * @brief Host stand-in for GxEPD2 black/white panels
+ *
+ * The panel driver models the controller RAM and the visible panel as two
+ * 1-bpp bitmaps in native orientation (MSB-first, 1 = white), with the same
+ * write/refresh API as the GxEPD2 driver classes. Refreshes complete
+ * instantly unless a simulated BUSY time is set (setBusyTime), in which
+ * case refresh() blocks like the real driver's wait on the BUSY pin,
+ * calling the busy callback while it waits. Counters record how many
+ * refreshes and pixels were pushed.
+ *
+ * GxEPD2_BW wraps a driver with a full-frame buffer and Adafruit GFX drawing,
+ * as in the real library.
+ */
+
+#include <Adafruit_GFX.h>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+/**
+ * @brief 4.26" 800x480 SSD1677 panel (GDEQ0426T82)
+ */
+class GxEPD2_426_GDEQ0426T82 {
+public:
+    static const uint16_t WIDTH = 800;
+    static const uint16_t WIDTH_VISIBLE = WIDTH;
+    static const uint16_t HEIGHT = 480;
+    static const bool hasPartialUpdate = true;
+    static const bool hasFastPartialUpdate = true;
+
+    GxEPD2_426_GDEQ0426T82(int16_t cs, int16_t dc, int16_t rst, int16_t busy)
+        : _cs(cs), _dc(dc), _rst(rst), _busy(busy)
+        , _ram(BYTES, 0xFF), _panel(BYTES, 0xFF) {}
+
+    void init(uint32_t /*serialBaud*/ = 0, bool /*initial*/ = true,
+              uint16_t /*resetDuration*/ = 10, bool /*pulldownRst*/ = false) {}
+
+    void hibernate() {}
+    void powerOff() {}
+
+    /**
+     * @brief Called repeatedly while waiting for BUSY (as in GxEPD2_EPD)
+     */
+    void setBusyCallback(void (*busyCallback)(const void*), const void* param = nullptr) {
+        _busyCallback = busyCallback;
+        _busyCallbackParam = param;
+    }
+
+    // =========================================================================
+    // Host-only BUSY simulation
+    // =========================================================================
+
+    /**
+     * @brief Simulated BUSY time per refresh, in real milliseconds (0 = instant)
+     */
+    void setBusyTime(uint32_t fullMs, uint32_t partialMs) {
+        _busyFullMs = fullMs;
+        _busyPartialMs = partialMs;
+    }
+
+    // =========================================================================
+    // Controller RAM writes (native coordinates, x aligned down to 8)
+    // =========================================================================
+
+    void writeScreenBuffer(uint8_t value = 0xFF) {
+        memset(_ram.data(), value, _ram.size());
+    }
+
+    void clearScreen(uint8_t value = 0xFF) {
+        writeScreenBuffer(value);
+        refresh(false);
+    }
+
+    void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                    bool invert = false, bool mirror_y = false, bool pgm = false) {
+        writeImagePart(bitmap, 0, 0, w, h, x, y, w, h, invert, mirror_y, pgm);
+    }
+
+    void writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                                  bool invert = false, bool mirror_y = false, bool pgm = false) {
+        writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+
+    void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                         bool invert = false, bool mirror_y = false, bool pgm = false) {
+        writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+
+    /**
+     * @brief Write window (x, y, w, h) from a part of a larger bitmap
+     */
+    void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part,
+                        int16_t w_bitmap, int16_t h_bitmap,
+                        int16_t x, int16_t y, int16_t w, int16_t h,
+                        bool invert = false, bool /*mirror_y*/ = false, bool /*pgm*/ = false) {
+        int16_t xs, ys, bw, rows;
+        if (!alignWindow(x, y, w, h, xs, ys, bw, rows)) return;
+        x_part -= (x - xs);
+
+        uint16_t srcStride = (w_bitmap + 7) / 8;
+        for (int16_t row = 0; row < rows; row++) {
+            if (y_part + row >= h_bitmap) break;
+            const uint8_t* src = bitmap + static_cast<uint32_t>(y_part + row) * srcStride + x_part / 8;
+            uint8_t* dst = &_ram[static_cast<uint32_t>(ys + row) * (WIDTH / 8) + xs / 8];
+            for (int16_t b = 0; b < bw; b++) {
+                dst[b] = invert ? static_cast<uint8_t>(~src[b]) : src[b];
+            }
+        }
+    }
+
+    void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part,
+                             int16_t w_bitmap, int16_t h_bitmap,
+                             int16_t x, int16_t y, int16_t w, int16_t h,
+                             bool invert = false, bool mirror_y = false, bool pgm = false) {
+        writeImagePart(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+
+    // =========================================================================
+    // Refresh (controller RAM -> visible panel)
+    // =========================================================================
+
+    void refresh(bool partial_update_mode = false) {
+        memcpy(_panel.data(), _ram.data(), _ram.size());
+        if (partial_update_mode) _partialRefreshes++;
+        else _fullRefreshes++;
+        _pixelsRefreshed += static_cast<uint64_t>(WIDTH) * HEIGHT;
+        waitWhileBusy(partial_update_mode ? _busyPartialMs : _busyFullMs);
+    }
+
+    void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+        int16_t xs, ys, bw, rows;
+        if (!alignWindow(x, y, w, h, xs, ys, bw, rows)) return;
+
+        for (int16_t row = 0; row < rows; row++) {
+            uint32_t offset = static_cast<uint32_t>(ys + row) * (WIDTH / 8) + xs / 8;
+            memcpy(&_panel[offset], &_ram[offset], bw);
+        }
+
+        _partialRefreshes++;
+        _pixelsRefreshed += static_cast<uint64_t>(bw) * 8 * rows;
+        waitWhileBusy(_busyPartialMs);
+    }
+
+    // =========================================================================
+    // Host-only inspection
+    // =========================================================================
+
+    const uint8_t* getPanelImage() const { return _panel.data(); }
+    uint32_t getFullRefreshCount() const { return _fullRefreshes; }
+    uint32_t getPartialRefreshCount() const { return _partialRefreshes; }
+    uint64_t getPixelsRefreshed() const { return _pixelsRefreshed; }
+
+    void resetCounters() {
+        _fullRefreshes = 0;
+        _partialRefreshes = 0;
+        _pixelsRefreshed = 0;
+    }
+
+private:
+    static const uint32_t BYTES = static_cast<uint32_t>(WIDTH / 8) * HEIGHT;
+
+    int16_t _cs, _dc, _rst, _busy;
+    std::vector<uint8_t> _ram;
+    std::vector<uint8_t> _panel;
+
+    uint32_t _fullRefreshes = 0;
+    uint32_t _partialRefreshes = 0;
+    uint64_t _pixelsRefreshed = 0;
+
+    void (*_busyCallback)(const void*) = nullptr;
+    const void* _busyCallbackParam = nullptr;
+    uint32_t _busyFullMs = 0;
+    uint32_t _busyPartialMs = 0;
+
+    void waitWhileBusy(uint32_t ms) {
+        if (ms == 0) return;
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (_busyCallback) {
+                _busyCallback(_busyCallbackParam);
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    /**
+     * @brief Clip to the panel and align x to byte boundaries (like GxEPD2)
+     */
+    static bool alignWindow(int16_t x, int16_t y, int16_t w, int16_t h,
+                            int16_t& xs, int16_t& ys, int16_t& bytesPerRow, int16_t& rows) {
+        if (x < 0) { w += x; x = 0; }
+        if (y < 0) { h += y; y = 0; }
+        if (x + w > WIDTH) w = WIDTH - x;
+        if (y + h > HEIGHT) h = HEIGHT - y;
+        if (w <= 0 || h <= 0) return false;
+
+        xs = x & ~7;
+        int16_t xe = (x + w + 7) & ~7;
+        ys = y;
+        bytesPerRow = (xe - xs) / 8;
+        rows = h;
+        return true;
+    }
+};
+
+/**
+ * @brief Full-frame buffered display (GxEPD2 paged API with one page)
+ */
+template<typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_BW : public Adafruit_GFX {
+public:
+    static const uint16_t WIDTH = GxEPD2_Type::WIDTH;
+    static const uint16_t HEIGHT = GxEPD2_Type::HEIGHT;
+
+    GxEPD2_Type epd2;
+
+    explicit GxEPD2_BW(GxEPD2_Type epd2_instance)
+        : Adafruit_GFX(GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT)
+        , epd2(epd2_instance)
+        , _buffer(static_cast<uint32_t>(WIDTH / 8) * page_height, 0xFF) {}
+
+    void init(uint32_t serialBaud = 0, bool initial = true,
+              uint16_t resetDuration = 10, bool pulldownRst = false) {
+        epd2.init(serialBaud, initial, resetDuration, pulldownRst);
+    }
+
+    void hibernate() { epd2.hibernate(); }
+    void powerOff() { epd2.powerOff(); }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (x < 0 || x >= width() || y < 0 || y >= height()) return;
+
+        switch (getRotation()) {
+            case 1:
+                std::swap(x, y);
+                x = WIDTH - x - 1;
+                break;
+            case 2:
+                x = WIDTH - x - 1;
+                y = HEIGHT - y - 1;
+                break;
+            case 3:
+                std::swap(x, y);
+                y = HEIGHT - y - 1;
+                break;
+        }
+
+        uint32_t i = x / 8 + static_cast<uint32_t>(y) * (WIDTH / 8);
+        if (color == GxEPD_WHITE) {
+            _buffer[i] |= (1 << (7 - x % 8));
+        } else {
+            _buffer[i] &= static_cast<uint8_t>(~(1 << (7 - x % 8)));
+        }
+    }
+
+    void fillScreen(uint16_t color) override {
+        memset(_buffer.data(), color == GxEPD_WHITE ? 0xFF : 0x00, _buffer.size());
+    }
+
+    void setFullWindow() { _usingPartialWindow = false; }
+
+    void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+        _usingPartialWindow = true;
+        _pwX = x;
+        _pwY = y;
+        _pwW = w;
+        _pwH = h;
+    }
+
+    void firstPage() {}
+
+    bool nextPage() {
+        if (_usingPartialWindow) displayWindow(_pwX, _pwY, _pwW, _pwH);
+        else display(false);
+        return false;
+    }
+
+    void display(bool partialUpdateMode = false) {
+        epd2.writeImage(_buffer.data(), 0, 0, WIDTH, page_height);
+        epd2.refresh(partialUpdateMode);
+        epd2.writeImageAgain(_buffer.data(), 0, 0, WIDTH, page_height);
+    }
+
+    void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+        int16_t nx, ny, nw, nh;
+        switch (getRotation()) {
+            case 1: nx = WIDTH - y - h; ny = x; nw = h; nh = w; break;
+            case 2: nx = WIDTH - x - w; ny = HEIGHT - y - h; nw = w; nh = h; break;
+            case 3: nx = y; ny = HEIGHT - x - w; nw = h; nh = w; break;
+            default: nx = x; ny = y; nw = w; nh = h; break;
+        }
+        epd2.writeImagePart(_buffer.data(), nx, ny, WIDTH, page_height, nx, ny, nw, nh);
+        epd2.refresh(nx, ny, nw, nh);
+        epd2.writeImagePartAgain(_buffer.data(), nx, ny, WIDTH, page_height, nx, ny, nw, nh);
+    }
+
+private:
+    std::vector<uint8_t> _buffer;
+
+    bool _usingPartialWindow = false;
+    uint16_t _pwX = 0, _pwY = 0, _pwW = 0, _pwH = 0;
+};
@@ -0,0 +1,266 @@
+#pragma once
+
+/**
+ * @file HTTPClient.h
+ * @brief Host stand-in for the ESP32 HTTPClient backed by in-process fixtures
+ *
+ * Requests never touch the network. Each request is matched against routes
+ * registered with host::http::on() (method + URL substring, newest first).
+ * Unmatched requests fail with HTTPC_ERROR_CONNECTION_REFUSED, like an
+ * unreachable host on the device.
+ *
+ * Connections are modelled like the ESP32 client: a request connects the
+ * WiFiClient unless it is still connected from an earlier keep-alive
+ * request (setReuse, default on). Connects and TLS handshakes are counted
+ * and timed by host::net (host/net.h). A response carrying
+ * "Connection: close" and ~HTTPClient drop the connection.
+ *
+ * The response body is delivered through the WiFiClient, so it can be read
+ * with getString() or straight from getStream(); end() discards what is
+ * left unread. A response with a stream (host/sse.h) has no length: its
+ * body is whatever the peer writes to the pipe until it closes.
+ */
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <chrono>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <strings.h>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#define HTTP_CODE_OK             200
+#define HTTP_CODE_NO_CONTENT     204
+#define HTTP_CODE_NOT_MODIFIED   304
+#define HTTP_CODE_BAD_REQUEST    400
+#define HTTP_CODE_UNAUTHORIZED   401
+#define HTTP_CODE_NOT_FOUND      404
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED      (-4)
+#define HTTPC_ERROR_CONNECTION_LOST    (-5)
+#define HTTPC_ERROR_READ_TIMEOUT       (-11)
+
+namespace host {
+namespace http {
+
+using Header = std::pair<String, String>;
+
+struct Request {
+    String method;
+    String url;
+    String body;
+    std::vector<Header> headers;
+
+    String header(const char* name) const {
+        for (const auto& h : headers) {
+            if (strcasecmp(h.first.c_str(), name) == 0) return h.second;
+        }
+        return String();
+    }
+};
+
+struct Response {
+    int code = HTTPC_ERROR_CONNECTION_REFUSED;
+    String body;
+    std::vector<Header> headers;
+    uint32_t latencyMs = 0;     ///< Real sleep before the response is returned
+    std::shared_ptr<host::net::Pipe> stream;   ///< Open-ended body written by the peer
+};
+
+using Handler = std::function<Response(const Request&)>;
+
+struct Route {
+    String method;
+    String urlContains;
+    Handler handler;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<Route> routes;
+    uint32_t requestCount = 0;
+    Request lastRequest;
+};
+
+inline Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+/**
+ * @brief Register a dynamic route
+ */
+inline void on(const char* method, const char* urlContains, Handler handler) {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    registry().routes.push_back({method, urlContains, std::move(handler)});
+}
+
+/**
+ * @brief Register a fixed response
+ */
+inline void on(const char* method, const char* urlContains, int code,
+               const String& body, uint32_t latencyMs = 0) {
+    Response response;
+    response.code = code;
+    response.body = body;
+    response.latencyMs = latencyMs;
+    on(method, urlContains, [response](const Request&) { return response; });
+}
+
+inline void clear() {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    registry().routes.clear();
+    registry().requestCount = 0;
+    host::net::reset();
+}
+
+inline uint32_t requestCount() {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    return registry().requestCount;
+}
+
+inline Request lastRequest() {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    return registry().lastRequest;
+}
+
+inline Response dispatch(const Request& request) {
+    Handler handler;
+    {
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        registry().requestCount++;
+        registry().lastRequest = request;
+        auto& routes = registry().routes;
+        for (auto it = routes.rbegin(); it != routes.rend(); ++it) {
+            if (it->method == request.method && request.url.indexOf(it->urlContains) >= 0) {
+                handler = it->handler;
+                break;
+            }
+        }
+    }
+    if (!handler) return Response();
+
+    Response response = handler(request);
+    if (response.latencyMs) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(response.latencyMs));
+    }
+    return response;
+}
+
+} // namespace http
+} // namespace host
+
+class HTTPClient {
+public:
+    HTTPClient() = default;
+    HTTPClient(const HTTPClient&) = delete;
+    HTTPClient& operator=(const HTTPClient&) = delete;
+
+    ~HTTPClient() {
+        if (_client) _client->stop();
+    }
+
+    bool begin(const String& url) {
+        return begin(_ownClient, url);
+    }
+
+    bool begin(WiFiClient& client, const String& url) {
+        // A different transport or host cannot reuse the open connection
+        String host = hostOf(url);
+        if (_client && (_client != &client || host != _host)) {
+            _client->stop();
+        }
+        _client = &client;
+        _host = host;
+
+        _request = host::http::Request();
+        _request.url = url;
+        _response = host::http::Response();
+        return true;
+    }
+
+    void end() {
+        if (_client) _client->flush();
+        if (_client && !_reuse) _client->stop();
+        _request = host::http::Request();
+    }
+
+    void setTimeout(uint16_t) {}
+    void setConnectTimeout(int32_t) {}
+    void setReuse(bool reuse) { _reuse = reuse; }
+    void useHTTP10(bool http10) { _reuse = !http10; }
+
+    void addHeader(const String& name, const String& value) {
+        _request.headers.emplace_back(name, value);
+    }
+
+    void collectHeaders(const char* [], size_t) {}
+
+    int GET() { return sendRequest("GET"); }
+    int POST(const String& body) { return sendRequest("POST", body); }
+    int POST(const uint8_t* payload, size_t size) {
+        return sendRequest("POST", String(std::string(reinterpret_cast<const char*>(payload), size)));
+    }
+    int PUT(const String& body) { return sendRequest("PUT", body); }
+
+    int sendRequest(const char* method, const String& body = String()) {
+        if (!_client) return HTTPC_ERROR_NOT_CONNECTED;
+        if (!_client->connected()) {
+            _client->connect(_host.c_str(), 0);
+        }
+        _client->write(reinterpret_cast<const uint8_t*>(method), strlen(method));
+
+        _request.method = method;
+        _request.body = body;
+        _response = host::http::dispatch(_request);
+        if (_response.stream) {
+            _client->attach(_response.stream);
+        } else if (_response.code > 0) {
+            _client->receive(_response.body.c_str(), _response.body.length());
+        }
+
+        if (_response.code < 0 ||
+            (!_response.stream && (!_reuse || header("Connection") == "close"))) {
+            _client->stop();
+        }
+        return _response.code;
+    }
+
+    String getString() { return _client ? _client->readAll() : String(); }
+    WiFiClient& getStream() { return *_client; }
+    int getSize() { return _response.stream ? -1 : static_cast<int>(_response.body.length()); }
+    bool connected() { return _client && _client->connected(); }
+
+    String header(const char* name) {
+        for (const auto& h : _response.headers) {
+            if (strcasecmp(h.first.c_str(), name) == 0) return h.second;
+        }
+        return String();
+    }
+
+    static String errorToString(int error) {
+        return error == HTTPC_ERROR_CONNECTION_REFUSED ? String("connection refused")
+                                                       : String("error ") + String(error);
+    }
+
+private:
+    static String hostOf(const String& url) {
+        int start = url.indexOf("://");
+        start = (start < 0) ? 0 : start + 3;
+        int end = url.indexOf('/', start);
+        return end < 0 ? url.substring(start) : url.substring(start, end);
+    }
+
+    WiFiClient _ownClient;
+    WiFiClient* _client = nullptr;
+    String _host;
+    host::http::Request _request;
+    host::http::Response _response;
+    bool _reuse = true;
+};
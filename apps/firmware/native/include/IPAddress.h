@@ -0,0 +1,35 @@
+#pragma once
+
+// Host stand-in for the Arduino IPAddress class
+
+#include <cstdint>
+#include <cstdio>
+#include "WString.h"
+
+class IPAddress {
+public:
+    IPAddress() : _bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+
+    uint8_t operator[](int i) const { return _bytes[i & 3]; }
+    bool operator==(const IPAddress& o) const {
+        return _bytes[0] == o._bytes[0] && _bytes[1] == o._bytes[1] &&
+               _bytes[2] == o._bytes[2] && _bytes[3] == o._bytes[3];
+    }
+
+    bool fromString(const char* s) {
+        unsigned a, b, c, d;
+        if (!s || sscanf(s, "%u.%u.%u.%u", &a, &b, &c, &d) != 4) return false;
+        _bytes[0] = a; _bytes[1] = b; _bytes[2] = c; _bytes[3] = d;
+        return true;
+    }
+
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+        return String(buf);
+    }
+
+private:
+    uint8_t _bytes[4];
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+// Host stand-in for ESP32 NVS Preferences (process-local, in-memory)
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* /*partition*/ = nullptr) {
+        if (!name) return false;
+        _ns = &store()[name];
+        _readOnly = readOnly;
+        return true;
+    }
+
+    void end() { _ns = nullptr; }
+
+    bool clear() {
+        if (!writable()) return false;
+        _ns->clear();
+        return true;
+    }
+
+    bool remove(const char* key) {
+        if (!writable()) return false;
+        return _ns->erase(key) > 0;
+    }
+
+    bool isKey(const char* key) const { return _ns && _ns->count(key); }
+
+    size_t putString(const char* key, const String& value) {
+        return putBytes(key, value.c_str(), value.length());
+    }
+
+    String getString(const char* key, const String& defaultValue = String()) const {
+        const Blob* blob = find(key);
+        return blob ? String(std::string(blob->begin(), blob->end())) : defaultValue;
+    }
+
+    size_t putInt(const char* key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+    int32_t getInt(const char* key, int32_t defaultValue = 0) const { return get(key, defaultValue); }
+
+    size_t putUInt(const char* key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0) const { return get(key, defaultValue); }
+
+    size_t putFloat(const char* key, float value) { return putBytes(key, &value, sizeof(value)); }
+    float getFloat(const char* key, float defaultValue = 0) const { return get(key, defaultValue); }
+
+    size_t putBool(const char* key, bool value) { return putBytes(key, &value, sizeof(value)); }
+    bool getBool(const char* key, bool defaultValue = false) const { return get(key, defaultValue); }
+
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        if (!writable() || !key) return 0;
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        (*_ns)[key] = Blob(bytes, bytes + len);
+        return len;
+    }
+
+    size_t getBytesLength(const char* key) const {
+        const Blob* blob = find(key);
+        return blob ? blob->size() : 0;
+    }
+
+    size_t getBytes(const char* key, void* buf, size_t maxLen) const {
+        const Blob* blob = find(key);
+        if (!blob || blob->size() > maxLen) return 0;
+        memcpy(buf, blob->data(), blob->size());
+        return blob->size();
+    }
+
+    /** @brief Host-only: wipe every namespace (between benchmark scenarios) */
+    static void resetAll() { store().clear(); }
+
+private:
+    using Blob = std::vector<uint8_t>;
+    using Namespace = std::map<std::string, Blob>;
+
+    Namespace* _ns = nullptr;
+    bool _readOnly = false;
+
+    static std::map<std::string, Namespace>& store() {
+        static std::map<std::string, Namespace> instance;
+        return instance;
+    }
+
+    bool writable() const { return _ns && !_readOnly; }
+
+    const Blob* find(const char* key) const {
+        if (!_ns || !key) return nullptr;
+        auto it = _ns->find(key);
+        return it == _ns->end() ? nullptr : &it->second;
+    }
+
+    template<typename T>
+    T get(const char* key, T defaultValue) const {
+        const Blob* blob = find(key);
+        if (!blob || blob->size() != sizeof(T)) return defaultValue;
+        T value;
+        memcpy(&value, blob->data(), sizeof(T));
+        return value;
+    }
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+// Host stand-in for the Sensirion STCC4 driver (synthetic readings)
+
+#include <Wire.h>
+#include "host/sensors.h"
+
+class SensirionI2cStcc4 {
+public:
+    void begin(TwoWire&, uint8_t) {}
+
+    int16_t startContinuousMeasurement() { _running = true; return 0; }
+    int16_t stopContinuousMeasurement() { _running = false; return 0; }
+
+    int16_t readMeasurement(int16_t& co2, float& temperature, float& humidity,
+                            uint16_t& status) {
+        if (!_running) return 4;
+        co2 = host::sensors::co2();
+        temperature = host::sensors::temperature();
+        humidity = host::sensors::humidity();
+        status = 0;
+        return 0;
+    }
+
+    int16_t performForcedRecalibration(int16_t, int16_t& correction) {
+        correction = 0;
+        return 0;
+    }
+
+private:
+    bool _running = false;
+};
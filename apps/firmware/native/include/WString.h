@@ -0,0 +1,162 @@
+#pragma once
+
+// Host stand-in for the Arduino String class (std::string backed)
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+class String {
+public:
+    String() = default;
+    String(const char* s) : _s(s ? s : "") {}
+    String(const std::string& s) : _s(s) {}
+    String(char c) : _s(1, c) {}
+    explicit String(bool b) : _s(b ? "1" : "0") {}
+    String(unsigned char v, unsigned char base = 10) { fromInt(v, base); }
+    String(int v, unsigned char base = 10) { fromInt(v, base); }
+    String(unsigned int v, unsigned char base = 10) { fromInt(v, base); }
+    String(long v, unsigned char base = 10) { fromInt(v, base); }
+    String(unsigned long v, unsigned char base = 10) { fromInt(v, base); }
+    String(long long v, unsigned char base = 10) { fromInt(v, base); }
+    String(unsigned long long v, unsigned char base = 10) { fromInt(v, base); }
+    String(float v, unsigned int decimals = 2) { fromFloat(v, decimals); }
+    String(double v, unsigned int decimals = 2) { fromFloat(v, decimals); }
+
+    String& operator=(const char* s) {
+        if (s) _s = s; else _s.clear();
+        return *this;
+    }
+
+    // Accessors
+    const char* c_str() const { return _s.c_str(); }
+    unsigned int length() const { return static_cast<unsigned int>(_s.size()); }
+    bool isEmpty() const { return _s.empty(); }
+    char charAt(unsigned int i) const { return i < _s.size() ? _s[i] : '\0'; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    bool reserve(unsigned int size) { _s.reserve(size); return true; }
+    const std::string& str() const { return _s; }
+
+    // Concatenation
+    bool concat(const String& s) { _s += s._s; return true; }
+    bool concat(const char* s) { if (!s) return false; _s += s; return true; }
+    bool concat(const char* s, unsigned int len) { if (!s) return false; _s.append(s, len); return true; }
+    bool concat(char c) { _s += c; return true; }
+    template<typename T>
+    bool concat(T v) { return concat(String(v)); }
+
+    template<typename T>
+    String& operator+=(const T& v) { concat(v); return *this; }
+
+    // Comparison
+    bool equals(const String& s) const { return _s == s._s; }
+    bool equals(const char* s) const { return _s == (s ? s : ""); }
+    bool operator==(const String& s) const { return equals(s); }
+    bool operator==(const char* s) const { return equals(s); }
+    bool operator!=(const String& s) const { return !equals(s); }
+    bool operator!=(const char* s) const { return !equals(s); }
+    bool operator<(const String& s) const { return _s < s._s; }
+    bool startsWith(const String& p) const { return _s.compare(0, p._s.size(), p._s) == 0; }
+    bool endsWith(const String& p) const {
+        return _s.size() >= p._s.size() &&
+               _s.compare(_s.size() - p._s.size(), p._s.size(), p._s) == 0;
+    }
+
+    // Search / slicing
+    int indexOf(char c, unsigned int from = 0) const { return find(_s.find(c, from)); }
+    int indexOf(const String& s, unsigned int from = 0) const { return find(_s.find(s._s, from)); }
+    int lastIndexOf(char c) const { return find(_s.rfind(c)); }
+    String substring(unsigned int from) const {
+        return from < _s.size() ? String(_s.substr(from)) : String();
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        if (from >= _s.size()) return String();
+        return String(_s.substr(from, to - from));
+    }
+
+    // Modification
+    void replace(const String& find, const String& with) {
+        if (find._s.empty()) return;
+        size_t pos = 0;
+        while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+            _s.replace(pos, find._s.size(), with._s);
+            pos += with._s.size();
+        }
+    }
+    void trim() {
+        size_t b = _s.find_first_not_of(" \t\r\n");
+        size_t e = _s.find_last_not_of(" \t\r\n");
+        _s = (b == std::string::npos) ? std::string() : _s.substr(b, e - b + 1);
+    }
+    void toLowerCase() { for (auto& c : _s) c = static_cast<char>(tolower(c)); }
+    void toUpperCase() { for (auto& c : _s) c = static_cast<char>(toupper(c)); }
+
+    // Conversion
+    long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(_s.c_str(), nullptr); }
+
+private:
+    std::string _s;
+
+    static int find(size_t pos) { return pos == std::string::npos ? -1 : static_cast<int>(pos); }
+
+    template<typename T>
+    void fromInt(T v, unsigned char base) {
+        if (base == 10) {
+            _s = std::to_string(v);
+            return;
+        }
+        char buf[72];
+        char* p = buf + sizeof(buf) - 1;
+        *p = '\0';
+        unsigned long long u = static_cast<unsigned long long>(v);
+        do {
+            unsigned d = static_cast<unsigned>(u % base);
+            *--p = static_cast<char>(d < 10 ? '0' + d : 'A' + d - 10);
+            u /= base;
+        } while (u);
+        _s = p;
+    }
+
+    void fromFloat(double v, unsigned int decimals) {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "%.*f", static_cast<int>(decimals), v);
+        _s = buf;
+    }
+};
+
+/**
+ * @brief Temporary type produced by String concatenation (ArduinoJson adapts it)
+ */
+class StringSumHelper : public String {
+public:
+    using String::String;
+    StringSumHelper(const String& s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String& a, const String& b) {
+    StringSumHelper r(a);
+    r.concat(b);
+    return r;
+}
+
+inline StringSumHelper operator+(const String& a, const char* b) {
+    StringSumHelper r(a);
+    r.concat(b);
+    return r;
+}
+
+inline StringSumHelper operator+(const char* a, const String& b) {
+    StringSumHelper r(a);
+    r.concat(b);
+    return r;
+}
+
+inline StringSumHelper operator+(const String& a, char c) {
+    StringSumHelper r(a);
+    r.concat(c);
+    return r;
+}
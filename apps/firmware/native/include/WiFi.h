@@ -0,0 +1,49 @@
+#pragma once
+
+// Host stand-in for the ESP32 WiFi station API (always associated)
+
+#include <Arduino.h>
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3
+} wifi_mode_t;
+
+class WiFiClass {
+public:
+    wl_status_t begin(const char* ssid, const char* /*password*/ = nullptr) {
+        _ssid = ssid ? ssid : "";
+        return _status;
+    }
+    bool disconnect(bool /*wifiOff*/ = false) { return true; }
+    bool mode(wifi_mode_t) { return true; }
+    bool setAutoReconnect(bool) { return true; }
+    bool setHostname(const char*) { return true; }
+
+    wl_status_t status() const { return _status; }
+    bool isConnected() const { return _status == WL_CONNECTED; }
+    int8_t RSSI() const { return -55; }
+    String SSID() const { return _ssid; }
+    IPAddress localIP() const { return IPAddress(192, 168, 1, 50); }
+    String macAddress() const { return String("A1:B2:C3:D4:E5:F6"); }
+
+    /** @brief Host-only: simulate link loss / recovery */
+    void setStatus(wl_status_t status) { _status = status; }
+
+private:
+    wl_status_t _status = WL_CONNECTED;
+    String _ssid = "host";
+};
+
+inline WiFiClass WiFi;
@@ -0,0 +1,100 @@
+#pragma once
+
+// Host stand-in for WiFiClient (transport handle consumed by HTTPClient)
+//
+// Bytes the peer sent are queued with receive() and read back through the
+// Stream interface; like lwIP, they stay readable after the peer closes.
+// A connection can instead be attached to a host::net::Pipe the peer keeps
+// writing to (server push).
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+#include "host/net.h"
+
+class WiFiClient : public Stream {
+public:
+    virtual ~WiFiClient() = default;
+
+    virtual int connect(const char*, uint16_t) { return open(false); }
+    virtual int connect(const IPAddress&, uint16_t) { return open(false); }
+    virtual void stop() {
+        _connected = false;
+        if (_pipe) {
+            _pipe->close();
+            _pipe.reset();
+        }
+    }
+    virtual uint8_t connected() {
+        if (_pipe) {
+            // Pushed data stays readable after the peer closes
+            if (_pipe->isClosed() && _pipe->available() == 0) _connected = false;
+        } else if (_connected && host::net::peerClosed(_lastUsedUs)) {
+            _connected = false;
+        }
+        return _connected ? 1 : 0;
+    }
+    operator bool() { return connected(); }
+
+    void setTimeout(unsigned long seconds) { _timeout = seconds * 1000; }
+    void setNoDelay(bool) {}
+
+    size_t write(uint8_t) override { touch(); return 1; }
+    size_t write(const uint8_t*, size_t size) override { touch(); return size; }
+    using Print::write;
+
+    int available() override {
+        if (_rxPos < _rx.size()) return static_cast<int>(_rx.size() - _rxPos);
+        return _pipe ? _pipe->available() : 0;
+    }
+    int read() override {
+        if (_rxPos < _rx.size()) return static_cast<uint8_t>(_rx[_rxPos++]);
+        return _pipe ? _pipe->read() : -1;
+    }
+    int peek() override {
+        if (_rxPos < _rx.size()) return static_cast<uint8_t>(_rx[_rxPos]);
+        return _pipe ? _pipe->peek() : -1;
+    }
+
+    // Discards received data, like the ESP32 client
+    void flush() override { _rx.clear(); _rxPos = 0; }
+
+    /**
+     * @brief Host only: queue bytes sent by the peer
+     */
+    void receive(const char* data, size_t size) {
+        if (_rxPos == _rx.size()) flush();
+        _rx.append(data, size);
+    }
+
+    /**
+     * @brief Host only: read further data from a peer that keeps writing
+     */
+    void attach(std::shared_ptr<host::net::Pipe> pipe) { _pipe = std::move(pipe); }
+
+    /**
+     * @brief Host only: read everything received so far
+     */
+    String readAll() {
+        String data(_rx.substr(_rxPos));
+        flush();
+        return data;
+    }
+
+protected:
+    int open(bool tls) {
+        host::net::connect(tls);
+        flush();
+        _connected = true;
+        touch();
+        return 1;
+    }
+
+    void touch() { _lastUsedUs = host::clock::nowUs(); }
+
+    bool _connected = false;
+    uint64_t _lastUsedUs = 0;
+    std::string _rx;
+    size_t _rxPos = 0;
+    std::shared_ptr<host::net::Pipe> _pipe;
+};
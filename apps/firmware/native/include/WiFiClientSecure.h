@@ -0,0 +1,16 @@
+#pragma once
+
+// Host stand-in for WiFiClientSecure (no TLS on the host; handshakes are
+// counted and timed by host::net)
+
+#include <WiFiClient.h>
+
+class WiFiClientSecure : public WiFiClient {
+public:
+    int connect(const char*, uint16_t) override { return open(true); }
+    int connect(const IPAddress&, uint16_t) override { return open(true); }
+
+    void setInsecure() {}
+    void setCACert(const char*) {}
+    void setHandshakeTimeout(unsigned long) {}
+};
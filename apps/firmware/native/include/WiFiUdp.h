@@ -0,0 +1,30 @@
+#pragma once
+
+// Host stand-in for WiFiUDP (sends nothing, never receives)
+
+#include <Arduino.h>
+
+class WiFiUDP : public Stream {
+public:
+    uint8_t begin(uint16_t) { return 1; }
+    uint8_t beginMulticast(const IPAddress&, uint16_t) { return 1; }
+    void stop() {}
+
+    int beginPacket(const IPAddress&, uint16_t) { return 1; }
+    int beginPacket(const char*, uint16_t) { return 1; }
+    int endPacket() { return 1; }
+    int parsePacket() { return 0; }
+
+    size_t write(uint8_t) override { return 1; }
+    size_t write(const uint8_t*, size_t size) override { return size; }
+    using Print::write;
+
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int read(char*, size_t) { return 0; }
+    int read(uint8_t*, size_t) { return 0; }
+    int peek() override { return -1; }
+
+    IPAddress remoteIP() const { return IPAddress(); }
+    uint16_t remotePort() const { return 0; }
+};
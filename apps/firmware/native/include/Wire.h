@@ -0,0 +1,21 @@
+#pragma once
+
+// Host stand-in for the Arduino I2C bus (no devices attached)
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+    bool begin(int /*sda*/ = -1, int /*scl*/ = -1, uint32_t /*frequency*/ = 0) { return true; }
+    bool end() { return true; }
+    bool setClock(uint32_t) { return true; }
+
+    void beginTransmission(uint8_t) {}
+    uint8_t endTransmission(bool /*sendStop*/ = true) { return 0; }
+    uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+    size_t write(uint8_t) { return 1; }
+    int available() { return 0; }
+    int read() { return -1; }
+};
+
+inline TwoWire Wire;
@@ -0,0 +1,31 @@
+#pragma once
+
+// Host stand-in for ESP-IDF capability-based heap allocation
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#define MALLOC_CAP_EXEC     (1 << 0)
+#define MALLOC_CAP_32BIT    (1 << 1)
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+inline void* heap_caps_malloc(size_t size, uint32_t /*caps*/) {
+    return std::malloc(size);
+}
+
+inline void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t /*caps*/) {
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+inline void heap_caps_free(void* ptr) {
+    std::free(ptr);
+}
+
+inline size_t heap_caps_get_free_size(uint32_t caps) {
+    return (caps & MALLOC_CAP_SPIRAM) ? 8 * 1024 * 1024 : 256 * 1024;
+}
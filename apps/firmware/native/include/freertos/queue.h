@@ -0,0 +1,121 @@
+#pragma once
+
+// Host stand-in for FreeRTOS queues (fixed-size item copies, blocking with timeout)
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+
+struct HostQueue {
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::vector<uint8_t> storage;
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    UBaseType_t head = 0;
+    UBaseType_t count = 0;
+
+    HostQueue(UBaseType_t len, UBaseType_t size)
+        : storage(static_cast<size_t>(len) * size), length(len), itemSize(size) {}
+
+    uint8_t* slot(UBaseType_t index) {
+        return storage.data() + static_cast<size_t>(index % length) * itemSize;
+    }
+
+    template<typename Pred>
+    bool wait(std::unique_lock<std::mutex>& lock, std::condition_variable& cv,
+              TickType_t ticks, Pred pred) {
+        if (ticks == portMAX_DELAY) {
+            cv.wait(lock, pred);
+            return true;
+        }
+        return cv.wait_for(lock, std::chrono::milliseconds(ticks), pred);
+    }
+
+    BaseType_t send(const void* item, TickType_t ticks, bool toFront) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!wait(lock, notFull, ticks, [this] { return count < length; })) {
+            return pdFALSE;
+        }
+        if (toFront) {
+            head = (head + length - 1) % length;
+            memcpy(slot(head), item, itemSize);
+        } else {
+            memcpy(slot(head + count), item, itemSize);
+        }
+        count++;
+        notEmpty.notify_one();
+        return pdTRUE;
+    }
+
+    BaseType_t receive(void* item, TickType_t ticks, bool peek) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!wait(lock, notEmpty, ticks, [this] { return count > 0; })) {
+            return pdFALSE;
+        }
+        memcpy(item, slot(head), itemSize);
+        if (!peek) {
+            head = (head + 1) % length;
+            count--;
+            notFull.notify_one();
+        }
+        return pdTRUE;
+    }
+};
+
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    return new HostQueue(length, itemSize);
+}
+
+inline void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    return queue->send(item, ticks, false);
+}
+
+inline BaseType_t xQueueSendToBack(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    return queue->send(item, ticks, false);
+}
+
+inline BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    return queue->send(item, ticks, true);
+}
+
+inline BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* woken) {
+    if (woken) *woken = pdFALSE;
+    return queue->send(item, 0, false);
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    return queue->receive(item, ticks, false);
+}
+
+inline BaseType_t xQueuePeek(QueueHandle_t queue, void* item, TickType_t ticks) {
+    return queue->receive(item, ticks, true);
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return queue->count;
+}
+
+inline UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return queue->length - queue->count;
+}
+
+inline BaseType_t xQueueReset(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->head = 0;
+    queue->count = 0;
+    queue->notFull.notify_all();
+    return pdPASS;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// Host stand-in for FreeRTOS tasks (detached std::thread per task)
+
+#include <chrono>
+#include <thread>
+#include "freertos/FreeRTOS.h"
+#include "host/clock.h"
+
+typedef void (*TaskFunction_t)(void*);
+typedef std::thread* TaskHandle_t;
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* /*name*/,
+                                          uint32_t /*stackDepth*/, void* param,
+                                          UBaseType_t /*priority*/, TaskHandle_t* handle,
+                                          BaseType_t /*core*/) {
+    auto* thread = new std::thread(fn, param);
+    thread->detach();
+    if (handle) *handle = thread;
+    return pdPASS;
+}
+
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                              void* param, UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, handle, 0);
+}
+
+/**
+ * @brief No-op: the thread ends when its task function returns
+ */
+inline void vTaskDelete(TaskHandle_t) {}
+
+/**
+ * @brief Real sleep: tasks are threads and must yield the CPU
+ */
+inline void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+inline TickType_t xTaskGetTickCount() {
+    return static_cast<TickType_t>(host::clock::nowUs() / 1000);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace host {
+
+/**
+ * @brief Host time source behind millis()/micros()/delay()
+ *
+ * Wall-clock time since process start plus a virtual offset.
+ * delay() only advances the offset, so firmware code that waits
+ * (display power-up, sensor settle) costs nothing on the host while
+ * interval logic (poll timers, warmup) still sees time pass.
+ *
+ * Benchmarks fast-forward hours of firmware time with advanceMs().
+ * Checks that need exact times freeze() the wall-clock part.
+ */
+namespace clock {
+
+inline std::atomic<uint64_t>& offsetUs() {
+    static std::atomic<uint64_t> offset{0};
+    return offset;
+}
+
+inline std::atomic<int64_t>& frozenUs() {
+    static std::atomic<int64_t> frozen{-1};    // Wall-clock part while frozen, -1 = running
+    return frozen;
+}
+
+inline uint64_t wallSinceStartUs() {
+    static const auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+inline uint64_t nowUs() {
+    const int64_t frozen = frozenUs();
+    return (frozen >= 0 ? static_cast<uint64_t>(frozen) : wallSinceStartUs()) + offsetUs();
+}
+
+/**
+ * @brief Stop (or resume) wall-clock time: only advanceMs() moves the clock
+ */
+inline void freeze(bool frozen) {
+    frozenUs() = frozen ? static_cast<int64_t>(wallSinceStartUs()) : -1;
+}
+
+inline void advanceMs(uint32_t ms) {
+    offsetUs() += static_cast<uint64_t>(ms) * 1000;
+}
+
+/**
+ * @brief Monotonic nanoseconds for benchmark timing (no virtual offset)
+ */
+inline uint64_t wallNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace clock
+} // namespace host
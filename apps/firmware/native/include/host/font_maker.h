@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "gfxfont.h"
+
+namespace host {
+
+/**
+ * @brief Synthetic stand-ins for the Adafruit FreeFonts
+ *
+ * The real FreeFont headers are GPL-licensed bitmaps shipped with Adafruit
+ * GFX. On the host we generate fonts with the same point-size metrics
+ * (advance, line height, cap height) and glyph bitmaps of similar ink
+ * density, so layout, text bounds and rasterization cost match the device
+ * closely without vendoring the font data.
+ */
+namespace fonts {
+
+enum Family : uint8_t {
+    MONO,
+    MONO_BOLD,
+    SANS,
+    SANS_BOLD
+};
+
+inline bool hasDescender(char c) {
+    return c == 'g' || c == 'j' || c == 'p' || c == 'q' || c == 'y' || c == ',' || c == ';';
+}
+
+inline GFXfont build(uint8_t pt, Family family) {
+    const bool mono = family == MONO || family == MONO_BOLD;
+    const bool bold = family == MONO_BOLD || family == SANS_BOLD;
+
+    const int capHeight = static_cast<int>(std::lround(pt * 1.4));
+    const int xHeight = static_cast<int>(std::lround(capHeight * 0.73));
+    const int descent = static_cast<int>(std::lround(capHeight * 0.3));
+    const int advance = static_cast<int>(std::lround(pt * (mono ? 1.17 : 1.1))) + (bold ? 1 : 0);
+
+    auto* glyphs = new GFXglyph[0x7E - 0x20 + 1];
+    std::vector<uint8_t> bitmap;
+
+    for (int c = 0x20; c <= 0x7E; c++) {
+        GFXglyph& g = glyphs[c - 0x20];
+        g.bitmapOffset = static_cast<uint16_t>(bitmap.size());
+        g.xAdvance = static_cast<uint8_t>(advance);
+
+        if (c == ' ') {
+            g.width = g.height = 0;
+            g.xOffset = g.yOffset = 0;
+            continue;
+        }
+
+        bool lower = c >= 'a' && c <= 'z';
+        bool punct = !lower && !(c >= 'A' && c <= 'Z') && !(c >= '0' && c <= '9');
+        int w = punct ? advance / 2 : advance - 2;
+        int h = lower ? xHeight : capHeight;
+        if (punct && (c == '.' || c == ',' || c == '-' || c == '_')) h = capHeight / 5 + 1;
+        int yOffset = (c == '-') ? -xHeight / 2 : -h;
+        if (hasDescender(static_cast<char>(c))) h += descent;
+        if (c == '_') yOffset = descent / 2;
+
+        g.width = static_cast<uint8_t>(w < 1 ? 1 : w);
+        g.height = static_cast<uint8_t>(h < 1 ? 1 : h);
+        g.xOffset = 1;
+        g.yOffset = static_cast<int8_t>(yOffset);
+
+        // Stroke-like pattern: outline plus deterministic interior ink
+        uint32_t seed = static_cast<uint32_t>(c) * 2654435761u;
+        uint8_t acc = 0;
+        int bits = 0;
+        for (int yy = 0; yy < g.height; yy++) {
+            for (int xx = 0; xx < g.width; xx++) {
+                seed = seed * 1103515245u + 12345u;
+                bool edge = xx == 0 || yy == 0 || xx == g.width - 1 || yy == g.height - 1;
+                bool ink = edge ? ((seed >> 16) & 3) != 0 : ((seed >> 16) % 100) < (bold ? 40u : 25u);
+                acc = static_cast<uint8_t>((acc << 1) | (ink ? 1 : 0));
+                if (++bits == 8) {
+                    bitmap.push_back(acc);
+                    acc = 0;
+                    bits = 0;
+                }
+            }
+        }
+        if (bits) bitmap.push_back(static_cast<uint8_t>(acc << (8 - bits)));
+    }
+
+    auto* data = new uint8_t[bitmap.size()];
+    std::copy(bitmap.begin(), bitmap.end(), data);
+
+    GFXfont font;
+    font.bitmap = data;
+    font.glyph = glyphs;
+    font.first = 0x20;
+    font.last = 0x7E;
+    font.yAdvance = static_cast<uint8_t>(std::lround(pt * (mono ? 1.96 : 2.33)));
+    return font;
+}
+
+/**
+ * @brief Get (and cache) the synthetic font for a size/family
+ */
+inline GFXfont make(uint8_t pt, Family family) {
+    static std::map<int, GFXfont> cache;
+    int key = pt * 4 + family;
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        it = cache.emplace(key, build(pt, family)).first;
+    }
+    return it->second;
+}
+
+} // namespace fonts
+} // namespace host
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "host/clock.h"
+
+namespace host {
+
+/**
+ * @brief Transport model behind the WiFiClient/WiFiClientSecure stand-ins
+ *
+ * Counts TCP connects and TLS handshakes and can give each a real delay,
+ * so connection reuse shows up in benchmark timings. A peer idle timeout
+ * (firmware time) closes kept-alive connections like a server would.
+ */
+namespace net {
+
+struct Model {
+    std::atomic<uint32_t> connects{0};
+    std::atomic<uint32_t> handshakes{0};
+    std::atomic<uint32_t> connectLatencyMs{0};
+    std::atomic<uint32_t> handshakeLatencyMs{0};
+    std::atomic<uint32_t> peerIdleTimeoutMs{0};     // 0 = peer never closes
+};
+
+inline Model& model() {
+    static Model instance;
+    return instance;
+}
+
+inline void reset() {
+    model().connects = 0;
+    model().handshakes = 0;
+    model().connectLatencyMs = 0;
+    model().handshakeLatencyMs = 0;
+    model().peerIdleTimeoutMs = 0;
+}
+
+/**
+ * @brief Real sleep per TCP connect
+ */
+inline void setConnectLatency(uint32_t ms) { model().connectLatencyMs = ms; }
+
+/**
+ * @brief Real sleep per full TLS handshake (on top of the TCP connect)
+ */
+inline void setHandshakeLatency(uint32_t ms) { model().handshakeLatencyMs = ms; }
+
+/**
+ * @brief Peer closes connections idle for this long (firmware time)
+ */
+inline void setPeerIdleTimeout(uint32_t ms) { model().peerIdleTimeoutMs = ms; }
+
+inline uint32_t connectCount() { return model().connects; }
+inline uint32_t handshakeCount() { return model().handshakes; }
+
+/**
+ * @brief Count a connect (and handshake) and sleep for its cost
+ */
+inline void connect(bool tls) {
+    model().connects++;
+    uint32_t ms = model().connectLatencyMs;
+    if (tls) {
+        model().handshakes++;
+        ms += model().handshakeLatencyMs;
+    }
+    if (ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+}
+
+/**
+ * @brief Whether the peer has closed a connection last used at lastUsedUs
+ */
+inline bool peerClosed(uint64_t lastUsedUs) {
+    uint32_t timeoutMs = model().peerIdleTimeoutMs;
+    return timeoutMs && clock::nowUs() - lastUsedUs > static_cast<uint64_t>(timeoutMs) * 1000;
+}
+
+/**
+ * @brief Open byte stream from a simulated peer (server push)
+ *
+ * The peer side writes and closes from any thread; the WiFiClient it is
+ * attached to reads it. Either side closing ends the connection.
+ */
+class Pipe {
+public:
+    void write(const char* data, size_t size) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_closed) _data.append(data, size);
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+    }
+
+    bool isClosed() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _closed;
+    }
+
+    int available() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return static_cast<int>(_data.size() - _pos);
+    }
+
+    int read() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_pos == _data.size()) return -1;
+        int c = static_cast<uint8_t>(_data[_pos++]);
+        if (_pos == _data.size()) {
+            _data.clear();
+            _pos = 0;
+        }
+        return c;
+    }
+
+    int peek() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _pos < _data.size() ? static_cast<uint8_t>(_data[_pos]) : -1;
+    }
+
+private:
+    std::mutex _mutex;
+    std::string _data;
+    size_t _pos = 0;
+    bool _closed = false;
+};
+
+} // namespace net
+} // namespace host
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace host {
+
+/**
+ * @brief Minimal 1-bit grayscale PNG writer for golden images
+ *
+ * Writes uncompressed (stored) deflate blocks, so there is no zlib
+ * dependency; a 480x800 frame is ~48 KB. Output is byte-for-byte
+ * deterministic for identical pixels, so dumps can be diffed directly.
+ */
+namespace png {
+
+inline uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc = 0) {
+    static uint32_t table[256];
+    static bool init = false;
+    if (!init) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+        init = true;
+    }
+
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+inline void putU32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(value >> 24);
+    out.push_back(value >> 16);
+    out.push_back(value >> 8);
+    out.push_back(value);
+}
+
+inline void putChunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data) {
+    putU32(out, static_cast<uint32_t>(data.size()));
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    putU32(out, crc32(out.data() + start, out.size() - start));
+}
+
+/**
+ * @brief Write a 1-bpp image (MSB-first rows, 1 = white)
+ *
+ * @param rows width x height pixels, stride bytes per row
+ * @return true if the file was written
+ */
+inline bool writeGray1(const char* path, uint32_t width, uint32_t height,
+                       const uint8_t* rows, size_t stride) {
+    const size_t rowBytes = (width + 7) / 8;
+
+    // Raw scanlines: filter byte 0 + packed pixels
+    std::vector<uint8_t> raw;
+    raw.reserve((rowBytes + 1) * height);
+    for (uint32_t y = 0; y < height; y++) {
+        raw.push_back(0);
+        raw.insert(raw.end(), rows + y * stride, rows + y * stride + rowBytes);
+    }
+
+    // zlib stream of stored blocks
+    std::vector<uint8_t> z = {0x78, 0x01};
+    for (size_t pos = 0; pos < raw.size() || pos == 0; ) {
+        size_t len = std::min<size_t>(65535, raw.size() - pos);
+        bool last = pos + len >= raw.size();
+        z.push_back(last ? 1 : 0);
+        z.push_back(len & 0xFF);
+        z.push_back(len >> 8);
+        z.push_back(~len & 0xFF);
+        z.push_back((~len >> 8) & 0xFF);
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + len);
+        pos += len;
+        if (last) break;
+    }
+    uint32_t a = 1, b = 0;
+    for (uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    putU32(z, (b << 16) | a);
+
+    std::vector<uint8_t> ihdr;
+    putU32(ihdr, width);
+    putU32(ihdr, height);
+    ihdr.insert(ihdr.end(), {1, 0, 0, 0, 0});  // 1-bit grayscale
+
+    std::vector<uint8_t> out = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    putChunk(out, "IHDR", ihdr);
+    putChunk(out, "IDAT", z);
+    putChunk(out, "IEND", {});
+
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+    bool ok = fwrite(out.data(), 1, out.size(), file) == out.size();
+    return fclose(file) == 0 && ok;
+}
+
+} // namespace png
+} // namespace host
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include "host/clock.h"
+
+namespace host {
+
+/**
+ * @brief Deterministic synthetic environment for the sensor stand-ins
+ *
+ * Slow sinusoids over virtual time so history buffers and statistics see
+ * realistic, non-constant data.
+ */
+namespace sensors {
+
+inline double phase(double periodMinutes) {
+    double minutes = static_cast<double>(clock::nowUs()) / 60e6;
+    return std::sin(minutes * 2.0 * M_PI / periodMinutes);
+}
+
+inline int16_t co2() { return static_cast<int16_t>(650 + 250 * phase(90)); }
+inline float temperature() { return static_cast<float>(21.5 + 1.5 * phase(240)); }
+inline float humidity() { return static_cast<float>(45.0 + 8.0 * phase(180)); }
+inline float pressurePa() { return static_cast<float>(101325.0 + 300.0 * phase(600)); }
+inline uint32_t gasResistance() { return static_cast<uint32_t>(120000 + 30000 * phase(60)); }
+
+} // namespace sensors
+} // namespace host
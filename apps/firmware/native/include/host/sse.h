@@ -0,0 +1,101 @@
+#pragma once
+
+/**
+ * @file sse.h
+ * @brief Local server-sent events endpoint for the HTTPClient stand-in
+ *
+ * Registers a GET route that answers 200 text/event-stream and keeps the
+ * connection open; events pushed afterwards reach the client as they
+ * would from the bridge. drop() closes the open connection (the client
+ * sees the stream end); refuse() makes new connections fail.
+ *
+ * Usage:
+ *   host::sse::Server bridge("/eventstream/clip/v2");
+ *   bridge.push("[{\"type\":\"update\",\"data\":[...]}]");
+ *   bridge.drop();
+ */
+
+#include <HTTPClient.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace host {
+namespace sse {
+
+class Server {
+public:
+    explicit Server(const char* path) : _state(std::make_shared<State>()) {
+        std::shared_ptr<State> state = _state;
+        http::on("GET", path, [state](const http::Request&) {
+            http::Response response;
+            if (state->refusing) {
+                response.code = 503;
+                return response;
+            }
+            response.code = HTTP_CODE_OK;
+            response.headers.emplace_back("Content-Type", "text/event-stream");
+            response.stream = std::make_shared<net::Pipe>();
+            response.stream->write(": hi\n\n", 6);
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->pipe) state->pipe->close();
+            state->pipe = response.stream;
+            state->connects++;
+            return response;
+        });
+    }
+
+    /**
+     * @brief Send one event ("data: <json>") on the open connection
+     * @return false if no client is connected
+     */
+    bool push(const String& data) {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        if (!_state->pipe || _state->pipe->isClosed()) return false;
+
+        std::string event = "id: " + std::to_string(++_state->events) + ":0\ndata: ";
+        event += data.c_str();
+        event += "\n\n";
+        _state->pipe->write(event.data(), event.size());
+        return true;
+    }
+
+    /**
+     * @brief Close the open connection
+     */
+    void drop() {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        if (_state->pipe) _state->pipe->close();
+        _state->pipe.reset();
+    }
+
+    /**
+     * @brief Refuse (503) new connections until called with false
+     */
+    void refuse(bool refusing) { _state->refusing = refusing; }
+
+    bool isConnected() {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        return _state->pipe && !_state->pipe->isClosed();
+    }
+
+    uint32_t connects() {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        return _state->connects;
+    }
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::shared_ptr<net::Pipe> pipe;
+        std::atomic<bool> refusing{false};
+        uint32_t connects = 0;
+        uint32_t events = 0;
+    };
+
+    std::shared_ptr<State> _state;
+};
+
+} // namespace sse
+} // namespace host
@@ -0,0 +1,309 @@
+#include "connectivity/http_connection.h"
+
+namespace paperhome {
+
+namespace {
+
+/**
+ * @brief Response body as a Stream: the next `remaining` bytes of the
+ * connection, or a buffer already read in full
+ *
+ * Connection bytes are pulled in small blocks rather than one read per
+ * character, which is how the JSON parser consumes them.
+ */
+class BodyStream : public Stream {
+public:
+    BodyStream(Stream& source, size_t size)
+        : _source(&source), _data(nullptr), _remaining(size), _pos(0), _len(0) {}
+    BodyStream(const char* data, size_t size)
+        : _source(nullptr), _data(reinterpret_cast<const uint8_t*>(data)), _remaining(size), _pos(0), _len(size) {}
+
+    int available() override {
+        return static_cast<int>(_len - _pos);
+    }
+
+    int read() override {
+        if (_pos == _len && !fill()) return -1;
+        return _data[_pos++];
+    }
+
+    int peek() override {
+        if (_pos == _len && !fill()) return -1;
+        return _data[_pos];
+    }
+
+    size_t write(uint8_t) override { return 0; }
+
+    /**
+     * @brief Read and drop the rest of the body
+     * @return false if the connection stalled before the end
+     */
+    bool drain() {
+        _pos = _len;
+        while (_source && _remaining > 0) {
+            if (!fill()) return false;
+            _pos = _len;
+        }
+        return true;
+    }
+
+private:
+    Stream* _source;
+    const uint8_t* _data;
+    size_t _remaining;      // Connection bytes not yet buffered
+    size_t _pos;
+    size_t _len;
+    uint8_t _block[128];
+
+    bool fill() {
+        if (!_source || _remaining == 0) return false;
+        // Never ask for more than the body: the connection may carry the next response
+        const size_t want = _remaining < sizeof(_block) ? _remaining : sizeof(_block);
+        const size_t n = _source->readBytes(_block, want);   // Waits up to the client timeout
+        if (n == 0) return false;
+        _data = _block;
+        _remaining -= n;
+        _pos = 0;
+        _len = n;
+        return true;
+    }
+};
+
+} // namespace
+
+HttpConnection::HttpConnection(bool keepAlive, uint32_t idleTimeoutMs)
+    : _keepAlive(keepAlive)
+    , _idleTimeoutMs(idleTimeoutMs)
+    , _hostSecure(false)
+    , _lastUsed(0)
+{
+    _host[0] = '\0';
+    _tls.setInsecure();
+    _http.setReuse(keepAlive);
+}
+
+void HttpConnection::Stats::add(const Stats& other) {
+    requests += other.requests;
+    connects += other.connects;
+    reused += other.reused;
+    retries += other.retries;
+    connectMs += other.connectMs;
+    if (other.connectMaxMs > connectMaxMs) connectMaxMs = other.connectMaxMs;
+}
+
+void HttpConnection::execute(const NetRequest& request, NetResponse& response) {
+    char host[HOST_SIZE];
+    uint16_t port;
+    parseUrl(request.url, host, sizeof(host), port);
+
+    const bool reuse = canReuse(host, request.secure);
+    if (reuse) {
+        _stats.reused++;
+    } else if (!open(host, port, request.secure)) {
+        response.code = HTTPC_ERROR_CONNECTION_REFUSED;
+        return;
+    }
+
+    response.code = send(request, response);
+
+    // The peer may have closed an idle keep-alive connection just before
+    // we wrote to it: one retry on a fresh connection, unless the peer
+    // may already have acted on the request
+    if (reuse && canRetry(request.method, response.code)) {
+        _stats.retries++;
+        if (open(host, port, request.secure)) {
+            response.code = send(request, response);
+        }
+    }
+
+    if (response.code > 0 && _keepAlive && _http.connected()) {
+        strncpy(_host, host, sizeof(_host) - 1);
+        _host[sizeof(_host) - 1] = '\0';
+        _hostSecure = request.secure;
+        _lastUsed = millis();
+    } else {
+        close();
+    }
+}
+
+void HttpConnection::close() {
+    _tcp.stop();
+    _tls.stop();
+    _host[0] = '\0';
+}
+
+bool HttpConnection::isOpen() {
+    return _host[0] != '\0' && transport(_hostSecure).connected();
+}
+
+bool HttpConnection::canReuse(const char* host, bool secure) {
+    if (!_keepAlive || !isOpen()) {
+        return false;
+    }
+    if (secure != _hostSecure || strcmp(host, _host) != 0) {
+        return false;
+    }
+    return millis() - _lastUsed < _idleTimeoutMs;
+}
+
+bool HttpConnection::open(const char* host, uint16_t port, bool secure) {
+    close();
+
+    const uint32_t start = millis();
+    const bool connected = transport(secure).connect(host, port);
+    const uint32_t elapsed = millis() - start;
+
+    _stats.connects++;
+    _stats.connectMs += elapsed;
+    if (elapsed > _stats.connectMaxMs) _stats.connectMaxMs = elapsed;
+    return connected;
+}
+
+int HttpConnection::send(const NetRequest& request, NetResponse& response) {
+    _stats.requests++;
+
+    WiFiClient& client = transport(request.secure);
+    if (request.secure) {
+        _tls.setTimeout(request.timeoutMs / 1000);
+    }
+    if (!_http.begin(client, request.url)) {
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+
+    _http.setTimeout(request.timeoutMs);
+    if (request.contentType) {
+        _http.addHeader("Content-Type", request.contentType);
+    }
+    if (!request.authorization.isEmpty()) {
+        _http.addHeader("Authorization", request.authorization);
+    }
+    if (!request.ifNoneMatch.isEmpty()) {
+        _http.addHeader("If-None-Match", request.ifNoneMatch);
+    }
+    static const char* responseHeaders[] = {"ETag"};
+    _http.collectHeaders(responseHeaders, 1);
+
+    int code = 0;
+    switch (request.method) {
+        case NetMethod::GET:  code = _http.GET(); break;
+        case NetMethod::POST: code = _http.POST(request.body); break;
+        case NetMethod::PUT:  code = _http.sendRequest("PUT", request.body); break;
+        case NetMethod::DEL:  code = _http.sendRequest("DELETE"); break;
+    }
+
+    if (code > 0) {
+        response.etag = _http.header("ETag");
+    }
+
+    // Read the body even when unused: a kept-alive connection can only
+    // carry the next request once this response is fully consumed.
+    // A 304 has none; reading one would wait for the timeout.
+    if (request.reader && code >= 200 && code < 300) {
+        response.parsed = readBody(request.reader);
+    } else if (code > 0 && code != HTTP_CODE_NOT_MODIFIED) {
+        response.body = _http.getString();
+    }
+    _http.end();
+    return code;
+}
+
+bool HttpConnection::readBody(const BodyReader& reader) {
+    const int size = _http.getSize();
+    if (size < 0) {
+        // Chunked or close-delimited: let HTTPClient decode it
+        String body = _http.getString();
+        BodyStream stream(body.c_str(), body.length());
+        return reader(stream);
+    }
+
+    BodyStream stream(_http.getStream(), static_cast<size_t>(size));
+    const bool parsed = reader(stream);
+
+    // Whatever the reader left must not be taken for the next response
+    if (!stream.drain()) {
+        _http.getStream().stop();
+    }
+    return parsed;
+}
+
+bool HttpConnection::canRetry(NetMethod method, int code) {
+    // Failed before the request was complete: the peer never saw it
+    if (code == HTTPC_ERROR_CONNECTION_REFUSED ||
+        code == HTTPC_ERROR_SEND_HEADER_FAILED ||
+        code == HTTPC_ERROR_NOT_CONNECTED) {
+        return true;
+    }
+
+    // Lost after sending: only a GET is safe to repeat. A POST (token
+    // refresh) or PUT may already have been applied.
+    return method == NetMethod::GET &&
+           (code == HTTPC_ERROR_SEND_PAYLOAD_FAILED || code == HTTPC_ERROR_CONNECTION_LOST);
+}
+
+void HttpConnection::parseUrl(const String& url, char* host, size_t hostSize, uint16_t& port) {
+    const char* start = strstr(url.c_str(), "://");
+    const bool secure = start && strncmp(url.c_str(), "https", 5) == 0;
+    start = start ? start + 3 : url.c_str();
+
+    size_t len = strcspn(start, ":/");
+    if (len >= hostSize) len = hostSize - 1;
+    memcpy(host, start, len);
+    host[len] = '\0';
+
+    port = (start[len] == ':') ? static_cast<uint16_t>(atoi(start + len + 1)) : (secure ? 443 : 80);
+}
+
+// =============================================================================
+// HttpConnectionPool
+// =============================================================================
+
+HttpConnectionPool::HttpConnectionPool(uint8_t size, bool keepAlive, uint32_t idleTimeoutMs)
+    : _size(size < 1 ? 1 : (size > MAX_CONNECTIONS ? MAX_CONNECTIONS : size))
+{
+    for (uint8_t i = 0; i < _size; i++) {
+        _slots[i].reset(new HttpConnection(keepAlive, idleTimeoutMs));
+    }
+}
+
+void HttpConnectionPool::execute(const NetRequest& request, NetResponse& response) {
+    char host[HttpConnection::HOST_SIZE];
+    uint16_t port;
+    HttpConnection::parseUrl(request.url, host, sizeof(host), port);
+
+    select(host, request.secure).execute(request, response);
+}
+
+void HttpConnectionPool::close() {
+    for (uint8_t i = 0; i < _size; i++) {
+        _slots[i]->close();
+    }
+}
+
+HttpConnection::Stats HttpConnectionPool::getStats() const {
+    HttpConnection::Stats total;
+    for (uint8_t i = 0; i < _size; i++) {
+        total.add(_slots[i]->getStats());
+    }
+    return total;
+}
+
+HttpConnection& HttpConnectionPool::select(const char* host, bool secure) {
+    HttpConnection* unused = nullptr;
+    HttpConnection* oldest = _slots[0].get();
+
+    for (uint8_t i = 0; i < _size; i++) {
+        HttpConnection* slot = _slots[i].get();
+        if (slot->isSecure() == secure && strcmp(slot->getHost(), host) == 0) {
+            return *slot;
+        }
+        if (!unused && slot->getHost()[0] == '\0') {
+            unused = slot;
+        }
+        if (millis() - slot->getLastUsed() > millis() - oldest->getLastUsed()) {
+            oldest = slot;
+        }
+    }
+    return unused ? *unused : *oldest;
+}
+
+} // namespace paperhome
@@ -0,0 +1,174 @@
+#include "connectivity/network_worker.h"
+#include <WiFi.h>
+#include <stdarg.h>
+
+namespace paperhome {
+
+static const char* const LANE_NAMES[] = {"NetHue", "NetTado"};
+
+NetworkWorker::NetworkWorker()
+    : _hueConnections(1, true, config::hue::KEEPALIVE_IDLE_MS)
+    , _tadoConnections(config::tado::TLS_CONNECTIONS, true, config::tado::KEEPALIVE_IDLE_MS)
+    , _rejected(0)
+{
+    for (uint8_t i = 0; i < static_cast<uint8_t>(NetLane::COUNT); i++) {
+        _lanes[i].owner = this;
+        _lanes[i].name = LANE_NAMES[i];
+    }
+    _lanes[static_cast<uint8_t>(NetLane::HUE)].connections = &_hueConnections;
+    _lanes[static_cast<uint8_t>(NetLane::TADO)].connections = &_tadoConnections;
+}
+
+bool NetworkWorker::start() {
+    for (Lane& lane : _lanes) {
+        if (lane.task) continue;
+
+        if (!lane.wake) lane.wake = xQueueCreate(1, sizeof(uint8_t));
+        if (!lane.wake) return false;
+
+        BaseType_t created = xTaskCreatePinnedToCore(
+            laneTask, lane.name, config::tasks::NET_TASK_STACK, &lane,
+            config::tasks::NET_TASK_PRIORITY, &lane.task, config::tasks::NET_CORE);
+        if (created != pdPASS) {
+            lane.task = nullptr;
+            logf("Failed to start %s task", lane.name);
+            return false;
+        }
+    }
+
+    log("Network lanes started");
+    return true;
+}
+
+bool NetworkWorker::submit(NetLane lane, NetPriority priority, NetRequest&& request, Callback callback) {
+    Lane& target = _lanes[static_cast<uint8_t>(lane)];
+
+    auto fill = [&](Job& job) {
+        job.request = std::move(request);
+        job.callback = std::move(callback);
+        job.submittedAt = millis();
+    };
+    bool queued = (priority == NetPriority::USER) ? target.user.emplaceWith(fill)
+                                                  : target.background.emplaceWith(fill);
+    if (!queued) {
+        _rejected++;
+        logf("%s %s queue full, request dropped", target.name,
+             priority == NetPriority::USER ? "user" : "background");
+        return false;
+    }
+
+    // Token already pending means the lane is awake or about to be
+    uint8_t token = 1;
+    xQueueSend(target.wake, &token, 0);
+    return true;
+}
+
+size_t NetworkWorker::poll() {
+    size_t count = 0;
+    for (Lane& lane : _lanes) {
+        count += lane.done.consume([](Job& job) {
+            if (job.callback) job.callback(job.response);
+        });
+    }
+    return count;
+}
+
+size_t NetworkWorker::getPendingCount(NetLane lane) const {
+    const Lane& target = _lanes[static_cast<uint8_t>(lane)];
+    return target.user.count() + target.background.count() +
+           target.inFlight.load(std::memory_order_acquire) + target.done.count();
+}
+
+void NetworkWorker::closeConnections(NetLane lane) {
+    // Connections belong to the lane task: it closes them before its next request
+    _lanes[static_cast<uint8_t>(lane)].closeRequested.store(true, std::memory_order_release);
+}
+
+void NetworkWorker::logStats() const {
+    if (!config::debug::NET_DBG) return;
+    for (const Lane& lane : _lanes) {
+        HttpConnection::Stats stats = lane.connections->getStats();
+        Serial.printf("[Net] %-8s requests=%lu connects=%lu (avg %lu ms, max %lu ms) reused=%lu retries=%lu\n",
+                      lane.name, (unsigned long)stats.requests, (unsigned long)stats.connects,
+                      (unsigned long)(stats.connects ? stats.connectMs / stats.connects : 0),
+                      (unsigned long)stats.connectMaxMs, (unsigned long)stats.reused,
+                      (unsigned long)stats.retries);
+    }
+}
+
+// =============================================================================
+// Lane Tasks
+// =============================================================================
+
+void NetworkWorker::laneTask(void* param) {
+    auto* lane = static_cast<Lane*>(param);
+    Job job;
+
+    while (true) {
+        uint8_t token;
+        if (xQueueReceive(lane->wake, &token, portMAX_DELAY) != pdTRUE) continue;
+
+        // User requests first, re-checked after every transfer. inFlight is
+        // raised before the pop so getPendingCount() never misses a job
+        // between its queue and the completion ring.
+        while (true) {
+            lane->inFlight.store(1, std::memory_order_release);
+            if (!lane->user.pop(job) && !lane->background.pop(job)) {
+                break;
+            }
+
+            lane->owner->execute(*lane, job);
+
+            // The I/O task drains completions every few ms
+            while (!lane->done.push(std::move(job))) {
+                vTaskDelay(pdMS_TO_TICKS(config::tasks::IO_NET_INTERVAL_MS));
+            }
+            job = Job();
+        }
+        lane->inFlight.store(0, std::memory_order_release);
+    }
+}
+
+void NetworkWorker::execute(Lane& lane, Job& job) {
+    const NetRequest& request = job.request;
+    NetResponse& response = job.response;
+
+    const uint32_t start = millis();
+    response.queuedMs = start - job.submittedAt;
+
+    if (lane.closeRequested.exchange(false, std::memory_order_acquire)) {
+        lane.connections->close();
+    }
+
+    if (WiFi.status() != WL_CONNECTED) {
+        response.code = HTTPC_ERROR_NOT_CONNECTED;
+        lane.connections->close();
+        return;
+    }
+
+    lane.connections->execute(request, response);
+
+    response.transferMs = millis() - start;
+    if (response.code < 0) {
+        logf("%s: request failed: %s", lane.name, HTTPClient::errorToString(response.code).c_str());
+    }
+}
+
+void NetworkWorker::log(const char* msg) {
+    if (config::debug::NET_DBG) {
+        Serial.printf("[Net] %s\n", msg);
+    }
+}
+
+void NetworkWorker::logf(const char* fmt, ...) {
+    if (config::debug::NET_DBG) {
+        char buffer[128];
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(buffer, sizeof(buffer), fmt, args);
+        va_end(args);
+        Serial.printf("[Net] %s\n", buffer);
+    }
+}
+
+} // namespace paperhome
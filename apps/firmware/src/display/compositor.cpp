@@ -6,6 +6,9 @@ Compositor::Compositor(DisplayDriver& display)
     : _display(display)
     , _frameCount(0)
     , _lastFrameTime(0)
+    , _lastFramePixels(0)
+    , _lastFrameWindows(0)
+    , _totalPixelsRefreshed(0)
     , _inFrame(false)
 {
 }
@@ -14,14 +17,27 @@ Compositor::Compositor(DisplayDriver& display)
 // Frame Control
 // =============================================================================
 
-void Compositor::beginFrame() {
+void Compositor::beginFrame(FrameMode mode) {
     _dirtyAccum.reset();
     _inFrame = true;
+    _recording = false;
+
+    if (mode == FrameMode::RECORDED) {
+        DisplayList& list = _lists[_current];
+        bool allocated = _lists[0].begin(config::display::DISPLAY_LIST_CAPACITY,
+                                         config::display::DISPLAY_LIST_TEXT_BYTES) &&
+                         _lists[1].begin(config::display::DISPLAY_LIST_CAPACITY,
+                                         config::display::DISPLAY_LIST_TEXT_BYTES);
+        if (allocated) {
+            list.reset();
+            _recording = true;
+        }
+    }
 }
 
 bool Compositor::endFrame() {
     if (!_inFrame) return false;
-    _inFrame = false;
+    finishFrame();
 
     if (_dirtyAccum.isEmpty()) {
         return false;
@@ -29,74 +45,75 @@ bool Compositor::endFrame() {
 
     uint32_t start = millis();
 
-    // Partial refresh of dirty region
-    Rect dirty = _dirtyAccum.getBounds();
-    _display.partialRefresh(dirty);
+    // Diff each dirty rect against the panel; the accumulator merges the
+    // changed regions into the cheapest set of refresh windows
+    DirtyRectAccumulator changed(config::display::REFRESH_RECT_OVERHEAD_PX);
+    for (const Rect& dirty : _dirtyAccum) {
+        _display.diffFrame(dirty, changed);
+    }
+    if (changed.isEmpty()) {
+        return false;
+    }
+
+    // Refresh top to bottom (insertion sort, at most MAX_RECTS windows)
+    Rect windows[DirtyRectAccumulator::MAX_RECTS];
+    uint8_t count = 0;
+    for (const Rect& rect : changed) {
+        uint8_t i = count++;
+        while (i > 0 && (windows[i - 1].y > rect.y ||
+                         (windows[i - 1].y == rect.y && windows[i - 1].x > rect.x))) {
+            windows[i] = windows[i - 1];
+            i--;
+        }
+        windows[i] = rect;
+    }
+
+    _lastRefreshBounds = Rect::empty();
+    _lastFramePixels = 0;
+    _display.partialRefresh(windows, count);
+    for (uint8_t i = 0; i < count; i++) {
+        _lastRefreshBounds = _lastRefreshBounds.unionWith(windows[i]);
+        _lastFramePixels += windows[i].area();
+    }
+    _lastFrameWindows = count;
 
     _lastFrameTime = millis() - start;
     _frameCount++;
+    _totalPixelsRefreshed += _lastFramePixels;
 
     return true;
 }
 
 bool Compositor::endFrameFull() {
-    _inFrame = false;
+    finishFrame();
     _dirtyAccum.reset();
 
     uint32_t start = millis();
 
     // Full hardware refresh
     _display.fullRefresh();
+    _lastRefreshBounds = Rect::full(config::display::WIDTH, config::display::HEIGHT);
+    _lastFramePixels = _lastRefreshBounds.area();
+    _lastFrameWindows = 1;
 
     _lastFrameTime = millis() - start;
     _frameCount++;
 
+    _totalPixelsRefreshed += _lastFramePixels;
+
     return true;
 }
 
 // =============================================================================
-// Legacy API (for screen compatibility)
+// Command API
 // =============================================================================
 
 void Compositor::submit(const DrawCommand& cmd) {
-    switch (cmd.type) {
-        case DrawCommandType::FILL_RECT:
-            fillRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.black);
-            break;
-        case DrawCommandType::DRAW_RECT:
-            drawRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.black);
-            break;
-        case DrawCommandType::FILL_ROUND_RECT:
-            fillRoundRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.extra1, cmd.black);
-            break;
-        case DrawCommandType::DRAW_ROUND_RECT:
-            drawRoundRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.extra1, cmd.black);
-            break;
-        case DrawCommandType::DRAW_LINE:
-            drawLine(cmd.x, cmd.y, cmd.extra1, cmd.extra2, cmd.black);
-            break;
-        case DrawCommandType::DRAW_HLINE:
-            drawHLine(cmd.x, cmd.y, cmd.w, cmd.black);
-            break;
-        case DrawCommandType::DRAW_VLINE:
-            drawVLine(cmd.x, cmd.y, cmd.h, cmd.black);
-            break;
-        case DrawCommandType::FILL_CIRCLE:
-            fillCircle(cmd.x, cmd.y, cmd.extra1, cmd.black);
-            break;
-        case DrawCommandType::DRAW_CIRCLE:
-            drawCircle(cmd.x, cmd.y, cmd.extra1, cmd.black);
-            break;
-        case DrawCommandType::FILL_SCREEN:
-            fillScreen(!cmd.black);
-            break;
-        case DrawCommandType::INVERT_RECT:
-            _display.invertRect(Rect(cmd.x, cmd.y, cmd.w, cmd.h));
-            addDirty(cmd.x, cmd.y, cmd.w, cmd.h);
-            break;
-        default:
-            break;
+    if (_recording) {
+        record(cmd);
+        return;
     }
+    addDirty(DisplayList::execute(cmd, _display));
 }
 
 void Compositor::submitText(const char* text, int16_t x, int16_t y,
@@ -118,58 +135,43 @@ bool Compositor::flush() {
 // =============================================================================
 
 void Compositor::fillScreen(bool white) {
-    _display.fillScreen(white);
-    markAllDirty();
+    submit(DrawCommand::fillScreen(white));
 }
 
 void Compositor::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, bool black) {
-    _display.fillRect(x, y, w, h, black);
-    addDirty(x, y, w, h);
+    submit(DrawCommand::fillRect(x, y, w, h, black));
 }
 
 void Compositor::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, bool black) {
-    _display.drawRect(x, y, w, h, black);
-    addDirty(x, y, w, h);
+    submit(DrawCommand::drawRect(x, y, w, h, black));
 }
 
 void Compositor::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool black) {
-    _display.fillRoundRect(x, y, w, h, r, black);
-    addDirty(x, y, w, h);
+    submit(DrawCommand::fillRoundRect(x, y, w, h, r, black));
 }
 
 void Compositor::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool black) {
-    _display.drawRoundRect(x, y, w, h, r, black);
-    addDirty(x, y, w, h);
+    submit(DrawCommand::drawRoundRect(x, y, w, h, r, black));
 }
 
 void Compositor::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool black) {
-    _display.drawLine(x0, y0, x1, y1, black);
-    // Calculate line bounding box
-    int16_t minX = std::min(x0, x1);
-    int16_t minY = std::min(y0, y1);
-    int16_t maxX = std::max(x0, x1);
-    int16_t maxY = std::max(y0, y1);
-    addDirty(minX, minY, maxX - minX + 1, maxY - minY + 1);
+    submit(DrawCommand::drawLine(x0, y0, x1, y1, black));
 }
 
 void Compositor::drawHLine(int16_t x, int16_t y, int16_t w, bool black) {
-    _display.drawHLine(x, y, w, black);
-    addDirty(x, y, w, 1);
+    submit(DrawCommand::drawHLine(x, y, w, black));
 }
 
 void Compositor::drawVLine(int16_t x, int16_t y, int16_t h, bool black) {
-    _display.drawVLine(x, y, h, black);
-    addDirty(x, y, 1, h);
+    submit(DrawCommand::drawVLine(x, y, h, black));
 }
 
 void Compositor::fillCircle(int16_t x, int16_t y, int16_t r, bool black) {
-    _display.fillCircle(x, y, r, black);
-    addDirty(x - r, y - r, r * 2 + 1, r * 2 + 1);
+    submit(DrawCommand::fillCircle(x, y, r, black));
 }
 
 void Compositor::drawCircle(int16_t x, int16_t y, int16_t r, bool black) {
-    _display.drawCircle(x, y, r, black);
-    addDirty(x - r, y - r, r * 2 + 1, r * 2 + 1);
+    submit(DrawCommand::drawCircle(x, y, r, black));
 }
 
 // =============================================================================
@@ -178,35 +180,24 @@ void Compositor::drawCircle(int16_t x, int16_t y, int16_t r, bool black) {
 
 void Compositor::drawText(const char* text, int16_t x, int16_t y,
                           const GFXfont* font, bool black) {
-    _display.setFont(font);
-    _display.setTextColor(black);
-    _display.drawText(text, x, y);
-
-    // Calculate text bounds for dirty tracking
-    int16_t x1, y1;
-    uint16_t w, h;
-    _display.getTextBounds(text, x, y, &x1, &y1, &w, &h);
-    addDirty(x1, y1, w, h);
+    submit(DrawCommand::text(text, x, y, font, black));
 }
 
 void Compositor::drawTextCentered(const char* text, int16_t x, int16_t y, int16_t w,
                                    const GFXfont* font, bool black) {
+    // Resolve alignment now so the command is a plain positioned string
     _display.setFont(font);
-    _display.setTextColor(black);
-    _display.drawTextCentered(text, x, y, w);
-
-    // Approximate dirty region (centered text within width)
-    addDirty(x, y - 30, w, 40);  // Conservative estimate
+    TextBounds bounds = _display.measureText(text);
+    int16_t cx = x + (w - static_cast<int16_t>(bounds.width)) / 2 - bounds.x1;
+    submit(DrawCommand::text(text, cx, y, font, black));
 }
 
 void Compositor::drawTextRight(const char* text, int16_t x, int16_t y, int16_t w,
                                 const GFXfont* font, bool black) {
     _display.setFont(font);
-    _display.setTextColor(black);
-    _display.drawTextRight(text, x, y, w);
-
-    // Approximate dirty region
-    addDirty(x, y - 30, w, 40);  // Conservative estimate
+    TextBounds bounds = _display.measureText(text);
+    int16_t rx = x + w - static_cast<int16_t>(bounds.width) - bounds.x1;
+    submit(DrawCommand::text(text, rx, y, font, black));
 }
 
 // =============================================================================
@@ -215,8 +206,7 @@ void Compositor::drawTextRight(const char* text, int16_t x, int16_t y, int16_t w
 
 void Compositor::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap,
                             int16_t w, int16_t h, bool black) {
-    _display.drawBitmap(x, y, bitmap, w, h, black);
-    addDirty(x, y, w, h);
+    submit(DrawCommand::bitmap(x, y, bitmap, w, h, black));
 }
 
 // =============================================================================
@@ -228,18 +218,13 @@ void Compositor::updateSelection(const Rect& oldRect, const Rect& newRect) {
     // - Inverting once highlights
     // - Inverting again un-highlights
 
-    if (!oldRect.isEmpty()) {
-        _display.invertRect(oldRect);
-    }
-
-    if (!newRect.isEmpty()) {
-        _display.invertRect(newRect);
-    }
+    invertSelection(oldRect);
+    invertSelection(newRect);
 }
 
 void Compositor::invertSelection(const Rect& rect) {
     if (!rect.isEmpty()) {
-        _display.invertRect(rect);
+        submit(DrawCommand::invertRect(rect.x, rect.y, rect.width, rect.height));
     }
 }
 
@@ -282,4 +267,53 @@ void Compositor::addDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
     }
 }
 
+void Compositor::record(const DrawCommand& cmd) {
+    DisplayList& list = _lists[_current];
+    if (list.add(cmd, DisplayList::boundsOf(cmd, _display))) return;
+
+    // Arena full: draw what we have and finish the frame immediately
+    abandonRecording();
+    addDirty(DisplayList::execute(cmd, _display));
+}
+
+void Compositor::abandonRecording() {
+    DisplayList& list = _lists[_current];
+    _display.framebuffer().clearClip();
+    list.rasterize(_display);
+    markAllDirty();
+
+    _lastRecordedCommands = list.size();
+    _lastReplayedCommands = list.size();
+    list.reset();
+    _recording = false;
+    _previousValid = false;
+}
+
+void Compositor::finishFrame() {
+    _inFrame = false;
+
+    if (!_recording) {
+        // Immediate drawing: the framebuffer no longer matches any recording
+        _previousValid = false;
+        return;
+    }
+    _recording = false;
+
+    // Changed regions: commands that differ from the previous recording,
+    // plus anything marked dirty explicitly
+    DisplayList& list = _lists[_current];
+    if (_previousValid) {
+        list.diff(_lists[_current ^ 1], _dirtyAccum);
+    } else {
+        markAllDirty();
+    }
+
+    _lastRecordedCommands = list.size();
+    _lastReplayedCommands = list.rasterize(_display, _dirtyAccum,
+                                           config::display::DISPLAY_LIST_BAND_ROWS);
+
+    _current ^= 1;
+    _previousValid = true;
+}
+
 } // namespace paperhome
@@ -1,14 +1,21 @@
 #include "display/display_driver.h"
 #include <cstdarg>
+#include <cstring>
 
 namespace paperhome {
 
+namespace {
+
+// Signalled by the BUSY falling-edge interrupt, drained by the panel task
+QueueHandle_t s_busyQueue = nullptr;
+
+} // namespace
+
 DisplayDriver::DisplayDriver()
-    : _display(GxEPD2_426_GDEQ0426T82(
-          config::display::PIN_CS,
-          config::display::PIN_DC,
-          config::display::PIN_RST,
-          config::display::PIN_BUSY))
+    : _panel(config::display::PIN_CS,
+             config::display::PIN_DC,
+             config::display::PIN_RST,
+             config::display::PIN_BUSY)
     , _powered(false)
     , _refreshCount(0)
     , _lastRefreshTime(0)
@@ -24,15 +31,26 @@ bool DisplayDriver::init() {
     // Power on display
     powerOn();
 
-    // Initialize GxEPD2
-    _display.init(config::debug::BAUD_RATE, true, 2, false);
-    _display.setRotation(config::display::ROTATION);
-    _display.setTextColor(GxEPD_BLACK);
-    _display.setTextWrap(false);
+    // Allocate framebuffer (PSRAM)
+    if (!_framebuffer.begin()) {
+        log("ERROR: Framebuffer allocation failed");
+        return false;
+    }
+    _framebuffer.setRotation(config::display::ROTATION);
+    _framebuffer.setTextColor(GxEPD_BLACK);
+    _framebuffer.setTextWrap(false);
+
+    // Initialize GxEPD2 panel driver
+    _panel.init(config::debug::BAUD_RATE, true, 2, false);
 
     // Perform initial full clear
     clearScreen();
 
+    // Refreshes from here on go through the panel task
+    if (config::display::ASYNC_REFRESH) {
+        setAsyncRefresh(true);
+    }
+
     logf("Display initialized: %dx%d", config::display::WIDTH, config::display::HEIGHT);
     return true;
 }
@@ -48,7 +66,8 @@ void DisplayDriver::powerOn() {
 
 void DisplayDriver::powerOff() {
     if (_powered) {
-        _display.hibernate();
+        waitIdle();
+        _panel.hibernate();
         digitalWrite(config::display::PIN_POWER, LOW);
         _powered = false;
         log("Power OFF");
@@ -60,90 +79,175 @@ void DisplayDriver::powerOff() {
 // =============================================================================
 
 void DisplayDriver::fullRefresh() {
-    log("Full refresh (anti-ghosting)...");
-    uint32_t start = millis();
-
-    // GxEPD2 full buffer mode - display() pushes buffer to screen
-    // false = full refresh mode (not partial)
-    _display.display(false);
+    if (isRefreshing()) _coalescedCount++;
 
-    _lastRefreshTime = millis() - start;
-    _refreshCount++;
-
-    logf("Full refresh complete: %lu ms", _lastRefreshTime);
+    // A full refresh covers any queued partials
+    _pendingFull = true;
+    _pending.reset();
+    service();
 }
 
 void DisplayDriver::partialRefresh(const Rect& rect) {
-    if (rect.isEmpty()) {
-        log("partialRefresh: empty rect, skipping");
-        return;
+    partialRefresh(&rect, 1);
+}
+
+void DisplayDriver::partialRefresh(const Rect* rects, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        // Clamp to display bounds
+        Rect clamped = rects[i].clamp(config::display::WIDTH, config::display::HEIGHT);
+        if (clamped.isEmpty()) {
+            log("partialRefresh: empty rect, skipping");
+            continue;
+        }
+
+        if (isRefreshing()) _coalescedCount++;
+        if (!_pendingFull) {
+            _pending.add(clamped);
+        }
     }
+    service();
+}
 
-    // Clamp to display bounds
-    Rect clamped = rect.clamp(config::display::WIDTH, config::display::HEIGHT);
-    if (clamped.isEmpty()) {
-        log("partialRefresh: clamped rect empty, skipping");
+void DisplayDriver::service() {
+    if (isRefreshing()) return;
+    if (!hasPendingRefresh()) {
+        serviceGhosting();
         return;
     }
 
-    uint32_t start = millis();
+    RefreshJob job;
+    job.kind = _pendingFull ? RefreshKind::FULL : RefreshKind::PARTIAL;
+    job.count = 0;
 
-    // GxEPD2 partial window refresh from buffer
-    _display.displayWindow(clamped.x, clamped.y, clamped.width, clamped.height);
+    if (job.kind == RefreshKind::PARTIAL) {
+        for (const Rect& rect : _pending) {
+            Rect native = _framebuffer.toNative(rect);
+            if (!native.isEmpty()) job.windows[job.count++] = native;
+        }
+    }
+    _pendingFull = false;
+    _pending.reset();
+    if (job.kind == RefreshKind::PARTIAL && job.count == 0) return;
+
+    // Heat map needs the shown frame, so account before flipping
+    if (job.kind == RefreshKind::FULL) {
+        _scheduler.recordFull();
+    } else {
+        for (uint8_t i = 0; i < job.count; i++) {
+            _scheduler.recordPartial(_framebuffer.getFrontBuffer(), _framebuffer.getBuffer(),
+                                     job.windows[i]);
+        }
+    }
 
-    _lastRefreshTime = millis() - start;
-    _refreshCount++;
+    // Page flip: the panel streams from the front buffer, so drawing into
+    // the back buffer can start at once. Everything drawn since the last
+    // flip lies inside the refresh windows, so only those are stale in
+    // the new back buffer.
+    _framebuffer.swapBuffers();
+    if (job.kind == RefreshKind::FULL) {
+        _framebuffer.copyFrontToBack();
+    } else {
+        for (uint8_t i = 0; i < job.count; i++) {
+            _framebuffer.copyFrontToBack(job.windows[i]);
+        }
+    }
 
-    logf("Partial refresh: %dx%d @ (%d,%d), %lu ms",
-         clamped.width, clamped.height,
-         clamped.x, clamped.y,
-         _lastRefreshTime);
+    issue(job);
 }
 
-void DisplayDriver::invertRect(const Rect& rect) {
-    if (rect.isEmpty()) return;
+void DisplayDriver::serviceGhosting() {
+    DirtyRectAccumulator regions(config::display::REFRESH_RECT_OVERHEAD_PX);
+    RefreshJob job;
+    job.count = 0;
 
-    // Clamp to display bounds
-    Rect clamped = rect.clamp(config::display::WIDTH, config::display::HEIGHT);
-    if (clamped.isEmpty()) return;
+    switch (_scheduler.poll(millis(), regions)) {
+        case RefreshScheduler::Action::NONE:
+            return;
 
-    // Draw inverted border for selection highlight
-    // Since GxEPD2 buffer is private, we use visual highlighting instead of XOR
-    // This draws a 3-pixel black border around the selection
+        case RefreshScheduler::Action::FULL:
+            job.kind = RefreshKind::FULL;
+            _scheduler.recordFull();
+            break;
 
-    const int16_t borderWidth = 3;
-
-    // Draw filled border using lines for efficiency
-    // Top border
-    for (int16_t i = 0; i < borderWidth; i++) {
-        _display.drawFastHLine(clamped.x, clamped.y + i, clamped.width, GxEPD_BLACK);
+        case RefreshScheduler::Action::CLEAN:
+            job.kind = RefreshKind::CLEAN;
+            for (const Rect& native : regions) {
+                job.windows[job.count++] = native;
+                _scheduler.recordClean(native);
+            }
+            break;
     }
-    // Bottom border
-    for (int16_t i = 0; i < borderWidth; i++) {
-        _display.drawFastHLine(clamped.x, clamped.y + clamped.height - 1 - i, clamped.width, GxEPD_BLACK);
+    _cleanupCount++;
+
+    // Between frames the front buffer is what the panel shows, so the
+    // clean-up streams it again without a flip
+    issue(job);
+}
+
+void DisplayDriver::issue(const RefreshJob& job) {
+    if (_async && _panelTask) {
+        _refreshing.store(true, std::memory_order_release);
+        xQueueSend(_jobQueue, &job, portMAX_DELAY);
+    } else {
+        runJob(job);
     }
-    // Left border
-    for (int16_t i = 0; i < borderWidth; i++) {
-        _display.drawFastVLine(clamped.x + i, clamped.y, clamped.height, GxEPD_BLACK);
+}
+
+bool DisplayDriver::waitIdle(uint32_t timeoutMs) {
+    uint32_t start = millis();
+    while (true) {
+        service();
+        if (!isRefreshing() && !hasPendingRefresh()) return true;
+        if (millis() - start >= timeoutMs) return false;
+        vTaskDelay(pdMS_TO_TICKS(1));
     }
-    // Right border
-    for (int16_t i = 0; i < borderWidth; i++) {
-        _display.drawFastVLine(clamped.x + clamped.width - 1 - i, clamped.y, clamped.height, GxEPD_BLACK);
+}
+
+void DisplayDriver::setAsyncRefresh(bool enabled) {
+    if (enabled == _async) return;
+
+    waitIdle();
+    if (enabled && !startPanelTask()) {
+        log("WARNING: Panel task unavailable, refreshes will block");
+        return;
     }
+    _async = enabled;
+}
+
+void DisplayDriver::invertRect(const Rect& rect) {
+    if (rect.isEmpty()) return;
+
+    // Clamp to display bounds
+    Rect clamped = rect.clamp(config::display::WIDTH, config::display::HEIGHT);
+    if (clamped.isEmpty()) return;
 
-    logf("Selection highlight: %dx%d @ (%d,%d)",
+    _framebuffer.invertRect(clamped);
+
+    logf("Inverted: %dx%d @ (%d,%d)",
          clamped.width, clamped.height,
          clamped.x, clamped.y);
 }
 
+void DisplayDriver::diffFrame(const Rect& search, DirtyRectAccumulator& out) {
+    Rect native = _framebuffer.toNative(search);
+    if (native.isEmpty()) return;
+
+    // Merge decisions are area-based, so they hold after rotating back
+    DirtyRectAccumulator changed(out.getOverhead());
+    _diff.compute(_framebuffer.getFrontBuffer(), _framebuffer.getBuffer(), native, changed);
+    for (const Rect& rect : changed) {
+        out.add(_framebuffer.toLogical(rect));
+    }
+}
+
 void DisplayDriver::clearScreen() {
     log("Clearing screen...");
+    waitIdle();
 
-    _display.setFullWindow();
-    _display.firstPage();
-    do {
-        _display.fillScreen(GxEPD_WHITE);
-    } while (_display.nextPage());
+    _framebuffer.fillScreen(GxEPD_WHITE);
+    _panel.clearScreen(0xFF);
+    _framebuffer.swapBuffers();
+    _framebuffer.copyFrontToBack();
 
     log("Screen cleared");
 }
@@ -153,11 +257,11 @@ void DisplayDriver::clearScreen() {
 // =============================================================================
 
 void DisplayDriver::fillScreen(bool white) {
-    _display.fillScreen(white ? GxEPD_WHITE : GxEPD_BLACK);
+    _framebuffer.fillScreen(white ? GxEPD_WHITE : GxEPD_BLACK);
 }
 
 void DisplayDriver::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, bool black) {
-    _display.fillRect(x, y, w, h, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.fillRect(x, y, w, h, black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 void DisplayDriver::fillRect(const Rect& rect, bool black) {
@@ -165,7 +269,7 @@ void DisplayDriver::fillRect(const Rect& rect, bool black) {
 }
 
 void DisplayDriver::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, bool black) {
-    _display.drawRect(x, y, w, h, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.drawRect(x, y, w, h, black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 void DisplayDriver::drawRect(const Rect& rect, bool black) {
@@ -173,31 +277,31 @@ void DisplayDriver::drawRect(const Rect& rect, bool black) {
 }
 
 void DisplayDriver::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool black) {
-    _display.drawRoundRect(x, y, w, h, r, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.drawRoundRect(x, y, w, h, r, black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 void DisplayDriver::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, bool black) {
-    _display.fillRoundRect(x, y, w, h, r, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.fillRoundRect(x, y, w, h, r, black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 void DisplayDriver::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool black) {
-    _display.drawLine(x0, y0, x1, y1, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.drawLine(x0, y0, x1, y1, black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 void DisplayDriver::drawHLine(int16_t x, int16_t y, int16_t w, bool black) {
-    _display.drawFastHLine(x, y, w, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.drawFastHLine(x, y, w, black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 void DisplayDriver::drawVLine(int16_t x, int16_t y, int16_t h, bool black) {
-    _display.drawFastVLine(x, y, h, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.drawFastVLine(x, y, h, black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 void DisplayDriver::drawCircle(int16_t x, int16_t y, int16_t r, bool black) {
-    _display.drawCircle(x, y, r, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.drawCircle(x, y, r, black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 void DisplayDriver::fillCircle(int16_t x, int16_t y, int16_t r, bool black) {
-    _display.fillCircle(x, y, r, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.fillCircle(x, y, r, black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 // =============================================================================
@@ -205,67 +309,215 @@ void DisplayDriver::fillCircle(int16_t x, int16_t y, int16_t r, bool black) {
 // =============================================================================
 
 void DisplayDriver::setFont(const GFXfont* font) {
-    _display.setFont(font);
+    _font = font;
+    _framebuffer.setFont(font);
 }
 
 void DisplayDriver::setTextColor(bool black) {
-    _display.setTextColor(black ? GxEPD_BLACK : GxEPD_WHITE);
+    _textBlack = black;
+    _framebuffer.setTextColor(black ? GxEPD_BLACK : GxEPD_WHITE);
 }
 
 void DisplayDriver::setCursor(int16_t x, int16_t y) {
-    _display.setCursor(x, y);
+    _framebuffer.setCursor(x, y);
 }
 
 void DisplayDriver::print(const char* text) {
-    _display.print(text);
+    _framebuffer.print(text);
 }
 
 void DisplayDriver::println(const char* text) {
-    _display.println(text);
+    _framebuffer.println(text);
 }
 
-void DisplayDriver::drawText(const char* text, int16_t x, int16_t y) {
-    _display.setCursor(x, y);
-    _display.print(text);
+Rect DisplayDriver::drawText(const char* text, int16_t x, int16_t y) {
+    if (!text) return Rect::empty();
+
+    const GlyphAtlas* atlas = _fonts.atlas(_font, _framebuffer.getRotation());
+    if (!atlas || strchr(text, '\n')) {
+        // Built-in font or multi-line: let Adafruit GFX handle it
+        int16_t x1, y1;
+        uint16_t w, h;
+        _framebuffer.getTextBounds(text, x, y, &x1, &y1, &w, &h);
+        _framebuffer.setCursor(x, y);
+        _framebuffer.print(text);
+        return Rect(x1, y1, w, h);
+    }
+
+    int16_t cursor = x;
+    for (const char* p = text; *p; p++) {
+        const GlyphAtlas::Glyph* g = atlas->glyph(static_cast<uint8_t>(*p));
+        if (!g) continue;
+
+        if (g->width > 0 && g->height > 0) {
+            Rect box(cursor + g->xOffset, y + g->yOffset, g->width, g->height);
+            _framebuffer.blitNative(atlas->bitmap(*g), g->stride,
+                                    _framebuffer.mapToNative(box), _textBlack);
+        }
+        cursor += g->xAdvance;
+    }
+    _framebuffer.setCursor(cursor, y);
+
+    return _fonts.measure(_font, text).at(x, y);
 }
 
-void DisplayDriver::drawTextCentered(const char* text, int16_t x, int16_t y, int16_t w) {
-    int16_t x1, y1;
-    uint16_t tw, th;
-    _display.getTextBounds(text, 0, 0, &x1, &y1, &tw, &th);
-    int16_t cx = x + (w - tw) / 2 - x1;
-    _display.setCursor(cx, y);
-    _display.print(text);
+Rect DisplayDriver::drawTextCentered(const char* text, int16_t x, int16_t y, int16_t w) {
+    TextBounds bounds = measureText(text);
+    int16_t cx = x + (w - static_cast<int16_t>(bounds.width)) / 2 - bounds.x1;
+    return drawText(text, cx, y);
 }
 
-void DisplayDriver::drawTextRight(const char* text, int16_t x, int16_t y, int16_t w) {
-    int16_t x1, y1;
-    uint16_t tw, th;
-    _display.getTextBounds(text, 0, 0, &x1, &y1, &tw, &th);
-    int16_t rx = x + w - tw - x1;
-    _display.setCursor(rx, y);
-    _display.print(text);
+Rect DisplayDriver::drawTextRight(const char* text, int16_t x, int16_t y, int16_t w) {
+    TextBounds bounds = measureText(text);
+    int16_t rx = x + w - static_cast<int16_t>(bounds.width) - bounds.x1;
+    return drawText(text, rx, y);
 }
 
 void DisplayDriver::getTextBounds(const char* text, int16_t x, int16_t y,
                                    int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
-    _display.getTextBounds(text, x, y, x1, y1, w, h);
+    if (!_font || !text || strchr(text, '\n')) {
+        _framebuffer.getTextBounds(text, x, y, x1, y1, w, h);
+        return;
+    }
+
+    TextBounds bounds = _fonts.measure(_font, text);
+    *x1 = x + bounds.x1;
+    *y1 = y + bounds.y1;
+    *w = bounds.width;
+    *h = bounds.height;
 }
 
 uint16_t DisplayDriver::getTextWidth(const char* text) {
     int16_t x1, y1;
     uint16_t w, h;
-    _display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+    getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
     return w;
 }
 
+TextBounds DisplayDriver::measureText(const char* text) {
+    if (!text) return TextBounds();
+    if (_font && text && !strchr(text, '\n')) {
+        return _fonts.measure(_font, text);
+    }
+
+    TextBounds bounds;
+    _framebuffer.getTextBounds(text, 0, 0, &bounds.x1, &bounds.y1, &bounds.width, &bounds.height);
+    return bounds;
+}
+
 // =============================================================================
 // Bitmap Rendering
 // =============================================================================
 
 void DisplayDriver::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap,
                                 int16_t w, int16_t h, bool black) {
-    _display.drawBitmap(x, y, bitmap, w, h, black ? GxEPD_BLACK : GxEPD_WHITE);
+    _framebuffer.drawBitmap(x, y, bitmap, w, h, black ? GxEPD_BLACK : GxEPD_WHITE);
+}
+
+// =============================================================================
+// Panel Task
+// =============================================================================
+
+bool DisplayDriver::startPanelTask() {
+    if (_panelTask) return true;
+
+    _jobQueue = xQueueCreate(1, sizeof(RefreshJob));
+    if (!s_busyQueue) s_busyQueue = xQueueCreate(1, sizeof(uint8_t));
+    if (!_jobQueue || !s_busyQueue) return false;
+
+    // GxEPD2 calls waitForBusy while BUSY is high; it sleeps until the
+    // falling edge instead of spinning on the pin
+    _panel.setBusyCallback(waitForBusy, this);
+    pinMode(config::display::PIN_BUSY, INPUT);
+    attachInterrupt(digitalPinToInterrupt(config::display::PIN_BUSY), onBusyFalling, FALLING);
+
+    BaseType_t created = xTaskCreatePinnedToCore(
+        panelTask, "Panel", config::tasks::PANEL_TASK_STACK, this,
+        config::tasks::PANEL_TASK_PRIORITY, &_panelTask, config::tasks::PANEL_CORE);
+    if (created != pdPASS) {
+        _panelTask = nullptr;
+        return false;
+    }
+
+    log("Panel task started");
+    return true;
+}
+
+void DisplayDriver::panelTask(void* param) {
+    auto* self = static_cast<DisplayDriver*>(param);
+    RefreshJob job;
+
+    while (true) {
+        if (xQueueReceive(self->_jobQueue, &job, portMAX_DELAY) != pdTRUE) continue;
+
+        self->runJob(job);
+        self->_refreshing.store(false, std::memory_order_release);
+    }
+}
+
+void DisplayDriver::waitForBusy(const void* param) {
+    (void)param;
+    uint8_t token;
+    xQueueReceive(s_busyQueue, &token, pdMS_TO_TICKS(config::display::BUSY_WAIT_SLICE_MS));
+}
+
+void IRAM_ATTR DisplayDriver::onBusyFalling() {
+    if (!s_busyQueue) return;
+
+    uint8_t token = 1;
+    BaseType_t woken = pdFALSE;
+    xQueueSendFromISR(s_busyQueue, &token, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+void DisplayDriver::runJob(const RefreshJob& job) {
+    uint32_t start = millis();
+    const uint8_t* shown = _framebuffer.getFrontBuffer();
+
+    if (job.kind == RefreshKind::FULL) {
+        log("Full refresh (anti-ghosting)...");
+
+        // Stream to controller RAM, full refresh, then write it again so
+        // the controller's previous-frame RAM matches for partials
+        _panel.writeImageForFullRefresh(shown, 0, 0, EpdPanel::WIDTH, EpdPanel::HEIGHT);
+        _panel.refresh(false);
+        _panel.writeImageAgain(shown, 0, 0, EpdPanel::WIDTH, EpdPanel::HEIGHT);
+    } else if (job.kind == RefreshKind::CLEAN) {
+        // Drive every pixel of the window through its inverse and back,
+        // which clears residue like a full refresh but only locally
+        for (uint8_t i = 0; i < job.count; i++) {
+            const Rect& native = job.windows[i];
+            _panel.writeImagePart(shown, native.x, native.y, EpdPanel::WIDTH, EpdPanel::HEIGHT,
+                                  native.x, native.y, native.width, native.height, true);
+            _panel.refresh(native.x, native.y, native.width, native.height);
+            _panel.writeImagePart(shown, native.x, native.y, EpdPanel::WIDTH, EpdPanel::HEIGHT,
+                                  native.x, native.y, native.width, native.height);
+            _panel.refresh(native.x, native.y, native.width, native.height);
+            _panel.writeImagePartAgain(shown, native.x, native.y, EpdPanel::WIDTH, EpdPanel::HEIGHT,
+                                       native.x, native.y, native.width, native.height);
+        }
+    } else {
+        // Windows in native panel coordinates (controller aligns x to 8 px)
+        for (uint8_t i = 0; i < job.count; i++) {
+            const Rect& native = job.windows[i];
+            _panel.writeImagePart(shown, native.x, native.y, EpdPanel::WIDTH, EpdPanel::HEIGHT,
+                                  native.x, native.y, native.width, native.height);
+            _panel.refresh(native.x, native.y, native.width, native.height);
+            _panel.writeImagePartAgain(shown, native.x, native.y, EpdPanel::WIDTH, EpdPanel::HEIGHT,
+                                       native.x, native.y, native.width, native.height);
+        }
+    }
+
+    _lastRefreshTime = millis() - start;
+    _refreshCount += job.kind == RefreshKind::FULL ? 1 : job.count;
+
+    if (job.kind == RefreshKind::FULL) {
+        logf("Full refresh complete: %lu ms", _lastRefreshTime.load());
+    } else if (job.kind == RefreshKind::CLEAN) {
+        logf("Ghosting clean-up: %u window(s), %lu ms", job.count, _lastRefreshTime.load());
+    } else {
+        logf("Partial refresh: %u window(s), %lu ms", job.count, _lastRefreshTime.load());
+    }
 }
 
 // =============================================================================
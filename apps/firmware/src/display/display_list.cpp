@@ -0,0 +1,318 @@
+#include "display/display_list.h"
+#include "display/display_driver.h"
+#include <esp_heap_caps.h>
+#include <algorithm>
+#include <cstring>
+
+namespace paperhome {
+
+namespace {
+
+/**
+ * @brief Allocate from PSRAM, falling back to internal RAM
+ */
+void* allocPreferPsram(size_t size) {
+    void* ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!ptr) {
+        ptr = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    return ptr;
+}
+
+inline uint32_t fnvMix(uint32_t hash, const void* data, size_t length) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+} // namespace
+
+DisplayList::~DisplayList() {
+    release();
+}
+
+void DisplayList::release() {
+    if (_entries) heap_caps_free(_entries);
+    if (_culled) heap_caps_free(_culled);
+    if (_active) heap_caps_free(_active);
+    if (_native) heap_caps_free(_native);
+    if (_text) heap_caps_free(_text);
+    _entries = nullptr;
+    _culled = nullptr;
+    _active = nullptr;
+    _native = nullptr;
+    _text = nullptr;
+    _capacity = 0;
+    _textBytes = 0;
+    reset();
+}
+
+bool DisplayList::begin(uint16_t capacity, uint16_t textBytes) {
+    if (_entries) return true;
+
+    _entries = static_cast<Entry*>(allocPreferPsram(sizeof(Entry) * capacity));
+    _culled = static_cast<uint16_t*>(allocPreferPsram(sizeof(uint16_t) * capacity));
+    _active = static_cast<uint16_t*>(allocPreferPsram(sizeof(uint16_t) * capacity));
+    _native = static_cast<Rect*>(allocPreferPsram(sizeof(Rect) * capacity));
+    _text = static_cast<char*>(allocPreferPsram(textBytes));
+    if (!_entries || !_culled || !_active || !_native || !_text) {
+        release();
+        return false;
+    }
+
+    _capacity = capacity;
+    _textBytes = textBytes;
+    reset();
+    return true;
+}
+
+void DisplayList::reset() {
+    _count = 0;
+    _textUsed = 0;
+}
+
+bool DisplayList::add(const DrawCommand& cmd, const Rect& bounds) {
+    if (_count >= _capacity) return false;
+
+    Entry& entry = _entries[_count];
+    entry.cmd = cmd;
+    entry.bounds = bounds;
+
+    // Callers often pass stack buffers (snprintf), so text is copied
+    if (cmd.type == DrawCommandType::DRAW_TEXT) {
+        const char* text = cmd.data ? static_cast<const char*>(cmd.data) : "";
+        size_t length = strlen(text) + 1;
+        if (_textUsed + length > _textBytes) return false;
+
+        char* copy = _text + _textUsed;
+        memcpy(copy, text, length);
+        _textUsed += length;
+        entry.cmd.data = copy;
+    }
+
+    entry.hash = hashCommand(entry.cmd);
+    _count++;
+    return true;
+}
+
+// =============================================================================
+// Diff
+// =============================================================================
+
+void DisplayList::diff(const DisplayList& previous, DirtyRectAccumulator& out) const {
+    // Walk both recordings in order. Each command is matched against the
+    // next DIFF_WINDOW unmatched previous commands; previous commands it
+    // skips over are gone. Matches keep their relative order, so outside
+    // the bounds added here every pixel sees the same command sequence.
+    uint32_t j = 0;
+    for (uint16_t i = 0; i < _count; i++) {
+        const Entry& entry = _entries[i];
+        uint32_t limit = std::min<uint32_t>(previous._count, j + DIFF_WINDOW);
+        uint32_t k = j;
+        while (k < limit && !sameCommand(entry, previous._entries[k])) k++;
+
+        if (k == limit) {
+            out.add(entry.bounds);
+            continue;
+        }
+        for (; j < k; j++) {
+            out.add(previous._entries[j].bounds);
+        }
+        j++;
+    }
+    for (; j < previous._count; j++) {
+        out.add(previous._entries[j].bounds);
+    }
+}
+
+bool DisplayList::sameCommand(const Entry& a, const Entry& b) {
+    if (a.hash != b.hash) return false;
+
+    const DrawCommand& x = a.cmd;
+    const DrawCommand& y = b.cmd;
+    if (x.type != y.type || x.x != y.x || x.y != y.y || x.w != y.w || x.h != y.h ||
+        x.extra1 != y.extra1 || x.extra2 != y.extra2 || x.black != y.black ||
+        x.font != y.font) {
+        return false;
+    }
+
+    // Bitmap contents are covered by the hash; the previous frame's
+    // buffer may already hold new pixels
+    if (x.type == DrawCommandType::DRAW_TEXT) {
+        return strcmp(static_cast<const char*>(x.data), static_cast<const char*>(y.data)) == 0;
+    }
+    return x.data == y.data;
+}
+
+uint32_t DisplayList::hashCommand(const DrawCommand& cmd) {
+    uint32_t hash = 2166136261u;
+    const int16_t fields[] = {static_cast<int16_t>(cmd.type), cmd.x, cmd.y, cmd.w, cmd.h,
+                              cmd.extra1, cmd.extra2, static_cast<int16_t>(cmd.black)};
+    hash = fnvMix(hash, fields, sizeof(fields));
+    hash = fnvMix(hash, &cmd.font, sizeof(cmd.font));
+
+    if (cmd.type == DrawCommandType::DRAW_TEXT) {
+        const char* text = static_cast<const char*>(cmd.data);
+        hash = fnvMix(hash, text, strlen(text));
+    } else if (cmd.type == DrawCommandType::DRAW_BITMAP && cmd.data && cmd.w > 0 && cmd.h > 0) {
+        // Rows padded to whole bytes, as Adafruit GFX drawBitmap reads them
+        hash = fnvMix(hash, cmd.data, static_cast<size_t>((cmd.w + 7) / 8) * cmd.h);
+    }
+    return hash;
+}
+
+// =============================================================================
+// Rasterization
+// =============================================================================
+
+void DisplayList::rasterize(DisplayDriver& display) const {
+    for (const Entry& entry : *this) {
+        execute(entry.cmd, display);
+    }
+}
+
+uint32_t DisplayList::rasterize(DisplayDriver& display, const DirtyRectAccumulator& dirty,
+                                int16_t bandRows) {
+    Framebuffer& fb = display.framebuffer();
+    Rect nativeArea = fb.toNative(dirty.getBounds());
+    if (nativeArea.isEmpty() || bandRows <= 0) return 0;
+
+    // Cull: keep commands that touch at least one dirty rect
+    uint16_t culled = 0;
+    for (uint16_t i = 0; i < _count; i++) {
+        for (const Rect& rect : dirty) {
+            if (_entries[i].bounds.intersects(rect)) {
+                _native[i] = fb.toNative(_entries[i].bounds);
+                if (!_native[i].isEmpty()) _culled[culled++] = i;
+                break;
+            }
+        }
+    }
+
+    // Sort survivors by first native row; each band then admits the ones
+    // starting in it and retires the ones that ended above it
+    const Rect* native = _native;
+    std::sort(_culled, _culled + culled, [native](uint16_t a, uint16_t b) {
+        return native[a].y != native[b].y ? native[a].y < native[b].y : a < b;
+    });
+
+    uint32_t executed = 0;
+    uint16_t next = 0;
+    uint16_t active = 0;    // _active holds entry indices in recording order
+    int16_t bandTop = nativeArea.y - nativeArea.y % bandRows;
+    for (; bandTop < nativeArea.bottom(); bandTop += bandRows) {
+        int16_t bandBottom = bandTop + bandRows;
+
+        uint16_t kept = 0;
+        for (uint16_t k = 0; k < active; k++) {
+            if (_native[_active[k]].bottom() > bandTop) _active[kept++] = _active[k];
+        }
+        active = kept;
+
+        for (; next < culled && _native[_culled[next]].y < bandBottom; next++) {
+            uint16_t index = _culled[next];
+            uint16_t k = active++;
+            for (; k > 0 && _active[k - 1] > index; k--) {
+                _active[k] = _active[k - 1];
+            }
+            _active[k] = index;
+        }
+
+        Rect band = fb.toLogical(Rect(0, bandTop, Framebuffer::NATIVE_WIDTH, bandRows));
+        for (const Rect& rect : dirty) {
+            Rect clip = rect.intersection(band);
+            if (clip.isEmpty()) continue;
+
+            fb.setClip(clip);
+            display.fillRect(clip, false);
+            for (uint16_t k = 0; k < active; k++) {
+                const Entry& entry = _entries[_active[k]];
+                if (entry.bounds.intersects(clip)) {
+                    execute(entry.cmd, display);
+                    executed++;
+                }
+            }
+        }
+    }
+    fb.clearClip();
+
+    return executed;
+}
+
+Rect DisplayList::execute(const DrawCommand& cmd, DisplayDriver& display) {
+    switch (cmd.type) {
+        case DrawCommandType::FILL_RECT:
+            display.fillRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.black);
+            break;
+        case DrawCommandType::DRAW_RECT:
+            display.drawRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.black);
+            break;
+        case DrawCommandType::FILL_ROUND_RECT:
+            display.fillRoundRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.extra1, cmd.black);
+            break;
+        case DrawCommandType::DRAW_ROUND_RECT:
+            display.drawRoundRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.extra1, cmd.black);
+            break;
+        case DrawCommandType::DRAW_LINE:
+            display.drawLine(cmd.x, cmd.y, cmd.extra1, cmd.extra2, cmd.black);
+            break;
+        case DrawCommandType::DRAW_HLINE:
+            display.drawHLine(cmd.x, cmd.y, cmd.w, cmd.black);
+            break;
+        case DrawCommandType::DRAW_VLINE:
+            display.drawVLine(cmd.x, cmd.y, cmd.h, cmd.black);
+            break;
+        case DrawCommandType::FILL_CIRCLE:
+            display.fillCircle(cmd.x, cmd.y, cmd.extra1, cmd.black);
+            break;
+        case DrawCommandType::DRAW_CIRCLE:
+            display.drawCircle(cmd.x, cmd.y, cmd.extra1, cmd.black);
+            break;
+        case DrawCommandType::DRAW_TEXT:
+            display.setFont(cmd.font);
+            display.setTextColor(cmd.black);
+            return display.drawText(static_cast<const char*>(cmd.data), cmd.x, cmd.y);
+        case DrawCommandType::FILL_SCREEN:
+            display.fillScreen(!cmd.black);
+            break;
+        case DrawCommandType::INVERT_RECT:
+            display.invertRect(Rect(cmd.x, cmd.y, cmd.w, cmd.h));
+            break;
+        case DrawCommandType::DRAW_BITMAP:
+            display.drawBitmap(cmd.x, cmd.y, static_cast<const uint8_t*>(cmd.data),
+                               cmd.w, cmd.h, cmd.black);
+            break;
+    }
+    return boundsOf(cmd, display);
+}
+
+Rect DisplayList::boundsOf(const DrawCommand& cmd, DisplayDriver& display) {
+    switch (cmd.type) {
+        case DrawCommandType::DRAW_LINE: {
+            int16_t minX = std::min(cmd.x, cmd.extra1);
+            int16_t minY = std::min(cmd.y, cmd.extra2);
+            int16_t maxX = std::max(cmd.x, cmd.extra1);
+            int16_t maxY = std::max(cmd.y, cmd.extra2);
+            return Rect(minX, minY, maxX - minX + 1, maxY - minY + 1);
+        }
+        case DrawCommandType::DRAW_HLINE:
+            return Rect(cmd.x, cmd.y, cmd.w, 1);
+        case DrawCommandType::DRAW_VLINE:
+            return Rect(cmd.x, cmd.y, 1, cmd.h);
+        case DrawCommandType::FILL_CIRCLE:
+        case DrawCommandType::DRAW_CIRCLE:
+            return Rect(cmd.x - cmd.extra1, cmd.y - cmd.extra1, cmd.extra1 * 2 + 1, cmd.extra1 * 2 + 1);
+        case DrawCommandType::DRAW_TEXT:
+            display.setFont(cmd.font);
+            return display.measureText(static_cast<const char*>(cmd.data)).at(cmd.x, cmd.y);
+        case DrawCommandType::FILL_SCREEN:
+            return Rect::full(config::display::WIDTH, config::display::HEIGHT);
+        default:
+            return Rect(cmd.x, cmd.y, cmd.w, cmd.h);
+    }
+}
+
+} // namespace paperhome
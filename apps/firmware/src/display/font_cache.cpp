@@ -0,0 +1,205 @@
+#include "display/font_cache.h"
+#include <esp_heap_caps.h>
+#include <algorithm>
+#include <cstring>
+
+namespace paperhome {
+
+namespace {
+
+/**
+ * @brief Allocate from PSRAM, falling back to internal RAM
+ */
+void* allocPreferPsram(size_t size) {
+    void* ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!ptr) {
+        ptr = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    return ptr;
+}
+
+inline uint32_t fnv1a(const char* text, uint16_t& length) {
+    uint32_t hash = 2166136261u;
+    length = 0;
+    while (*text) {
+        hash ^= static_cast<uint8_t>(*text++);
+        hash *= 16777619u;
+        length++;
+    }
+    return hash;
+}
+
+} // namespace
+
+// =============================================================================
+// GlyphAtlas
+// =============================================================================
+
+GlyphAtlas::~GlyphAtlas() {
+    release();
+}
+
+void GlyphAtlas::release() {
+    if (_glyphs) heap_caps_free(_glyphs);
+    if (_bitmap) heap_caps_free(_bitmap);
+    _glyphs = nullptr;
+    _bitmap = nullptr;
+    _bitmapBytes = 0;
+    _font = nullptr;
+}
+
+bool GlyphAtlas::build(const GFXfont* font, uint8_t rotation) {
+    release();
+    if (!font || font->last < font->first) return false;
+
+    const uint16_t count = font->last - font->first + 1;
+    const bool swapAxes = rotation & 1;
+
+    // Pass 1: native box sizes and total bitmap size
+    _glyphs = static_cast<Glyph*>(allocPreferPsram(sizeof(Glyph) * count));
+    if (!_glyphs) return false;
+
+    uint32_t total = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        const GFXglyph& src = font->glyph[i];
+        Glyph& g = _glyphs[i];
+        g.width = src.width;
+        g.height = src.height;
+        g.xOffset = src.xOffset;
+        g.yOffset = src.yOffset;
+        g.xAdvance = src.xAdvance;
+        g.nativeWidth = swapAxes ? src.height : src.width;
+        g.nativeHeight = swapAxes ? src.width : src.height;
+        g.stride = (g.nativeWidth + 7) / 8;
+        g.offset = total;
+        total += static_cast<uint32_t>(g.stride) * g.nativeHeight;
+    }
+
+    _bitmap = static_cast<uint8_t*>(allocPreferPsram(total ? total : 1));
+    if (!_bitmap) {
+        heap_caps_free(_glyphs);
+        _glyphs = nullptr;
+        return false;
+    }
+    memset(_bitmap, 0, total ? total : 1);
+
+    // Pass 2: unpack bit-packed rows and rotate into native orientation
+    for (uint16_t i = 0; i < count; i++) {
+        const GFXglyph& src = font->glyph[i];
+        const Glyph& g = _glyphs[i];
+        const uint8_t* bits = font->bitmap + src.bitmapOffset;
+        uint8_t* dst = _bitmap + g.offset;
+        uint32_t bit = 0;
+
+        for (uint8_t gy = 0; gy < src.height; gy++) {
+            for (uint8_t gx = 0; gx < src.width; gx++, bit++) {
+                if (!(bits[bit >> 3] & (0x80 >> (bit & 7)))) continue;
+
+                // Same mapping as Framebuffer::drawPixel, relative to the box
+                uint8_t lx, ly;
+                switch (rotation) {
+                    case 1:  lx = src.height - 1 - gy; ly = gx; break;
+                    case 2:  lx = src.width - 1 - gx; ly = src.height - 1 - gy; break;
+                    case 3:  lx = gy; ly = src.width - 1 - gx; break;
+                    default: lx = gx; ly = gy; break;
+                }
+                dst[ly * g.stride + (lx >> 3)] |= 0x80 >> (lx & 7);
+            }
+        }
+    }
+
+    _font = font;
+    _rotation = rotation;
+    _bitmapBytes = total;
+    return true;
+}
+
+// =============================================================================
+// FontCache
+// =============================================================================
+
+const GlyphAtlas* FontCache::atlas(const GFXfont* font, uint8_t rotation) {
+    if (!font) return nullptr;
+
+    GlyphAtlas* freeSlot = nullptr;
+    for (GlyphAtlas& atlas : _atlases) {
+        if (atlas.getFont() == font) {
+            if (atlas.getRotation() == rotation) return &atlas;
+            if (atlas.build(font, rotation)) return &atlas;
+            _fallbacks++;
+            return nullptr;
+        }
+        if (!freeSlot && !atlas.getFont()) freeSlot = &atlas;
+    }
+
+    // More fonts than slots: caller falls back
+    if (freeSlot && freeSlot->build(font, rotation)) return freeSlot;
+    _fallbacks++;
+    return nullptr;
+}
+
+uint8_t FontCache::getAtlasCount() const {
+    uint8_t count = 0;
+    for (const GlyphAtlas& atlas : _atlases) {
+        count += atlas.getFont() != nullptr;
+    }
+    return count;
+}
+
+TextBounds FontCache::measure(const GFXfont* font, const char* text) {
+    if (!font || !text) return TextBounds();
+
+    uint16_t length;
+    uint32_t hash = fnv1a(text, length);
+    _useCounter++;
+
+    BoundsEntry* victim = &_bounds[0];
+    for (BoundsEntry& entry : _bounds) {
+        if (entry.font == font && entry.hash == hash && entry.length == length) {
+            entry.lastUse = _useCounter;
+            _hits++;
+            return entry.bounds;
+        }
+        if (entry.lastUse < victim->lastUse) victim = &entry;
+    }
+
+    _misses++;
+    victim->font = font;
+    victim->hash = hash;
+    victim->length = length;
+    victim->lastUse = _useCounter;
+    victim->bounds = compute(font, text);
+    return victim->bounds;
+}
+
+TextBounds FontCache::compute(const GFXfont* font, const char* text) {
+    // Same rules as Adafruit GFX getTextBounds(), blank glyphs (space)
+    // included, so text lays out exactly as it did when GFX measured it
+    int16_t minX = INT16_MAX, minY = INT16_MAX;
+    int16_t maxX = INT16_MIN, maxY = INT16_MIN;
+    int16_t x = 0;
+
+    for (const char* p = text; *p; p++) {
+        uint8_t c = static_cast<uint8_t>(*p);
+        if (c < font->first || c > font->last) continue;
+
+        const GFXglyph& g = font->glyph[c - font->first];
+        minX = std::min<int16_t>(minX, x + g.xOffset);
+        minY = std::min<int16_t>(minY, g.yOffset);
+        maxX = std::max<int16_t>(maxX, x + g.xOffset + g.width - 1);
+        maxY = std::max<int16_t>(maxY, g.yOffset + g.height - 1);
+        x += g.xAdvance;
+    }
+
+    TextBounds bounds;
+    bounds.advance = x;
+    if (maxX >= minX && maxY >= minY) {
+        bounds.x1 = minX;
+        bounds.y1 = minY;
+        bounds.width = maxX - minX + 1;
+        bounds.height = maxY - minY + 1;
+    }
+    return bounds;
+}
+
+} // namespace paperhome
@@ -0,0 +1,111 @@
+#include "display/frame_diff.h"
+#include <algorithm>
+
+namespace paperhome {
+
+// =============================================================================
+// Diff
+// =============================================================================
+
+void FrameDiff::compute(const uint8_t* shown, const uint8_t* frame, const Rect& search,
+                        DirtyRectAccumulator& out) const {
+    Rect area = search.clamp(Framebuffer::NATIVE_WIDTH, Framebuffer::NATIVE_HEIGHT);
+    if (area.isEmpty()) return;
+
+    const uint8_t tx0 = area.x / TILE_WIDTH;
+    const uint8_t tx1 = (area.right() - 1) / TILE_WIDTH;
+    const uint8_t ty0 = area.y / TILE_HEIGHT;
+    const uint8_t ty1 = (area.bottom() - 1) / TILE_HEIGHT;
+
+    const uint32_t* prev = reinterpret_cast<const uint32_t*>(shown);
+    const uint32_t* next = reinterpret_cast<const uint32_t*>(frame);
+
+    // Candidates in tile units; open[] marks rects that ended on the previous tile row
+    Rect candidates[MAX_CANDIDATES];
+    bool open[MAX_CANDIDATES] = {};
+    size_t count = 0;
+
+    for (uint8_t ty = ty0; ty <= ty1; ty++) {
+        // Dirty tile mask for this tile row
+        uint32_t mask = 0;
+        const uint32_t* shownRow = prev + static_cast<uint32_t>(ty) * TILE_HEIGHT * Framebuffer::STRIDE_WORDS;
+        const uint32_t* nextRow = next + static_cast<uint32_t>(ty) * TILE_HEIGHT * Framebuffer::STRIDE_WORDS;
+        for (int16_t r = 0; r < TILE_HEIGHT; r++) {
+            for (uint8_t tx = tx0; tx <= tx1; tx++) {
+                if (shownRow[tx] != nextRow[tx]) mask |= 1u << tx;
+            }
+            shownRow += Framebuffer::STRIDE_WORDS;
+            nextRow += Framebuffer::STRIDE_WORDS;
+        }
+
+        bool extended[MAX_CANDIDATES] = {};
+
+        // Split mask into runs; extend a rect from the row above with the same span
+        while (mask) {
+            int16_t start = __builtin_ctz(mask);
+            int16_t end = start;
+            while (end + 1 < TILE_COLS && (mask & (1u << (end + 1)))) end++;
+            mask &= ~(((2u << end) - 1) & ~((1u << start) - 1));
+
+            bool merged = false;
+            for (size_t i = 0; i < count; i++) {
+                if (open[i] && candidates[i].x == start && candidates[i].right() == end + 1) {
+                    candidates[i].height++;
+                    extended[i] = true;
+                    merged = true;
+                    break;
+                }
+            }
+            if (merged) continue;
+
+            Rect run(start, ty, end - start + 1, 1);
+            if (count < MAX_CANDIDATES) {
+                extended[count] = true;
+                candidates[count++] = run;
+            } else {
+                candidates[count - 1] = candidates[count - 1].unionWith(run);
+                extended[count - 1] = true;
+            }
+        }
+
+        for (size_t i = 0; i < count; i++) open[i] = extended[i];
+    }
+
+    // Tile units -> native pixels, tightened to changed bytes/rows
+    for (size_t i = 0; i < count; i++) {
+        Rect px(candidates[i].x * TILE_WIDTH, candidates[i].y * TILE_HEIGHT,
+                candidates[i].width * TILE_WIDTH, candidates[i].height * TILE_HEIGHT);
+        out.add(tighten(shown, frame, px.intersection(area)));
+    }
+}
+
+Rect FrameDiff::tighten(const uint8_t* shown, const uint8_t* frame, const Rect& tileRect) const {
+    if (tileRect.isEmpty()) return Rect::empty();
+
+    const uint16_t b0 = tileRect.x / 8;
+    const uint16_t b1 = (tileRect.right() + 7) / 8;
+
+    int16_t minByte = INT16_MAX, maxByte = -1;
+    int16_t minY = INT16_MAX, maxY = -1;
+
+    for (int16_t y = tileRect.y; y < tileRect.bottom(); y++) {
+        uint32_t offset = static_cast<uint32_t>(y) * Framebuffer::STRIDE_BYTES;
+        bool rowChanged = false;
+        for (uint16_t b = b0; b < b1; b++) {
+            if (shown[offset + b] != frame[offset + b]) {
+                minByte = std::min<int16_t>(minByte, b);
+                maxByte = std::max<int16_t>(maxByte, b);
+                rowChanged = true;
+            }
+        }
+        if (rowChanged) {
+            minY = std::min(minY, y);
+            maxY = y;
+        }
+    }
+
+    if (maxY < 0) return Rect::empty();
+    return Rect(minByte * 8, minY, (maxByte - minByte + 1) * 8, maxY - minY + 1);
+}
+
+} // namespace paperhome
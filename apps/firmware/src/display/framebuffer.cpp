@@ -0,0 +1,279 @@
+#include "display/framebuffer.h"
+#include <esp_heap_caps.h>
+#include <cstring>
+
+namespace paperhome {
+
+namespace {
+
+/**
+ * @brief Word mask for pixels [first, last] of a 32-pixel group
+ *
+ * Pixels are MSB-first within each byte, so the mask is built in display
+ * order and byte-swapped to match a little-endian word load.
+ */
+inline uint32_t spanMask(uint8_t first, uint8_t last) {
+    uint32_t mask = (0xFFFFFFFFu >> first) & (0xFFFFFFFFu << (31 - last));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return __builtin_bswap32(mask);
+#else
+    return mask;
+#endif
+}
+
+uint32_t* allocBuffer() {
+    void* ptr = heap_caps_malloc(Framebuffer::SIZE_BYTES, MALLOC_CAP_SPIRAM | MALLOC_CAP_32BIT);
+    if (!ptr) {
+        ptr = heap_caps_malloc(Framebuffer::SIZE_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_32BIT);
+    }
+    return static_cast<uint32_t*>(ptr);
+}
+
+} // namespace
+
+Framebuffer::Framebuffer()
+    : Adafruit_GFX(NATIVE_WIDTH, NATIVE_HEIGHT)
+    , _buffer(nullptr)
+    , _front(nullptr)
+{
+}
+
+Framebuffer::~Framebuffer() {
+    if (_buffer) {
+        heap_caps_free(_buffer);
+    }
+    if (_front) {
+        heap_caps_free(_front);
+    }
+}
+
+bool Framebuffer::begin() {
+    if (!_buffer) _buffer = allocBuffer();
+    if (!_front) _front = allocBuffer();
+    if (!_buffer || !_front) return false;
+
+    memset(_buffer, 0xFF, SIZE_BYTES);
+    memset(_front, 0xFF, SIZE_BYTES);
+    return true;
+}
+
+// =============================================================================
+// Adafruit GFX overrides
+// =============================================================================
+
+void Framebuffer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || x >= width() || y < 0 || y >= height()) return;
+    if (_clipping && !_clip.contains(x, y)) return;
+
+    switch (getRotation()) {
+        case 1:
+            std::swap(x, y);
+            x = NATIVE_WIDTH - x - 1;
+            break;
+        case 2:
+            x = NATIVE_WIDTH - x - 1;
+            y = NATIVE_HEIGHT - y - 1;
+            break;
+        case 3:
+            std::swap(x, y);
+            y = NATIVE_HEIGHT - y - 1;
+            break;
+    }
+
+    uint8_t* byte = reinterpret_cast<uint8_t*>(_buffer) + y * STRIDE_BYTES + x / 8;
+    uint8_t bit = 0x80 >> (x & 7);
+    if (color) {
+        *byte |= bit;
+    } else {
+        *byte &= ~bit;
+    }
+}
+
+void Framebuffer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    applyLogical(x, y, w, 1, color ? SpanOp::SET : SpanOp::CLEAR);
+}
+
+void Framebuffer::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    applyLogical(x, y, 1, h, color ? SpanOp::SET : SpanOp::CLEAR);
+}
+
+void Framebuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    applyLogical(x, y, w, h, color ? SpanOp::SET : SpanOp::CLEAR);
+}
+
+void Framebuffer::fillScreen(uint16_t color) {
+    if (_clipping) {
+        applyLogical(_clip.x, _clip.y, _clip.width, _clip.height, color ? SpanOp::SET : SpanOp::CLEAR);
+        return;
+    }
+    memset(_buffer, color ? 0xFF : 0x00, SIZE_BYTES);
+}
+
+// =============================================================================
+// Page flipping
+// =============================================================================
+
+void Framebuffer::copyFrontToBack(const Rect& native) {
+    Rect r = native.clamp(NATIVE_WIDTH, NATIVE_HEIGHT);
+    if (r.isEmpty()) return;
+
+    const uint16_t firstByte = r.x / 8;
+    const uint16_t bytes = (r.right() + 7) / 8 - firstByte;
+    const uint8_t* front = reinterpret_cast<const uint8_t*>(_front);
+    uint8_t* back = reinterpret_cast<uint8_t*>(_buffer);
+
+    for (int16_t y = r.y; y < r.bottom(); y++) {
+        uint32_t offset = static_cast<uint32_t>(y) * STRIDE_BYTES + firstByte;
+        memcpy(back + offset, front + offset, bytes);
+    }
+}
+
+void Framebuffer::copyFrontToBack() {
+    memcpy(_buffer, _front, SIZE_BYTES);
+}
+
+// =============================================================================
+// Framebuffer operations
+// =============================================================================
+
+void Framebuffer::invertRect(const Rect& rect) {
+    applyLogical(rect.x, rect.y, rect.width, rect.height, SpanOp::INVERT);
+}
+
+void Framebuffer::setClip(const Rect& rect) {
+    _clip = rect.clamp(width(), height());
+    _clipNative = mapToNative(_clip);
+    _clipping = true;
+}
+
+Rect Framebuffer::toNative(const Rect& rect) const {
+    Rect r = rect.clamp(width(), height());
+    if (r.isEmpty()) return Rect::empty();
+    return mapToNative(r);
+}
+
+Rect Framebuffer::mapToNative(const Rect& r) const {
+    switch (getRotation()) {
+        case 1:
+            return Rect(NATIVE_WIDTH - r.y - r.height, r.x, r.height, r.width);
+        case 2:
+            return Rect(NATIVE_WIDTH - r.x - r.width, NATIVE_HEIGHT - r.y - r.height, r.width, r.height);
+        case 3:
+            return Rect(r.y, NATIVE_HEIGHT - r.x - r.width, r.height, r.width);
+        default:
+            return r;
+    }
+}
+
+Rect Framebuffer::toLogical(const Rect& native) const {
+    Rect r = native.clamp(NATIVE_WIDTH, NATIVE_HEIGHT);
+    if (r.isEmpty()) return Rect::empty();
+
+    switch (getRotation()) {
+        case 1:
+            return Rect(r.y, NATIVE_WIDTH - r.x - r.width, r.height, r.width);
+        case 2:
+            return Rect(NATIVE_WIDTH - r.x - r.width, NATIVE_HEIGHT - r.y - r.height, r.width, r.height);
+        case 3:
+            return Rect(NATIVE_HEIGHT - r.y - r.height, r.x, r.height, r.width);
+        default:
+            return r;
+    }
+}
+
+void Framebuffer::blitNative(const uint8_t* src, uint8_t stride, const Rect& native, bool black) {
+    const Rect limit = _clipping ? _clipNative : Rect(0, 0, NATIVE_WIDTH, NATIVE_HEIGHT);
+    const int16_t y0 = std::max(native.y, limit.y);
+    const int16_t y1 = std::min(native.bottom(), limit.bottom());
+    if (y0 >= y1 || native.x >= limit.right() || native.right() <= limit.x) return;
+
+    uint8_t* buffer = reinterpret_cast<uint8_t*>(_buffer);
+    const bool inside = native.x >= limit.x && native.right() <= limit.right();
+    const uint8_t shift = native.x & 7;
+
+    for (int16_t y = y0; y < y1; y++) {
+        const uint8_t* row = src + (y - native.y) * stride;
+        uint8_t* dst = buffer + y * STRIDE_BYTES;
+
+        if (inside) {
+            // Fast path: each source byte lands in at most two target bytes
+            dst += native.x >> 3;
+            for (uint8_t b = 0; b < stride; b++) {
+                uint8_t bits = row[b];
+                if (!bits) continue;
+
+                uint8_t hi = bits >> shift;
+                uint8_t lo = shift ? static_cast<uint8_t>(bits << (8 - shift)) : 0;
+                if (black) {
+                    dst[b] &= ~hi;
+                    if (lo) dst[b + 1] &= ~lo;
+                } else {
+                    dst[b] |= hi;
+                    if (lo) dst[b + 1] |= lo;
+                }
+            }
+            continue;
+        }
+
+        // Partially clipped: per pixel
+        for (int16_t i = 0; i < native.width; i++) {
+            int16_t x = native.x + i;
+            if (x < limit.x || x >= limit.right()) continue;
+            if (!(row[i >> 3] & (0x80 >> (i & 7)))) continue;
+
+            uint8_t bit = 0x80 >> (x & 7);
+            if (black) dst[x >> 3] &= ~bit;
+            else dst[x >> 3] |= bit;
+        }
+    }
+}
+
+void Framebuffer::applyLogical(int16_t x, int16_t y, int16_t w, int16_t h, SpanOp op) {
+    if (w <= 0 || h <= 0) return;
+    Rect rect(x, y, w, h);
+    if (_clipping) rect = rect.intersection(_clip);
+    Rect native = toNative(rect);
+    if (!native.isEmpty()) {
+        applyNative(native, op);
+    }
+}
+
+void Framebuffer::applyNative(const Rect& native, SpanOp op) {
+    const int16_t x0 = native.x;
+    const int16_t x1 = native.right() - 1;
+    const uint16_t firstWord = x0 >> 5;
+    const uint16_t lastWord = x1 >> 5;
+    const uint32_t headMask = spanMask(x0 & 31, firstWord == lastWord ? (x1 & 31) : 31);
+    const uint32_t tailMask = spanMask(0, x1 & 31);
+
+    uint32_t* row = _buffer + native.y * STRIDE_WORDS;
+    for (int16_t r = 0; r < native.height; r++, row += STRIDE_WORDS) {
+        uint32_t* word = row + firstWord;
+
+        switch (op) {
+            case SpanOp::SET:
+                *word |= headMask;
+                if (firstWord != lastWord) {
+                    for (uint16_t i = firstWord + 1; i < lastWord; i++) row[i] = 0xFFFFFFFFu;
+                    row[lastWord] |= tailMask;
+                }
+                break;
+            case SpanOp::CLEAR:
+                *word &= ~headMask;
+                if (firstWord != lastWord) {
+                    for (uint16_t i = firstWord + 1; i < lastWord; i++) row[i] = 0;
+                    row[lastWord] &= ~tailMask;
+                }
+                break;
+            case SpanOp::INVERT:
+                *word ^= headMask;
+                if (firstWord != lastWord) {
+                    for (uint16_t i = firstWord + 1; i < lastWord; i++) row[i] = ~row[i];
+                    row[lastWord] ^= tailMask;
+                }
+                break;
+        }
+    }
+}
+
+} // namespace paperhome
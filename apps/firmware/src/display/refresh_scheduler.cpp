@@ -0,0 +1,99 @@
+#include "display/refresh_scheduler.h"
+#include "core/config.h"
+#include <cstring>
+
+namespace paperhome {
+
+RefreshScheduler::RefreshScheduler()
+    : _lastInput(0)
+{
+    recordFull();
+}
+
+// =============================================================================
+// Heat map
+// =============================================================================
+
+void RefreshScheduler::recordPartial(const uint8_t* shown, const uint8_t* next, const Rect& native) {
+    Rect r = native.clamp(Framebuffer::NATIVE_WIDTH, Framebuffer::NATIVE_HEIGHT);
+    if (r.isEmpty()) return;
+
+    // Flips per tile column for the tile row being scanned
+    const uint16_t firstByte = r.x / 8;
+    const uint16_t lastByte = (r.right() + 7) / 8;
+    uint32_t rowFlips[TILE_COLS] = {};
+
+    for (int16_t y = r.y; y < r.bottom(); y++) {
+        uint32_t offset = static_cast<uint32_t>(y) * Framebuffer::STRIDE_BYTES;
+        for (uint16_t b = firstByte; b < lastByte; b++) {
+            rowFlips[b / 4] += __builtin_popcount(shown[offset + b] ^ next[offset + b]);
+        }
+
+        // Flush at the end of each tile row (and of the window)
+        if ((y + 1) % TILE_SIZE != 0 && y + 1 != r.bottom()) continue;
+
+        const uint8_t row = y / TILE_SIZE;
+        for (uint8_t col = firstByte / 4; col <= (lastByte - 1) / 4; col++) {
+            if (!rowFlips[col]) continue;
+            _flips[row][col] += rowFlips[col];
+            if (_partials[row][col] < UINT8_MAX) _partials[row][col]++;
+            rowFlips[col] = 0;
+        }
+    }
+}
+
+void RefreshScheduler::recordFull() {
+    memset(_partials, 0, sizeof(_partials));
+    memset(_flips, 0, sizeof(_flips));
+}
+
+void RefreshScheduler::recordClean(const Rect& native) {
+    for (uint8_t row = 0; row < TILE_ROWS; row++) {
+        for (uint8_t col = 0; col < TILE_COLS; col++) {
+            if (native.contains(tileRect(col, row))) {
+                _partials[row][col] = 0;
+                _flips[row][col] = 0;
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Scheduling
+// =============================================================================
+
+bool RefreshScheduler::isOverBudget(uint8_t col, uint8_t row) const {
+    return _partials[row][col] >= config::display::GHOST_PARTIAL_BUDGET ||
+           _flips[row][col] >= config::display::GHOST_FLIP_BUDGET;
+}
+
+uint16_t RefreshScheduler::getTilesOverBudget() const {
+    uint16_t count = 0;
+    for (uint8_t row = 0; row < TILE_ROWS; row++) {
+        for (uint8_t col = 0; col < TILE_COLS; col++) {
+            if (isOverBudget(col, row)) count++;
+        }
+    }
+    return count;
+}
+
+RefreshScheduler::Action RefreshScheduler::poll(uint32_t now, DirtyRectAccumulator& regions) const {
+    // Never interrupt interaction with a clean-up flash
+    if (now - _lastInput < config::display::GHOST_IDLE_MS) return Action::NONE;
+
+    uint16_t over = getTilesOverBudget();
+    if (over == 0) return Action::NONE;
+
+    if (static_cast<uint32_t>(over) * 100 >= static_cast<uint32_t>(TILE_COUNT) * config::display::GHOST_FULL_PERCENT) {
+        return Action::FULL;
+    }
+
+    for (uint8_t row = 0; row < TILE_ROWS; row++) {
+        for (uint8_t col = 0; col < TILE_COLS; col++) {
+            if (isOverBudget(col, row)) regions.add(tileRect(col, row));
+        }
+    }
+    return Action::CLEAN;
+}
+
+} // namespace paperhome
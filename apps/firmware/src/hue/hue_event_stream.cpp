@@ -0,0 +1,303 @@
+#include "hue/hue_event_stream.h"
+#include <ArduinoJson.h>
+#include <HTTPClient.h>
+#include <WiFi.h>
+#include <stdarg.h>
+
+namespace paperhome {
+
+static const char* const EVENT_STREAM_URL = "https://%s/eventstream/clip/v2";
+
+// Fields of an event that map onto HueRoomData; the rest (color,
+// gradients, owners, dynamics) is skipped while parsing
+static const JsonDocument& eventFilter() {
+    static const JsonDocument filter = [] {
+        JsonDocument doc;
+        JsonObject event = doc.add<JsonObject>();
+        event["type"] = true;
+        JsonObject item = event["data"].add<JsonObject>();
+        item["type"] = true;
+        item["id_v1"] = true;
+        item["on"]["on"] = true;
+        item["dimming"]["brightness"] = true;
+        return doc;
+    }();
+    return filter;
+}
+
+// Room deltas in one data: payload, passed to queue(). Sets resync for
+// changes a delta cannot express.
+template<typename Queue>
+static void collectDeltas(JsonDocument& doc, bool& resync, Queue&& queue) {
+    for (JsonObject event : doc.as<JsonArray>()) {
+        // "add"/"delete" change which rooms exist
+        if (strcmp(event["type"] | "", "update") != 0) {
+            resync = true;
+            continue;
+        }
+
+        for (JsonObject item : event["data"].as<JsonArray>()) {
+            const char* type = item["type"] | "";
+
+            if (strcmp(type, "light") == 0) {
+                // The room's grouped_light update follows, but all_on needs a fetch
+                if (!item["on"]["on"].isNull()) {
+                    resync = true;
+                }
+                continue;
+            }
+
+            // grouped_light of a room or zone: id_v1 is "/groups/<v1 ID>"
+            const char* idV1 = item["id_v1"] | "";
+            if (strcmp(type, "grouped_light") != 0 || strncmp(idV1, "/groups/", 8) != 0) {
+                continue;
+            }
+
+            HueEventStream::Delta delta;
+            strncpy(delta.roomId, idV1 + 8, sizeof(delta.roomId) - 1);
+            if (item["on"]["on"].is<bool>()) {
+                delta.fields |= HueEventStream::ON;
+                delta.on = item["on"]["on"].as<bool>();
+            }
+            if (item["dimming"]["brightness"].is<float>()) {
+                // v2 brightness is a percentage, v1 (HueRoomData) 0-254
+                const float percent = item["dimming"]["brightness"].as<float>();
+                delta.fields |= HueEventStream::BRIGHTNESS;
+                delta.brightness = static_cast<uint8_t>(percent * 254.0f / 100.0f + 0.5f);
+            }
+            if (delta.fields) {
+                queue(delta);
+            }
+        }
+    }
+}
+
+HueEventStream::HueEventStream()
+    : _task(nullptr)
+    , _stopRequested(false)
+    , _taskDone(false)
+    , _connected(false)
+    , _resync(false)
+    , _connects(0)
+    , _drops(0)
+    , _events(0)
+    , _deltaCount(0)
+{
+    _bridgeIP[0] = '\0';
+    _appKey[0] = '\0';
+}
+
+HueEventStream::~HueEventStream() {
+    stop();
+}
+
+bool HueEventStream::start(const char* bridgeIP, const char* appKey) {
+    if (_task) {
+        return true;
+    }
+
+    strncpy(_bridgeIP, bridgeIP, sizeof(_bridgeIP) - 1);
+    _bridgeIP[sizeof(_bridgeIP) - 1] = '\0';
+    strncpy(_appKey, appKey, sizeof(_appKey) - 1);
+    _appKey[sizeof(_appKey) - 1] = '\0';
+
+    _stopRequested = false;
+    _taskDone = false;
+
+    BaseType_t created = xTaskCreatePinnedToCore(
+        streamTask, "HueEvents", config::tasks::HUE_EVENTS_STACK, this,
+        config::tasks::HUE_EVENTS_PRIORITY, &_task, config::tasks::NET_CORE);
+    if (created != pdPASS) {
+        _task = nullptr;
+        log("Failed to start event stream task");
+        return false;
+    }
+    return true;
+}
+
+void HueEventStream::stop() {
+    if (!_task) {
+        return;
+    }
+
+    // The task checks the flag between reads and retries
+    _stopRequested = true;
+    while (!_taskDone) {
+        vTaskDelay(pdMS_TO_TICKS(config::hue::EVENT_READ_POLL_MS));
+    }
+    _task = nullptr;
+    _connected = false;
+
+    Delta stale;
+    while (_deltas.pop(stale)) {
+    }
+}
+
+HueEventStream::Stats HueEventStream::getStats() const {
+    Stats stats;
+    stats.connects = _connects;
+    stats.drops = _drops;
+    stats.events = _events;
+    stats.deltas = _deltaCount;
+    return stats;
+}
+
+// =============================================================================
+// Stream Task
+// =============================================================================
+
+void HueEventStream::streamTask(void* param) {
+    static_cast<HueEventStream*>(param)->run();
+    vTaskDelete(nullptr);
+}
+
+void HueEventStream::run() {
+    WiFiClientSecure client;
+    client.setInsecure();   // Bridge certificate is self-signed
+    HTTPClient http;
+    uint32_t retryMs = config::hue::EVENT_RECONNECT_MS;
+
+    while (!_stopRequested) {
+        if (WiFi.status() == WL_CONNECTED && open(http, client)) {
+            _connects++;
+            _connected.store(true, std::memory_order_release);
+            retryMs = config::hue::EVENT_RECONNECT_MS;
+
+            // Events may have been missed while the stream was down
+            _resync = true;
+            log("Event stream connected");
+
+            readEvents(client);
+
+            _connected.store(false, std::memory_order_release);
+            if (!_stopRequested) {
+                _drops++;
+                log("Event stream closed, polling until it reconnects");
+            }
+        }
+        http.end();
+        client.stop();
+
+        // The service polls in the meantime
+        const uint32_t start = millis();
+        while (!_stopRequested && millis() - start < retryMs) {
+            vTaskDelay(pdMS_TO_TICKS(config::hue::EVENT_READ_POLL_MS * 5));
+        }
+        retryMs = retryMs * 2 < config::hue::EVENT_RECONNECT_MAX_MS
+                ? retryMs * 2 : config::hue::EVENT_RECONNECT_MAX_MS;
+    }
+
+    _taskDone = true;
+}
+
+bool HueEventStream::open(HTTPClient& http, WiFiClientSecure& client) {
+    char url[64];
+    snprintf(url, sizeof(url), EVENT_STREAM_URL, _bridgeIP);
+
+    // HTTP/1.0: the body arrives without chunk framing, and the
+    // connection is never reused anyway
+    http.useHTTP10(true);
+    http.setTimeout(config::hue::REQUEST_TIMEOUT_MS);
+    if (!http.begin(client, url)) {
+        return false;
+    }
+    http.addHeader("hue-application-key", _appKey);
+    http.addHeader("Accept", "text/event-stream");
+
+    int code = http.GET();
+    if (code != HTTP_CODE_OK) {
+        logf("Event stream refused: %d", code);
+        return false;
+    }
+    return true;
+}
+
+void HueEventStream::readEvents(WiFiClientSecure& client) {
+    JsonDocument doc;
+
+    while (!_stopRequested) {
+        int c = nextByte(client);
+        if (c < 0) {
+            return;
+        }
+        if (c == '\n' || c == '\r') {
+            continue;   // Blank line ends an event
+        }
+
+        // Field name: "data", "id", or empty for a ": comment" line
+        char field[8];
+        size_t len = 0;
+        while (c >= 0 && c != ':' && c != '\n') {
+            if (len < sizeof(field) - 1) {
+                field[len++] = static_cast<char>(c);
+            }
+            c = nextByte(client);
+        }
+        field[len] = '\0';
+
+        if (c == ':' && strcmp(field, "data") == 0) {
+            DeserializationError error = deserializeJson(doc, client, DeserializationOption::Filter(eventFilter()));
+            if (error) {
+                logf("Event parse error: %s", error.c_str());
+                _resync = true;
+            } else {
+                _events++;
+                bool resync = false;
+                collectDeltas(doc, resync, [this](const Delta& delta) { queue(delta); });
+                if (resync) {
+                    _resync = true;
+                }
+            }
+        }
+
+        // Rest of the line: id value, comment text, or what follows the JSON
+        while (c != '\n') {
+            c = nextByte(client);
+            if (c < 0) {
+                return;
+            }
+        }
+    }
+}
+
+int HueEventStream::nextByte(WiFiClientSecure& client) {
+    while (!_stopRequested) {
+        int c = client.read();
+        if (c >= 0) {
+            return c;
+        }
+        if (!client.connected()) {
+            return -1;
+        }
+        vTaskDelay(pdMS_TO_TICKS(config::hue::EVENT_READ_POLL_MS));
+    }
+    return -1;
+}
+
+void HueEventStream::queue(const Delta& delta) {
+    if (_deltas.push(delta)) {
+        _deltaCount++;
+    } else {
+        // I/O task fell behind: refetch everything instead
+        _resync = true;
+    }
+}
+
+void HueEventStream::log(const char* msg) {
+    if (config::debug::HUE_DBG) {
+        Serial.printf("[HueEvents] %s\n", msg);
+    }
+}
+
+void HueEventStream::logf(const char* fmt, ...) {
+    if (config::debug::HUE_DBG) {
+        char buffer[128];
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(buffer, sizeof(buffer), fmt, args);
+        va_end(args);
+        Serial.printf("[HueEvents] %s\n", buffer);
+    }
+}
+
+} // namespace paperhome
@@ -1,5 +1,6 @@
 #include "hue/hue_service.h"
 #include <ArduinoJson.h>
+#include <HTTPClient.h>
 #include <Preferences.h>
 #include <stdarg.h>
 
@@ -12,11 +13,112 @@ static const uint16_t SSDP_PORT = 1900;
 // Static empty room for out-of-bounds access
 static const HueRoomData EMPTY_ROOM = {};
 
-HueService::HueService()
+// Request templates: URLs are filled in after the preformatted
+// "http://<ip>/api/<username>" base, so no String concatenation per call
+static const char* const GROUPS_URL = "%s/groups";
+static const char* const GROUP_ACTION_URL = "%s/groups/%s/action";
+static const char* const STATE_ON_BODY = "{\"on\":true}";
+static const char* const STATE_OFF_BODY = "{\"on\":false}";
+static const char* const BRIGHTNESS_BODY = "{\"on\":true,\"bri\":%u}";
+
+// Fields of a /groups entry that HueRoomData keeps; the rest (scenes,
+// xy/ct, stream, locations) is skipped while parsing
+static const JsonDocument& groupFilter() {
+    static const JsonDocument filter = [] {
+        JsonDocument doc;
+        doc["type"] = true;
+        doc["name"] = true;
+        doc["class"] = true;
+        doc["state"]["any_on"] = true;
+        doc["state"]["all_on"] = true;
+        doc["action"]["bri"] = true;
+        doc["lights"] = true;
+        return doc;
+    }();
+    return filter;
+}
+
+/**
+ * @brief Pass-through Stream that hashes (FNV-1a) every byte read from it
+ */
+class HashingStream : public Stream {
+public:
+    explicit HashingStream(Stream& source) : _source(source), _hash(2166136261u) {}
+
+    int available() override { return _source.available(); }
+    int peek() override { return _source.peek(); }
+    size_t write(uint8_t) override { return 0; }
+
+    int read() override {
+        const int c = _source.read();
+        if (c >= 0) {
+            _hash = (_hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        }
+        return c;
+    }
+
+    // Hash the rest of the body (what the parser did not need)
+    uint32_t finish() {
+        while (read() >= 0) {
+        }
+        return _hash;
+    }
+
+private:
+    Stream& _source;
+    uint32_t _hash;
+};
+
+// Group PUTs answer 200 even when a light rejects the command:
+// [{"error":{...}}] instead of [{"success":{...}}]
+static bool commandSucceeded(const NetResponse& response) {
+    return response.code == HTTP_CODE_OK && response.body.indexOf("\"error\"") < 0;
+}
+
+// Next non-whitespace character of a body, -1 at its end
+static int nextToken(Stream& body) {
+    int c;
+    do {
+        c = body.read();
+    } while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+    return c;
+}
+
+// Rest of a quoted key (opening quote already read), truncated to size
+static bool readKey(Stream& body, char* out, size_t size) {
+    size_t len = 0;
+    for (int c = body.read(); c >= 0; c = body.read()) {
+        if (c == '"') {
+            out[len] = '\0';
+            return true;
+        }
+        if (len < size - 1) {
+            out[len++] = static_cast<char>(c);
+        }
+    }
+    return false;
+}
+
+HueService::HueService(NetworkWorker& network)
     : _stateMachine(HueState::DISCONNECTED)
     , _stateCallback(nullptr)
     , _roomsCallback(nullptr)
     , _roomCount(0)
+    , _bridgeCount(0)
+    , _fetchedCount(0)
+    , _fetchedHash(0)
+    , _roomsHash(0)
+    , _pollIntervalMs(config::hue::POLL_INTERVAL_MS)
+    , _incrementalPoll(config::hue::INCREMENTAL_POLL)
+    , _eventStream(config::hue::EVENT_STREAM)
+    , _streamUp(false)
+    , _lastGroupCommandAt(0)
+    , _coalesce(config::hue::COALESCE_BRIGHTNESS)
+    , _network(network)
+    , _ssdpListening(false)
+    , _fetchPending(false)
+    , _refetchQueued(false)
+    , _authPending(false)
     , _lastPollTime(0)
     , _lastDiscoveryTime(0)
     , _authStartTime(0)
@@ -24,7 +126,12 @@ HueService::HueService()
 {
     memset(_bridgeIP, 0, sizeof(_bridgeIP));
     memset(_username, 0, sizeof(_username));
+    memset(_baseUrl, 0, sizeof(_baseUrl));
     memset(_rooms, 0, sizeof(_rooms));
+    memset(_bridgeRooms, 0, sizeof(_bridgeRooms));
+    memset(_fetchedRooms, 0, sizeof(_fetchedRooms));
+    memset(_targets, 0, sizeof(_targets));
+    _lastGroupCommandAt = millis() - config::hue::GROUP_COMMAND_INTERVAL_MS;
 
     _stateMachine.setTransitionCallback(
         [this](HueState oldState, HueState newState, const char* message) {
@@ -42,9 +149,7 @@ void HueService::init() {
         _stateMachine.setState(HueState::CONNECTED, "Credentials loaded");
 
         // Fetch rooms immediately
-        if (fetchRooms()) {
-            log("Rooms loaded successfully");
-        }
+        fetchRooms();
     } else {
         log("No stored credentials, starting discovery...");
         startDiscovery();
@@ -80,6 +185,11 @@ void HueService::update() {
 }
 
 void HueService::handleDiscovering() {
+    if (_ssdpListening) {
+        readSSDPResponses();
+        return;
+    }
+
     // Retry discovery every 5 seconds
     if (millis() - _lastDiscoveryTime >= 5000) {
         sendSSDPRequest();
@@ -103,10 +213,35 @@ void HueService::handleWaitingForButton() {
 }
 
 void HueService::handleConnected() {
-    // Poll for room updates at configured interval
-    if (millis() - _lastPollTime >= config::hue::POLL_INTERVAL_MS) {
+    if (_eventStream && !_events.isRunning()) {
+        _events.start(_bridgeIP, _username);
+    }
+    applyEvents();
+    sendBrightness();
+
+    // A command whose result never showed up: show the bridge state again
+    if (_pending.expire(millis(), config::hue::PENDING_TIMEOUT_MS)) {
+        publishRooms();
+    }
+
+    // Polling covers for the stream: back to the normal interval (and one
+    // poll right away) when it drops, a slow resync while it is up
+    const bool streamUp = _events.isConnected();
+    if (streamUp != _streamUp) {
+        _streamUp = streamUp;
+        if (!streamUp) {
+            _pollIntervalMs = config::hue::POLL_INTERVAL_MS;
+            _lastPollTime = millis() - _pollIntervalMs;
+        }
+    }
+    const uint32_t interval = _streamUp ? config::hue::POLL_INTERVAL_STREAM_MS : _pollIntervalMs;
+
+    // Poll for room updates; once rooms are known, an incremental poll
+    // only hashes the body
+    if (!_fetchPending && millis() - _lastPollTime >= interval) {
         _lastPollTime = millis();
-        fetchRooms();
+        _pollStats.polls++;
+        fetchRooms(NetPriority::BACKGROUND, _incrementalPoll && _roomsHash != 0);
     }
 }
 
@@ -120,6 +255,10 @@ void HueService::sendSSDPRequest() {
     log("Sending SSDP M-SEARCH...");
     _lastDiscoveryTime = millis();
 
+    if (_ssdpListening) {
+        _udp.stop();
+    }
+
     // SSDP M-SEARCH request
     const char* ssdpRequest =
         "M-SEARCH * HTTP/1.1\r\n"
@@ -134,25 +273,28 @@ void HueService::sendSSDPRequest() {
     _udp.write((const uint8_t*)ssdpRequest, strlen(ssdpRequest));
     _udp.endPacket();
 
-    // Wait for responses (blocking for up to 3 seconds)
-    uint32_t startTime = millis();
-    while (millis() - startTime < 3000) {
-        int packetSize = _udp.parsePacket();
-        if (packetSize > 0) {
-            char buffer[512];
-            int len = _udp.read(buffer, sizeof(buffer) - 1);
-            buffer[len] = '\0';
-
-            if (parseDiscoveryResponse(buffer)) {
-                _udp.stop();
-                return;
-            }
+    // Replies are read by update() for the next 3 seconds
+    _ssdpListening = true;
+}
+
+void HueService::readSSDPResponses() {
+    while (_udp.parsePacket() > 0) {
+        char buffer[512];
+        int len = _udp.read(buffer, sizeof(buffer) - 1);
+        buffer[len > 0 ? len : 0] = '\0';
+
+        if (parseDiscoveryResponse(buffer)) {
+            _udp.stop();
+            _ssdpListening = false;
+            return;
         }
-        delay(10);
     }
 
-    _udp.stop();
-    log("No Hue Bridge found, will retry...");
+    if (millis() - _lastDiscoveryTime >= 3000) {
+        _udp.stop();
+        _ssdpListening = false;
+        log("No Hue Bridge found, will retry...");
+    }
 }
 
 bool HueService::parseDiscoveryResponse(const char* response) {
@@ -193,15 +335,32 @@ bool HueService::parseDiscoveryResponse(const char* response) {
 }
 
 bool HueService::sendAuthRequest() {
+    if (_authPending) {
+        return false;
+    }
+
     _authAttempts++;
     logf("Authentication attempt %d...", _authAttempts);
 
-    String url = "http://" + String(_bridgeIP) + "/api";
-    String body = "{\"devicetype\":\"" + String(config::hue::DEVICE_TYPE) + "\"}";
-    String response;
+    char url[URL_SIZE];
+    snprintf(url, sizeof(url), "http://%s/api", _bridgeIP);
+    char body[64];
+    snprintf(body, sizeof(body), "{\"devicetype\":\"%s\"}", config::hue::DEVICE_TYPE);
 
-    if (!httpPost(url, body, response)) {
-        return false;
+    _authPending = submit(NetMethod::POST, url, body, NetPriority::BACKGROUND,
+        [this](const NetResponse& response) {
+            _authPending = false;
+            if (response.code == HTTP_CODE_OK) {
+                handleAuthResponse(response.body);
+            }
+        });
+    return _authPending;
+}
+
+void HueService::handleAuthResponse(const String& response) {
+    // Timed out or reset while the request was in flight
+    if (!_stateMachine.isInState(HueState::WAITING_FOR_BUTTON)) {
+        return;
     }
 
     // Parse response
@@ -210,12 +369,12 @@ bool HueService::sendAuthRequest() {
 
     if (error) {
         logf("JSON parse error: %s", error.c_str());
-        return false;
+        return;
     }
 
     JsonArray arr = doc.as<JsonArray>();
     if (arr.size() == 0) {
-        return false;
+        return;
     }
 
     JsonObject obj = arr[0];
@@ -225,16 +384,17 @@ bool HueService::sendAuthRequest() {
         int errorType = obj["error"]["type"];
         if (errorType == 101) {
             // Link button not pressed - this is expected, keep waiting
-            return false;
+            return;
         }
         logf("Auth error: %s", obj["error"]["description"].as<const char*>());
-        return false;
+        return;
     }
 
     // Check for success
     if (obj["success"]["username"]) {
         String username = obj["success"]["username"].as<String>();
         strncpy(_username, username.c_str(), sizeof(_username) - 1);
+        updateBaseUrl();
         logf("Authentication successful! Username: %s", _username);
 
         saveCredentials();
@@ -242,113 +402,252 @@ bool HueService::sendAuthRequest() {
 
         // Fetch rooms
         fetchRooms();
-        return true;
     }
-
-    return false;
 }
 
-bool HueService::fetchRooms() {
+bool HueService::fetchRooms(NetPriority priority, bool probe) {
     if (_bridgeIP[0] == '\0' || _username[0] == '\0') {
         return false;
     }
 
-    String url = buildUrl("/groups");
-    String response;
-
-    if (!httpGet(url, response)) {
-        return false;
+    // One fetch at a time. A command queued before a waiting fetch runs
+    // first (user priority), so that fetch already sees it; one completing
+    // while a fetch is in flight gets a full fetch after it.
+    if (_fetchPending) {
+        _refetchQueued |= !probe;
+        return true;
     }
 
-    return parseRoomsResponse(response);
+    char url[URL_SIZE];
+    formatUrl(url, GROUPS_URL);
+    const uint32_t fetch = _pending.beginFetch();
+
+    // The lane parses (or only hashes) the body straight off the
+    // connection into the staging fields; one fetch at a time, so the
+    // completion reads them back before the next fetch can write them
+    _fetchPending = submit(NetMethod::GET, url, nullptr, priority,
+        [this, probe, fetch](const NetResponse& response) {
+            onFetchComplete(response, probe, fetch);
+        },
+        [this, probe](Stream& body) {
+            HashingStream hashed(body);
+            const bool parsed = probe || parseRooms(hashed, _fetchedRooms, _fetchedCount);
+            _fetchedHash = hashed.finish();
+            return parsed;
+        });
+    return _fetchPending;
 }
 
-bool HueService::parseRoomsResponse(const String& response) {
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, response);
-
-    if (error) {
-        logf("JSON parse error: %s", error.c_str());
-        return false;
+void HueService::onFetchComplete(const NetResponse& response, bool probe, uint32_t fetch) {
+    _fetchPending = false;
+    const bool refetch = _refetchQueued;
+    _refetchQueued = false;
+
+    if (response.code == HTTP_CODE_OK && isConnected()) {
+        if (!response.parsed) {
+            log("Invalid /groups response");
+        } else if (!probe) {
+            _pollStats.parses++;
+            _roomsHash = _fetchedHash;
+
+            // Commands completed before this fetch went out are in it now
+            _pending.reconcile(fetch, [this](uint32_t key, const RoomMutation& mutation) {
+                for (uint8_t i = 0; i < _fetchedCount; i++) {
+                    const HueRoomData& room = _fetchedRooms[i];
+                    if (roomKey(room.id) == key) {
+                        return room.anyOn == mutation.on &&
+                               (!mutation.setsBrightness || room.brightness == mutation.brightness);
+                    }
+                }
+                return false;
+            });
+            applyRooms(_fetchedRooms, _fetchedCount);
+        } else if (!refetch) {
+            if (_fetchedHash == _roomsHash) {
+                // Nothing changed: skip the parse and back off
+                _pollStats.unchanged++;
+                _pollIntervalMs = _pollIntervalMs * 2 < config::hue::POLL_INTERVAL_MAX_MS
+                                ? _pollIntervalMs * 2 : config::hue::POLL_INTERVAL_MAX_MS;
+            } else {
+                // Changed elsewhere (app, switch, schedule): fetch it again to parse
+                _pollIntervalMs = config::hue::POLL_INTERVAL_MS;
+                fetchRooms();
+            }
+        }
     }
 
-    HueRoomData newRooms[HUE_MAX_ROOMS];
-    uint8_t newCount = 0;
+    if (refetch && isConnected()) {
+        fetchRooms(NetPriority::USER);
+    }
+}
 
-    JsonObject root = doc.as<JsonObject>();
-    for (JsonPair kv : root) {
-        if (newCount >= HUE_MAX_ROOMS) break;
+void HueService::applyEvents() {
+    bool changed = false;
 
-        JsonObject group = kv.value();
+    HueEventStream::Delta delta;
+    while (_events.pop(delta)) {
+        HueRoomData* room = nullptr;
+        for (uint8_t i = 0; i < _bridgeCount; i++) {
+            if (strcmp(_bridgeRooms[i].id, delta.roomId) == 0) {
+                room = &_bridgeRooms[i];
+                break;
+            }
+        }
+        if (!room) {
+            continue;   // Group we do not show (entertainment area, "all lights")
+        }
 
-        // Only include Room and Zone types
-        String type = group["type"].as<String>();
-        if (type != "Room" && type != "Zone") {
-            continue;
+        if ((delta.fields & HueEventStream::ON) && room->anyOn != delta.on) {
+            room->anyOn = delta.on;
+            if (!delta.on) {
+                room->allOn = false;
+            }
+            changed = true;
+        }
+        if ((delta.fields & HueEventStream::BRIGHTNESS) && room->brightness != delta.brightness) {
+            room->brightness = delta.brightness;
+            changed = true;
         }
+    }
 
-        HueRoomData& room = newRooms[newCount];
+    if (changed) {
+        // _bridgeRooms no longer match the last /groups body
+        _roomsHash = 0;
+        publishRooms();
+    }
+
+    if (_events.takeResync()) {
+        fetchRooms();
+    }
+}
 
-        // Copy ID
-        strncpy(room.id, kv.key().c_str(), sizeof(room.id) - 1);
+void HueService::pollSoon() {
+    // A local command often settles over the next seconds (transitions,
+    // other apps reacting): look again soon, then back off from there
+    if (_incrementalPoll) {
+        _pollIntervalMs = config::hue::POLL_INTERVAL_FAST_MS;
+        _lastPollTime = millis();
+    }
+}
 
-        // Copy name
-        String name = group["name"].as<String>();
-        strncpy(room.name, name.c_str(), sizeof(room.name) - 1);
+void HueService::setEventStream(bool enabled) {
+    _eventStream = enabled;
+    if (!enabled) {
+        _events.stop();
+    }
+}
 
-        // Copy class
-        String className = group["class"].as<String>();
-        strncpy(room.className, className.c_str(), sizeof(room.className) - 1);
+void HueService::setBrightnessCoalescing(bool enabled) {
+    _coalesce = enabled;
+}
 
-        // Get state
-        JsonObject state = group["state"];
-        room.anyOn = state["any_on"] | false;
-        room.allOn = state["all_on"] | false;
+void HueService::setIncrementalPolling(bool enabled) {
+    _incrementalPoll = enabled;
+    _pollIntervalMs = config::hue::POLL_INTERVAL_MS;
+}
 
-        // Get action (current brightness)
-        JsonObject action = group["action"];
-        room.brightness = action["bri"] | 0;
+bool HueService::parseRooms(Stream& body, HueRoomData* rooms, uint8_t& count) {
+    count = 0;
 
-        // Count lights
-        JsonArray lights = group["lights"];
-        room.lightCount = lights.size();
+    // The body is one object keyed by group ID: walk its keys by hand and
+    // let ArduinoJson parse each group on its own
+    if (nextToken(body) != '{') {
+        return false;   // e.g. [{"error":...}] for an unknown username
+    }
 
-        newCount++;
+    JsonDocument group;
+    int c = nextToken(body);
+    if (c == '}') {
+        return true;
     }
 
-    logf("Fetched %d rooms", newCount);
+    while (c == '"') {
+        char id[sizeof(HueRoomData::id)];
+        if (!readKey(body, id, sizeof(id)) || nextToken(body) != ':') {
+            return false;
+        }
+        if (deserializeJson(group, body, DeserializationOption::Filter(groupFilter()))) {
+            return false;
+        }
 
-    // Only update and notify if data actually changed
-    if (roomsChanged(newRooms, newCount)) {
-        log("Room data changed, notifying");
-        memcpy(_rooms, newRooms, sizeof(newRooms));
-        _roomCount = newCount;
+        // Only include Room and Zone types
+        const char* type = group["type"] | "";
+        if (count < HUE_MAX_ROOMS && (strcmp(type, "Room") == 0 || strcmp(type, "Zone") == 0)) {
+            HueRoomData& room = rooms[count++];
+            memset(&room, 0, sizeof(room));
+
+            memcpy(room.id, id, sizeof(room.id));
+            strncpy(room.name, group["name"] | "", sizeof(room.name) - 1);
+            strncpy(room.className, group["class"] | "", sizeof(room.className) - 1);
+
+            room.anyOn = group["state"]["any_on"] | false;
+            room.allOn = group["state"]["all_on"] | false;
+            room.brightness = group["action"]["bri"] | 0;
+            room.lightCount = group["lights"].as<JsonArray>().size();
+        }
 
-        if (_roomsCallback) {
-            _roomsCallback();
+        c = nextToken(body);
+        if (c == '}') {
+            return true;
+        }
+        if (c != ',') {
+            return false;
         }
+        c = nextToken(body);
     }
 
-    return true;
+    return false;
 }
 
-bool HueService::roomsChanged(const HueRoomData* newRooms, uint8_t newCount) {
-    if (_roomCount != newCount) {
-        return true;
-    }
+void HueService::applyRooms(const HueRoomData* newRooms, uint8_t newCount) {
+    logf("Fetched %d rooms", newCount);
 
-    for (uint8_t i = 0; i < _roomCount; i++) {
-        const HueRoomData& oldRoom = _rooms[i];
-        const HueRoomData& newRoom = newRooms[i];
+    memcpy(_bridgeRooms, newRooms, sizeof(_bridgeRooms));
+    _bridgeCount = newCount;
+    publishRooms();
+}
+
+void HueService::publishRooms() {
+    // Only notify if what is shown actually changed
+    bool changed = (_roomCount != _bridgeCount);
 
-        if (strcmp(oldRoom.id, newRoom.id) != 0) return true;
-        if (strcmp(oldRoom.name, newRoom.name) != 0) return true;
-        if (oldRoom.anyOn != newRoom.anyOn) return true;
-        if (oldRoom.allOn != newRoom.allOn) return true;
-        if (oldRoom.brightness != newRoom.brightness) return true;
+    for (uint8_t i = 0; i < _bridgeCount; i++) {
+        HueRoomData room = _bridgeRooms[i];
+
+        const RoomMutation* pending = _pending.get(roomKey(room.id));
+        if (pending) {
+            // A group action switches every light in the group
+            room.anyOn = pending->on;
+            room.allOn = pending->on;
+            if (pending->setsBrightness) {
+                room.brightness = pending->brightness;
+            }
+        }
+
+        changed |= roomDiffers(_rooms[i], room);
+        _rooms[i] = room;
     }
+    _roomCount = _bridgeCount;
 
-    return false;
+    if (changed) {
+        log("Room data changed, notifying");
+        if (_roomsCallback) {
+            _roomsCallback();
+        }
+    }
+}
+
+bool HueService::roomDiffers(const HueRoomData& a, const HueRoomData& b) {
+    return strcmp(a.id, b.id) != 0 ||
+           strcmp(a.name, b.name) != 0 ||
+           a.anyOn != b.anyOn ||
+           a.allOn != b.allOn ||
+           a.brightness != b.brightness;
+}
+
+uint32_t HueService::roomKey(const char* roomId) {
+    // v1 group IDs are decimal
+    return strtoul(roomId, nullptr, 10);
 }
 
 const HueRoomData& HueService::getRoom(uint8_t index) const {
@@ -367,6 +666,7 @@ const HueRoomData* HueService::findRoom(const char* roomId) const {
     return nullptr;
 }
 
+
 bool HueService::toggleRoom(const char* roomId) {
     const HueRoomData* room = findRoom(roomId);
     if (!room) return false;
@@ -375,41 +675,89 @@ bool HueService::toggleRoom(const char* roomId) {
 }
 
 bool HueService::setRoomState(const char* roomId, bool on) {
-    String url = buildUrl("/groups/" + String(roomId) + "/action");
-    String body = on ? "{\"on\":true}" : "{\"on\":false}";
-    String response;
+    if (!findRoom(roomId)) return false;
+
+    // Latest command wins: a sweep still being sent would turn the room back on
+    BrightnessTarget* target = findTarget(roomId);
+    if (target) {
+        releaseTarget(*target);
+    }
+    _lastGroupCommandAt = millis();
+
+    char url[URL_SIZE];
+    formatUrl(url, GROUP_ACTION_URL, roomId);
+    const char* body = on ? STATE_ON_BODY : STATE_OFF_BODY;
 
     logf("Setting room %s to %s", roomId, on ? "ON" : "OFF");
 
-    if (!httpPut(url, body, response)) {
+    const uint32_t key = roomKey(roomId);
+    const uint32_t token = _pending.set(key, RoomMutation{on, false, 0}, millis());
+    if (!submit(NetMethod::PUT, url, body, NetPriority::USER,
+            [this, key, token](const NetResponse& response) {
+                onCommandComplete(key, token, response);
+            })) {
+        _pending.remove(key);
         return false;
     }
 
-    // Refresh rooms after state change
-    fetchRooms();
+    // Show it before the bridge has it
+    publishRooms();
     return true;
 }
 
 bool HueService::setRoomBrightness(const char* roomId, uint8_t brightness) {
-    String url = buildUrl("/groups/" + String(roomId) + "/action");
+    if (!findRoom(roomId)) return false;
+    _commandStats.requested++;
+
+    const uint32_t key = roomKey(roomId);
+    const uint32_t token = _pending.set(key, RoomMutation{true, true, brightness}, millis());
+
+    if (!_coalesce) {
+        if (!putBrightness(roomId, brightness,
+                [this, key, token](const NetResponse& response) {
+                    onCommandComplete(key, token, response);
+                })) {
+            _pending.remove(key);
+            return false;
+        }
+        _commandStats.sent++;
+        publishRooms();
+        return true;
+    }
 
-    JsonDocument doc;
-    doc["on"] = true;
-    doc["bri"] = brightness;
+    BrightnessTarget* target = claimTarget(roomId);
+    if (!target) {
+        _pending.remove(key);
+        return false;
+    }
 
-    String body;
-    serializeJson(doc, body);
-    String response;
+    target->value = brightness;
+    target->token = token;
+    target->dirty = true;
+    target->changedAt = millis();
 
-    logf("Setting room %s brightness to %d", roomId, brightness);
+    // Show the target now; the bridge catches up at its own rate
+    publishRooms();
+    sendBrightness();
+    return true;
+}
 
-    if (!httpPut(url, body, response)) {
-        return false;
+void HueService::onCommandComplete(uint32_t key, uint32_t token, const NetResponse& response) {
+    const bool ok = commandSucceeded(response);
+    if (!ok) {
+        _commandStats.failed++;
     }
 
-    // Refresh rooms after state change
-    fetchRooms();
-    return true;
+    if (_pending.ack(key, token, ok, millis())) {
+        logf("Command for room %lu failed (%d), rolled back", static_cast<unsigned long>(key), response.code);
+        publishRooms();
+    }
+
+    // Refresh rooms after state change; the fetch confirms the command
+    if (ok) {
+        fetchRooms(NetPriority::USER);
+        pollSoon();
+    }
 }
 
 bool HueService::adjustRoomBrightness(const char* roomId, int16_t delta) {
@@ -424,13 +772,171 @@ bool HueService::adjustRoomBrightness(const char* roomId, int16_t delta) {
     return setRoomBrightness(roomId, static_cast<uint8_t>(newBri));
 }
 
+// =============================================================================
+// Brightness Coalescing
+// =============================================================================
+
+void HueService::sendBrightness() {
+    const uint32_t now = millis();
+
+    // A single PUT that settled needs no confirmation
+    for (BrightnessTarget& target : _targets) {
+        if (target.roomId[0] != '\0' && !target.dirty && !target.inFlight && target.sends == 1 &&
+            now - target.changedAt >= config::hue::SWEEP_SETTLE_MS) {
+            finishSweep(target);
+        }
+    }
+
+    if (now - _lastGroupCommandAt < config::hue::GROUP_COMMAND_INTERVAL_MS) {
+        return;
+    }
+
+    // A new value goes before a confirmation; among those, the room
+    // that has waited longest
+    BrightnessTarget* next = nullptr;
+    bool confirm = false;
+    for (BrightnessTarget& target : _targets) {
+        if (target.roomId[0] == '\0' || target.inFlight) {
+            continue;
+        }
+        const bool settled = target.sends > 1 && now - target.changedAt >= config::hue::SWEEP_SETTLE_MS;
+        if (!target.dirty && !settled) {
+            continue;
+        }
+        if (!next || (target.dirty && !next->dirty) ||
+            (target.dirty == next->dirty && now - target.changedAt > now - next->changedAt)) {
+            next = &target;
+            confirm = !target.dirty;
+        }
+    }
+    if (!next) {
+        return;
+    }
+
+    const uint8_t slot = static_cast<uint8_t>(next - _targets);
+    const uint16_t sweep = next->sweep;
+    if (!putBrightness(next->roomId, next->value,
+            [this, slot, sweep, confirm](const NetResponse& response) {
+                onBrightnessComplete(slot, sweep, confirm, response);
+            })) {
+        return;     // Lane queue full: try again next update
+    }
+
+    _lastGroupCommandAt = now;
+    _commandStats.sent++;
+    if (confirm) {
+        _commandStats.confirmations++;
+    }
+    next->dirty = false;
+    next->inFlight = true;
+    next->sends++;
+}
+
+void HueService::onBrightnessComplete(uint8_t slot, uint16_t sweep, bool confirm, const NetResponse& response) {
+    BrightnessTarget& target = _targets[slot];
+    if (target.sweep != sweep) {
+        return;     // Cancelled by a toggle or reset
+    }
+    target.inFlight = false;
+
+    if (!commandSucceeded(response)) {
+        _commandStats.failed++;
+        if (++target.failures > config::hue::COMMAND_RETRIES) {
+            // Give up: back to the bridge state, then fetch it, as
+            // earlier steps of the sweep may have been applied
+            logf("Brightness for room %s failed (%d), rolled back", target.roomId, response.code);
+            if (_pending.ack(roomKey(target.roomId), target.token, false, millis())) {
+                publishRooms();
+            }
+            releaseTarget(target);
+            fetchRooms(NetPriority::USER);
+            return;
+        }
+        target.dirty = true;    // Resend the latest value
+        return;
+    }
+    target.failures = 0;
+
+    // Until the sweep settles, later values join it; sendBrightness() ends it
+    if (!confirm || target.dirty) {
+        return;
+    }
+    finishSweep(target);
+}
+
+void HueService::finishSweep(BrightnessTarget& target) {
+    // The bridge has the latest value: the fetch confirms it
+    _pending.ack(roomKey(target.roomId), target.token, true, millis());
+    releaseTarget(target);
+    fetchRooms(NetPriority::USER);
+    pollSoon();
+}
+
+HueService::BrightnessTarget* HueService::findTarget(const char* roomId) {
+    for (BrightnessTarget& target : _targets) {
+        if (target.roomId[0] != '\0' && strcmp(target.roomId, roomId) == 0) {
+            return &target;
+        }
+    }
+    return nullptr;
+}
+
+HueService::BrightnessTarget* HueService::claimTarget(const char* roomId) {
+    BrightnessTarget* target = findTarget(roomId);
+    if (target) {
+        return target;
+    }
+
+    // As many slots as rooms, so a known room always finds one
+    for (BrightnessTarget& free : _targets) {
+        if (free.roomId[0] == '\0') {
+            strncpy(free.roomId, roomId, sizeof(free.roomId) - 1);
+            free.roomId[sizeof(free.roomId) - 1] = '\0';
+            free.sends = 0;
+            free.failures = 0;
+            free.dirty = false;
+            free.inFlight = false;
+            return &free;
+        }
+    }
+    return nullptr;
+}
+
+void HueService::releaseTarget(BrightnessTarget& target) {
+    target.roomId[0] = '\0';
+    target.sweep++;
+}
+
+bool HueService::putBrightness(const char* roomId, uint8_t brightness, NetworkWorker::Callback callback) {
+    char url[URL_SIZE];
+    formatUrl(url, GROUP_ACTION_URL, roomId);
+
+    char body[32];
+    snprintf(body, sizeof(body), BRIGHTNESS_BODY, brightness);
+
+    logf("Setting room %s brightness to %d", roomId, brightness);
+
+    return submit(NetMethod::PUT, url, body, NetPriority::USER, std::move(callback));
+}
+
 void HueService::reset() {
     log("Resetting Hue service...");
     clearCredentials();
     memset(_bridgeIP, 0, sizeof(_bridgeIP));
     memset(_username, 0, sizeof(_username));
+    memset(_baseUrl, 0, sizeof(_baseUrl));
     memset(_rooms, 0, sizeof(_rooms));
     _roomCount = 0;
+    memset(_bridgeRooms, 0, sizeof(_bridgeRooms));
+    _bridgeCount = 0;
+    _pending.clear();
+    _roomsHash = 0;
+    _events.stop();
+    for (BrightnessTarget& target : _targets) {
+        if (target.roomId[0] != '\0') {
+            releaseTarget(target);
+        }
+    }
 
     startDiscovery();
 }
@@ -455,6 +961,7 @@ bool HueService::loadCredentials() {
 
     strncpy(_bridgeIP, ip.c_str(), sizeof(_bridgeIP) - 1);
     strncpy(_username, user.c_str(), sizeof(_username) - 1);
+    updateBaseUrl();
 
     return true;
 }
@@ -486,61 +993,38 @@ void HueService::clearCredentials() {
     log("Credentials cleared from NVS");
 }
 
-String HueService::buildUrl(const String& path) {
-    return "http://" + String(_bridgeIP) + "/api/" + String(_username) + path;
-}
-
-bool HueService::httpGet(const String& url, String& response) {
-    _http.begin(url);
-    _http.setTimeout(config::hue::REQUEST_TIMEOUT_MS);
-
-    int httpCode = _http.GET();
-
-    if (httpCode == HTTP_CODE_OK) {
-        response = _http.getString();
-        _http.end();
-        return true;
+void HueService::updateBaseUrl() {
+    if (_bridgeIP[0] == '\0' || _username[0] == '\0') {
+        _baseUrl[0] = '\0';
+        return;
     }
-
-    logf("HTTP GET failed: %d", httpCode);
-    _http.end();
-    return false;
+    snprintf(_baseUrl, sizeof(_baseUrl), "http://%s/api/%s", _bridgeIP, _username);
 }
 
-bool HueService::httpPut(const String& url, const String& body, String& response) {
-    _http.begin(url);
-    _http.setTimeout(config::hue::REQUEST_TIMEOUT_MS);
-    _http.addHeader("Content-Type", "application/json");
-
-    int httpCode = _http.sendRequest("PUT", body);
-
-    if (httpCode == HTTP_CODE_OK) {
-        response = _http.getString();
-        _http.end();
-        return true;
-    }
-
-    logf("HTTP PUT failed: %d", httpCode);
-    _http.end();
-    return false;
+void HueService::formatUrl(char* out, const char* pathTemplate, const char* id) {
+    snprintf(out, URL_SIZE, pathTemplate, _baseUrl, id);
 }
 
-bool HueService::httpPost(const String& url, const String& body, String& response) {
-    _http.begin(url);
-    _http.setTimeout(config::hue::REQUEST_TIMEOUT_MS);
-    _http.addHeader("Content-Type", "application/json");
-
-    int httpCode = _http.POST(body);
-
-    if (httpCode == HTTP_CODE_OK) {
-        response = _http.getString();
-        _http.end();
-        return true;
+bool HueService::submit(NetMethod method, const char* url, const char* body,
+                        NetPriority priority, NetworkWorker::Callback callback,
+                        BodyReader reader) {
+    NetRequest request;
+    request.method = method;
+    request.url = url;
+    request.reader = std::move(reader);
+    if (body) {
+        request.body = body;
+        request.contentType = "application/json";
     }
+    request.timeoutMs = config::hue::REQUEST_TIMEOUT_MS;
 
-    logf("HTTP POST failed: %d", httpCode);
-    _http.end();
-    return false;
+    return _network.submit(NetLane::HUE, priority, std::move(request),
+        [this, callback](const NetResponse& response) {
+            if (response.code != HTTP_CODE_OK) {
+                logf("HTTP request failed: %d", response.code);
+            }
+            callback(response);
+        });
 }
 
 void HueService::onStateTransition(HueState oldState, HueState newState, const char* message) {
@@ -3,13 +3,16 @@
  * @brief PaperHome v3.1 - Dual-Core E-Paper Smart Home Controller
  *
  * Architecture:
- * - Core 0 (I/O): Xbox controller, WiFi, MQTT, HTTP, BLE, I2C sensors
+ * - Core 0 (I/O): Xbox controller, WiFi, MQTT, BLE, I2C sensors
+ * - Core 0 (network lanes): Hue and Tado HTTP(S), one task per host
+ * - Core 0 (Hue events): bridge v2 event stream, read by its own task
  * - Core 1 (UI): Display rendering, navigation, screen management
- * - InputQueue: FreeRTOS queue for Core 0 → Core 1 communication
+ * - InputQueue: lock-free SPSC ring for Core 0 → Core 1 communication
  *
  * Rendering:
  * - Full refresh on screen change (~2s, guaranteed clean)
  * - Partial refresh for selection changes (~200-500ms)
+ * - Ghosting clean-up of worn regions only, once input is idle
  * - 50ms input batching for smooth D-pad navigation
  */
 
@@ -21,6 +24,7 @@
 #include "core/config.h"
 #include "core/input_queue.h"
 #include "core/service_queue.h"
+#include "core/deadline_scheduler.h"
 #include "display/display_driver.h"
 #include "display/compositor.h"
 #include "navigation/navigation_controller.h"
@@ -37,6 +41,7 @@
 #include "tado/tado_auto_adjust.h"
 #include "sensors/sensor_manager.h"
 #include "connectivity/mqtt_client.h"
+#include "connectivity/network_worker.h"
 
 // Screens
 #include "ui/screens/hue_dashboard.h"
@@ -63,6 +68,7 @@ HueCommandQueue hueCommandQueue;
 TadoCommandQueue tadoCommandQueue;
 
 // Core 0 (I/O) objects
+NetworkWorker networkWorker;
 XboxDriver* xboxDriver = nullptr;
 InputHandler* inputHandler = nullptr;
 HueService* hueService = nullptr;
@@ -95,6 +101,7 @@ Screen* currentScreen = nullptr;
 
 // Rendering state
 bool needsFullRefresh = true;
+bool statusBarChanged = false;   // Redraw the status bar over the current frame
 uint32_t lastRenderTime = 0;
 uint32_t frameCount = 0;
 
@@ -144,23 +151,30 @@ void switchToScreen(ScreenId id) {
 void renderCurrentScreen() {
     if (!currentScreen || !compositor) return;
 
-    // Only render if screen is dirty
-    if (!currentScreen->isDirty()) return;
+    // Only render if screen (or the status bar above it) is dirty
+    bool statusDirty = statusBarChanged && currentScreen->hasStatusBar();
+    statusBarChanged = false;
+    if (!currentScreen->isDirty() && !statusDirty) return;
 
     uint32_t startTime = millis();
 
-    // Get selection rects BEFORE rendering (for refresh region calculation)
-    Rect prevSelection = currentScreen->getPreviousSelectionRect();
-    Rect currSelection = currentScreen->getSelectionRect();
+    // Begin frame - resets dirty tracking. Screens that redraw everything
+    // are recorded, so only commands that changed get rasterized
+    compositor->beginFrame(currentScreen->isRetained() ? Compositor::FrameMode::IMMEDIATE
+                                                       : Compositor::FrameMode::RECORDED);
 
-    // Begin frame - resets dirty tracking
-    compositor->beginFrame();
-
-    // Render full screen content (screens handle their own selection highlighting)
-    compositor->fillScreen(true);  // White background
+    // Retained screens repaint only invalidated widgets over the previous
+    // frame; everything else (and any full refresh) starts from white
+    if (needsFullRefresh || !currentScreen->isRetained()) {
+        compositor->fillScreen(true);  // White background
+        currentScreen->invalidateAll();
+    }
 
-    // Render status bar at top (32px)
-    statusBar.render(*compositor);
+    // Render status bar at top (32px); it clears its own area, so it can
+    // be repainted over a retained frame
+    if (currentScreen->hasStatusBar()) {
+        statusBar.render(*compositor);
+    }
 
     // Render current screen content (below status bar)
     currentScreen->render(*compositor);
@@ -173,19 +187,14 @@ void renderCurrentScreen() {
         needsFullRefresh = false;
         Serial.printf("[Render] Full refresh\n");
     } else {
-        // Partial refresh - use UNION of old and new selection for clean transitions
-        Rect refreshRegion = prevSelection.unionWith(currSelection);
-
-        if (!refreshRegion.isEmpty()) {
-            // Expand slightly for clean edges (GxEPD2 alignment)
-            refreshRegion.x = (refreshRegion.x / 8) * 8;
-            refreshRegion.width = ((refreshRegion.width + 15) / 8) * 8;
-
-            displayDriver.partialRefresh(refreshRegion);
-            refreshed = true;
-            Serial.printf("[Render] Partial: %dx%d @ (%d,%d)\n",
-                          refreshRegion.width, refreshRegion.height,
-                          refreshRegion.x, refreshRegion.y);
+        // Partial refresh of whatever actually changed since the last frame;
+        // ghosting is cleaned up later, while idle (see RefreshScheduler)
+        refreshed = compositor->endFrame();
+        if (refreshed) {
+            Rect bounds = compositor->getLastRefreshBounds();
+            Serial.printf("[Render] Partial: %u window(s), %lu px within %dx%d @ (%d,%d)\n",
+                          compositor->getLastFrameWindows(), compositor->getLastFramePixels(),
+                          bounds.width, bounds.height, bounds.x, bounds.y);
         }
     }
 
@@ -205,28 +214,25 @@ void renderCurrentScreen() {
 // =============================================================================
 
 /**
- * @brief Convert HueService rooms to UI HueRoom format
+ * @brief Convert HueService rooms into a UI room table
  *
  * HueService uses char arrays and 0-254 brightness (HueRoomData).
- * UI uses std::string and 0-100 brightness (HueRoom).
+ * UI uses std::string and 0-100 brightness (HueRoom). Fields are assigned
+ * in place, so strings reuse the table's existing capacity.
  */
-std::vector<HueRoom> convertHueRooms(const HueRoomData* serviceRooms, uint8_t count) {
-    std::vector<HueRoom> uiRooms;
-    uiRooms.reserve(count);
+void convertHueRooms(const HueRoomData* serviceRooms, uint8_t count, HueRoomTable& table) {
+    table.count = std::min<uint8_t>(count, HueRoomTable::MAX_ROOMS);
 
-    for (uint8_t i = 0; i < count; i++) {
+    for (uint8_t i = 0; i < table.count; i++) {
         const auto& src = serviceRooms[i];
-        HueRoom room;
+        HueRoom& room = table.rooms[i];
         room.id = src.id;
         room.name = src.name;
         room.isOn = src.anyOn;
         room.brightness = src.getBrightnessPercent();  // Convert 0-254 to 0-100
         room.lightCount = src.lightCount;
         room.reachable = true;  // Service rooms are always reachable
-        uiRooms.push_back(room);
     }
-
-    return uiRooms;
 }
 
 /**
@@ -235,8 +241,9 @@ std::vector<HueRoom> convertHueRooms(const HueRoomData* serviceRooms, uint8_t co
 void sendHueRoomsToUI() {
     if (!hueService || !hueService->isConnected()) return;
 
-    auto uiRooms = convertHueRooms(hueService->getRooms(), hueService->getRoomCount());
-    serviceQueue.sendHueRooms(uiRooms);
+    HueRoomTable& table = serviceQueue.beginHueRooms();
+    convertHueRooms(hueService->getRooms(), hueService->getRoomCount(), table);
+    serviceQueue.commitHueRooms();
 
     // Also publish to MQTT for web app
     if (mqttClient && mqttClient->isConnected()) {
@@ -258,23 +265,29 @@ void sendHueRoomsToUI() {
         }
     }
 
-    Serial.printf("[Hue] Sent %d rooms to UI\n", uiRooms.size());
+    Serial.printf("[Hue] Sent %d rooms to UI\n", table.count);
 }
 
 /**
- * @brief Convert TadoService zones to UI TadoZone format
+ * @brief Convert TadoService zones into a UI zone table
  *
  * TadoService uses int32_t zoneId and char arrays (TadoZoneData).
- * UI uses std::string and additional fields (TadoZone).
+ * UI uses std::string and additional fields (TadoZone). Fields are
+ * assigned in place, so strings reuse the table's existing capacity.
+ * The table holds an older snapshot than the last one sent, so every
+ * zone is written, not only those in the service's change masks; the
+ * UI redraws only the zones that look different from what it shows
+ * (TadoZone::changesFrom, same rules as the masks).
  */
-std::vector<TadoZone> convertTadoZones(const TadoZoneData* serviceZones, uint8_t count) {
-    std::vector<TadoZone> uiZones;
-    uiZones.reserve(count);
+void convertTadoZones(const TadoZoneData* serviceZones, uint8_t count, TadoZoneTable& table) {
+    table.count = std::min<uint8_t>(count, TadoZoneTable::MAX_ZONES);
 
-    for (uint8_t i = 0; i < count; i++) {
+    for (uint8_t i = 0; i < table.count; i++) {
         const auto& src = serviceZones[i];
-        TadoZone zone;
-        zone.id = std::to_string(src.id);
+        TadoZone& zone = table.zones[i];
+        char id[12];
+        snprintf(id, sizeof(id), "%ld", static_cast<long>(src.id));
+        zone.id = id;
         zone.name = src.name;
         zone.currentTemp = src.currentTemp;
         zone.targetTemp = src.targetTemp;
@@ -283,10 +296,7 @@ std::vector<TadoZone> convertTadoZones(const TadoZoneData* serviceZones, uint8_t
         zone.heatingPower = src.heatingPower;
         zone.isAway = false;  // TODO: Get from Tado API
         zone.connected = true;
-        uiZones.push_back(zone);
     }
-
-    return uiZones;
 }
 
 /**
@@ -295,8 +305,9 @@ std::vector<TadoZone> convertTadoZones(const TadoZoneData* serviceZones, uint8_t
 void sendTadoZonesToUI() {
     if (!tadoService || !tadoService->isConnected()) return;
 
-    auto uiZones = convertTadoZones(tadoService->getZones(), tadoService->getZoneCount());
-    serviceQueue.sendTadoZones(uiZones);
+    TadoZoneTable& table = serviceQueue.beginTadoZones();
+    convertTadoZones(tadoService->getZones(), tadoService->getZoneCount(), table);
+    serviceQueue.commitTadoZones();
 
     // Also publish to MQTT for web app
     if (mqttClient && mqttClient->isConnected()) {
@@ -321,7 +332,13 @@ void sendTadoZonesToUI() {
         }
     }
 
-    Serial.printf("[Tado] Sent %d zones to UI\n", uiZones.size());
+    if (debug::TADO_DBG) {
+        uint8_t changed = 0;
+        for (uint8_t i = 0; i < table.count; i++) {
+            changed += tadoService->getZoneChanges(i) ? 1 : 0;
+        }
+        Serial.printf("[Tado] Sent %d zones to UI (%d changed)\n", table.count, changed);
+    }
 }
 
 /**
@@ -444,15 +461,15 @@ void sendTestDataViaQueue() {
     serviceQueue.sendStatus(statusData);
 
     // Hue rooms
-    std::vector<HueRoom> rooms = {
-        {"r1", "Living Room", true, 80, 4, true},
-        {"r2", "Bedroom", false, 0, 2, true},
-        {"r3", "Kitchen", true, 100, 3, true},
-        {"r4", "Bathroom", false, 0, 1, true},
-        {"r5", "Office", true, 60, 2, true},
-        {"r6", "Hallway", true, 40, 2, true},
-    };
-    serviceQueue.sendHueRooms(rooms);
+    HueRoomTable& rooms = serviceQueue.beginHueRooms();
+    rooms.rooms[0] = {"r1", "Living Room", true, 80, 4, true};
+    rooms.rooms[1] = {"r2", "Bedroom", false, 0, 2, true};
+    rooms.rooms[2] = {"r3", "Kitchen", true, 100, 3, true};
+    rooms.rooms[3] = {"r4", "Bathroom", false, 0, 1, true};
+    rooms.rooms[4] = {"r5", "Office", true, 60, 2, true};
+    rooms.rooms[5] = {"r6", "Hallway", true, 40, 2, true};
+    rooms.count = 6;
+    serviceQueue.commitHueRooms();
 
     // Sensor data
     SensorData sensorData;
@@ -468,16 +485,263 @@ void sendTestDataViaQueue() {
     serviceQueue.sendSensorData(sensorData);
 
     // Tado zones
-    std::vector<TadoZone> zones = {
-        {"z1", "Living Room", 22.5f, 21.0f, 48.0f, true, 80, false, true},
-        {"z2", "Bedroom", 20.0f, 19.0f, 52.0f, false, 0, false, true},
-        {"z3", "Office", 23.0f, 22.0f, 45.0f, true, 40, false, true},
-    };
-    serviceQueue.sendTadoZones(zones);
+    TadoZoneTable& zones = serviceQueue.beginTadoZones();
+    zones.zones[0] = {"z1", "Living Room", 22.5f, 21.0f, 48.0f, true, 80, false, true};
+    zones.zones[1] = {"z2", "Bedroom", 20.0f, 19.0f, 52.0f, false, 0, false, true};
+    zones.zones[2] = {"z3", "Office", 23.0f, 22.0f, 45.0f, true, 40, false, true};
+    zones.count = 3;
+    serviceQueue.commitTadoZones();
 
     Serial.println("[I/O Task] Test data sent via ServiceQueue");
 }
 
+// =============================================================================
+// I/O Jobs (Core 0) - run by ioScheduler at their own deadlines
+// =============================================================================
+
+DeadlineScheduler ioScheduler;
+
+void inputJob() {
+    // Update Xbox driver (handles BLE connection)
+    xboxDriver->update();
+
+    // Poll for input events
+    InputAction action = inputHandler->poll();
+
+    // Send non-empty actions to UI task via queue
+    if (!action.isNone()) {
+        if (!inputQueue.send(action)) {
+            Serial.println("[I/O Task] WARNING: Input queue full");
+        }
+    }
+}
+
+/**
+ * @brief Run completions of Hue/Tado requests (service state stays on this task)
+ */
+void networkJob() {
+    networkWorker.poll();
+}
+
+void hueJob() {
+    // Update Hue service (handles discovery, auth, polling)
+    if (WiFi.isConnected() && hueService) {
+        hueService->update();
+
+        // Process Hue commands from UI
+        HueCommand hueCmd;
+        while (hueCommandQueue.receive(hueCmd)) {
+            switch (hueCmd.type) {
+                case HueCommandType::TOGGLE_ROOM:
+                    Serial.printf("[Hue] CMD: Toggle room %s\n", hueCmd.roomId);
+                    hueService->toggleRoom(hueCmd.roomId);
+                    break;
+
+                case HueCommandType::SET_BRIGHTNESS:
+                    Serial.printf("[Hue] CMD: Set brightness %s = %d\n", hueCmd.roomId, hueCmd.value);
+                    // Convert from 0-100 to 0-254
+                    hueService->setRoomBrightness(hueCmd.roomId, (hueCmd.value * 254) / 100);
+                    break;
+
+                case HueCommandType::ADJUST_BRIGHTNESS:
+                    Serial.printf("[Hue] CMD: Adjust brightness %s %+d\n", hueCmd.roomId, hueCmd.value);
+                    // Convert from 0-100 scale to 0-254 scale
+                    hueService->adjustRoomBrightness(hueCmd.roomId, (hueCmd.value * 254) / 100);
+                    break;
+            }
+        }
+    }
+}
+
+void tadoJob() {
+    // Update Tado service (handles auth, token refresh, zone polling)
+    if (tadoService) {
+        // Process Tado commands from UI (always, even without WiFi for START_AUTH feedback)
+        TadoCommand tadoCmd;
+        while (tadoCommandQueue.receive(tadoCmd)) {
+            switch (tadoCmd.type) {
+                case TadoCommandType::START_AUTH:
+                    // Allow START_AUTH even without WiFi - service will show error
+                    Serial.println("[Tado] CMD: Start OAuth device flow");
+                    tadoService->startAuth();
+                    break;
+
+                case TadoCommandType::SET_TEMPERATURE:
+                    if (WiFi.isConnected()) {
+                        Serial.printf("[Tado] CMD: Set temp zone %ld = %.1f\n", tadoCmd.zoneId, tadoCmd.value);
+                        tadoService->setZoneTemperature(tadoCmd.zoneId, tadoCmd.value);
+                    }
+                    break;
+
+                case TadoCommandType::ADJUST_TEMPERATURE:
+                    if (WiFi.isConnected()) {
+                        Serial.printf("[Tado] CMD: Adjust temp zone %ld %+.1f\n", tadoCmd.zoneId, tadoCmd.value);
+                        tadoService->adjustZoneTemperature(tadoCmd.zoneId, tadoCmd.value);
+                    }
+                    break;
+
+                case TadoCommandType::RESUME_SCHEDULE:
+                    if (WiFi.isConnected()) {
+                        Serial.printf("[Tado] CMD: Resume schedule zone %ld\n", tadoCmd.zoneId);
+                        tadoService->resumeSchedule(tadoCmd.zoneId);
+                    }
+                    break;
+
+                case TadoCommandType::SET_AUTO_ADJUST:
+                    Serial.printf("[Tado] CMD: Set auto-adjust zone %ld, enabled=%s, target=%.1f\n",
+                                  tadoCmd.zoneId, tadoCmd.autoAdjustEnabled ? "yes" : "no", tadoCmd.value);
+                    if (tadoAutoAdjust) {
+                        const AutoAdjustConfig* existing = tadoAutoAdjust->getConfig(tadoCmd.zoneId);
+                        const char* zoneName = existing ? existing->zoneName : "Unknown";
+                        tadoAutoAdjust->setConfig(tadoCmd.zoneId, zoneName, tadoCmd.value,
+                                                   tadoCmd.autoAdjustEnabled, tadoCmd.hysteresis);
+                    }
+                    break;
+
+                case TadoCommandType::SYNC_MAPPING:
+                    Serial.printf("[Tado] CMD: Sync mapping zone %ld (%s), target=%.1f, auto=%s\n",
+                                  tadoCmd.zoneId, tadoCmd.zoneName, tadoCmd.value,
+                                  tadoCmd.autoAdjustEnabled ? "yes" : "no");
+                    if (tadoAutoAdjust) {
+                        tadoAutoAdjust->setConfig(tadoCmd.zoneId, tadoCmd.zoneName, tadoCmd.value,
+                                                   tadoCmd.autoAdjustEnabled, tadoCmd.hysteresis);
+                    }
+                    break;
+            }
+        }
+
+        // Update service (requires WiFi for API calls)
+        if (WiFi.isConnected()) {
+            tadoService->update();
+        }
+    }
+}
+
+void sensorJob() {
+    // Update sensor manager (samples at configured interval internally)
+    if (sensorManager) {
+        sensorManager->update();
+    }
+
+    // Update Tado auto-adjust control loop (runs internally at 5-minute intervals)
+    if (tadoAutoAdjust && sensorManager) {
+        float currentTemp = sensorManager->getTemperature();
+        tadoAutoAdjust->update(currentTemp);
+    }
+}
+
+void mqttJob() {
+    // Update MQTT client (handles connection and reconnection)
+    if (mqttClient && WiFi.isConnected()) {
+        mqttClient->update();
+    }
+}
+
+/**
+ * @brief Status bar, device info and sensor data for the UI; MQTT telemetry
+ */
+void statusJob() {
+    // Status bar data
+    StatusBarData statusData;
+    statusData.wifiConnected = WiFi.isConnected();
+    statusData.wifiRSSI = WiFi.isConnected() ? WiFi.RSSI() : 0;
+    statusData.mqttConnected = mqttClient && mqttClient->isConnected();
+    statusData.hueConnected = hueService && hueService->isConnected();
+    statusData.tadoConnected = tadoService && tadoService->isConnected();
+    statusData.temperature = sensorManager ? sensorManager->getTemperature() : 0.0f;
+    statusData.co2 = sensorManager ? sensorManager->getCO2() : 0;
+    statusData.batteryPercent = 100;   // TODO: Add power manager
+    statusData.usbPowered = true;      // TODO: Add power manager
+    serviceQueue.sendStatus(statusData);
+
+    // Device info for settings screen
+    DeviceInfoData deviceInfo;
+    memset(&deviceInfo, 0, sizeof(deviceInfo));
+
+    // Network
+    deviceInfo.wifiConnected = WiFi.isConnected();
+    if (WiFi.isConnected()) {
+        strncpy(deviceInfo.wifiSSID, WiFi.SSID().c_str(), sizeof(deviceInfo.wifiSSID) - 1);
+        strncpy(deviceInfo.ipAddress, WiFi.localIP().toString().c_str(), sizeof(deviceInfo.ipAddress) - 1);
+        deviceInfo.rssi = WiFi.RSSI();
+    }
+    strncpy(deviceInfo.macAddress, WiFi.macAddress().c_str(), sizeof(deviceInfo.macAddress) - 1);
+
+    // MQTT
+    deviceInfo.mqttConnected = mqttClient && mqttClient->isConnected();
+
+    // Hue
+    deviceInfo.hueConnected = hueService && hueService->isConnected();
+    if (hueService && hueService->isConnected()) {
+        strncpy(deviceInfo.hueBridgeIP, hueService->getBridgeIP(), sizeof(deviceInfo.hueBridgeIP) - 1);
+        deviceInfo.hueRoomCount = hueService->getRoomCount();
+    }
+
+    // Tado
+    deviceInfo.tadoConnected = tadoService && tadoService->isConnected();
+    if (tadoService && tadoService->isConnected()) {
+        deviceInfo.tadoZoneCount = tadoService->getZoneCount();
+    }
+
+    // System
+    deviceInfo.freeHeap = ESP.getFreeHeap();
+    deviceInfo.freePSRAM = ESP.getFreePsram();
+    deviceInfo.uptime = millis() / 1000;
+    deviceInfo.cpuFreqMHz = getCpuFrequencyMhz();
+
+    // Power
+    deviceInfo.batteryPercent = 100;  // TODO: Add power manager
+    deviceInfo.batteryMV = 4200;      // TODO: Add power manager
+    deviceInfo.usbPowered = true;     // TODO: Add power manager
+    deviceInfo.charging = false;
+
+    // Sensors
+    if (sensorManager) {
+        SensorState stcc4State = sensorManager->getSTCC4State();
+        SensorState bme688State = sensorManager->getBME688State();
+        deviceInfo.stcc4Connected = (stcc4State == SensorState::ACTIVE || stcc4State == SensorState::WARMING_UP);
+        deviceInfo.bme688Connected = (bme688State == SensorState::ACTIVE || bme688State == SensorState::WARMING_UP);
+        deviceInfo.bme688IaqAccuracy = sensorManager->getIAQAccuracy();
+    }
+
+    // Controller
+    deviceInfo.controllerConnected = xboxDriver && xboxDriver->isConnected();
+    deviceInfo.controllerBattery = 100;  // TODO: Get from Xbox driver
+
+    // Firmware
+    strncpy(deviceInfo.firmwareVersion, "3.2.0", sizeof(deviceInfo.firmwareVersion) - 1);
+
+    serviceQueue.sendDeviceInfo(deviceInfo);
+
+    // Send sensor data to UI for dashboard
+    sendSensorDataToUI();
+
+    // Publish telemetry via MQTT
+    if (mqttClient && mqttClient->isConnected() && sensorManager) {
+        String telemetryJson = "{";
+        telemetryJson += "\"co2\":" + String(sensorManager->getCO2()) + ",";
+        telemetryJson += "\"temperature\":" + String(sensorManager->getTemperature(), 1) + ",";
+        telemetryJson += "\"humidity\":" + String(sensorManager->getHumidity(), 1) + ",";
+        telemetryJson += "\"battery\":" + String(100) + ",";  // TODO: Add power manager
+        telemetryJson += "\"iaq\":" + String(sensorManager->getIAQ()) + ",";
+        telemetryJson += "\"iaqAccuracy\":" + String(sensorManager->getIAQAccuracy()) + ",";
+        telemetryJson += "\"pressure\":" + String(sensorManager->getPressure(), 1) + ",";
+        telemetryJson += "\"bme688Temperature\":" + String(sensorManager->getBME688Temperature(), 1) + ",";
+        telemetryJson += "\"bme688Humidity\":" + String(sensorManager->getBME688Humidity(), 1) + ",";
+        telemetryJson += "\"timestamp\":" + String(millis());
+        telemetryJson += "}";
+
+        if (mqttClient->publishTelemetry(telemetryJson)) {
+            Serial.println("[MQTT] Telemetry published");
+        }
+    }
+}
+
+void statsJob() {
+    ioScheduler.logStats();
+    networkWorker.logStats();
+}
+
 // =============================================================================
 // I/O Task (Core 0) - Xbox Controller, WiFi, MQTT, Sensors
 // =============================================================================
@@ -504,6 +768,11 @@ void ioTask(void* parameter) {
                       WiFi.localIP().toString().c_str(), WiFi.RSSI());
     }
 
+    // Start network lanes (Hue/Tado HTTP runs there, not on this task)
+    if (!networkWorker.start()) {
+        Serial.println("[I/O Task] ERROR: Network worker failed to start");
+    }
+
     // Initialize Xbox driver
     xboxDriver = new XboxDriver();
     xboxDriver->init();
@@ -514,7 +783,7 @@ void ioTask(void* parameter) {
     Serial.println("[I/O Task] Input handler initialized");
 
     // Initialize Hue service (only if WiFi connected)
-    hueService = new HueService();
+    hueService = new HueService(networkWorker);
 
     if (WiFi.isConnected()) {
         // Set up Hue callbacks
@@ -540,7 +809,7 @@ void ioTask(void* parameter) {
     }
 
     // Initialize Tado service (always, WiFi only needed for API calls)
-    tadoService = new TadoService();
+    tadoService = new TadoService(networkWorker);
 
     // Set up Tado callbacks (always, so UI gets state updates)
     tadoService->setStateCallback([](TadoState oldState, TadoState newState) {
@@ -623,241 +892,80 @@ void ioTask(void* parameter) {
         Serial.println("[I/O Task] MQTT client created but not initialized (no WiFi)");
     }
 
-    // Main I/O loop
-    uint32_t lastStatusUpdate = 0;
-    constexpr uint32_t STATUS_UPDATE_INTERVAL_MS = 5000;  // Update status every 5s
+    // Main I/O loop: sleep until the earliest job deadline
+    ioScheduler.addJob("input", inputJob, tasks::IO_INPUT_INTERVAL_MS, tasks::IO_INPUT_BUDGET_MS);
+    ioScheduler.addJob("net", networkJob, tasks::IO_NET_INTERVAL_MS, tasks::IO_NET_BUDGET_MS);
+    ioScheduler.addJob("hue", hueJob, tasks::IO_HUE_INTERVAL_MS, tasks::IO_HUE_BUDGET_MS);
+    ioScheduler.addJob("tado", tadoJob, tasks::IO_TADO_INTERVAL_MS, tasks::IO_TADO_BUDGET_MS);
+    ioScheduler.addJob("sensors", sensorJob, tasks::IO_SENSOR_INTERVAL_MS, tasks::IO_SENSOR_BUDGET_MS);
+    ioScheduler.addJob("mqtt", mqttJob, tasks::IO_MQTT_INTERVAL_MS, tasks::IO_MQTT_BUDGET_MS);
+    ioScheduler.addJob("status", statusJob, tasks::IO_STATUS_INTERVAL_MS, tasks::IO_STATUS_BUDGET_MS);
+    ioScheduler.addJob("stats", statsJob, tasks::IO_STATS_INTERVAL_MS, 0, debug::TASKS_DBG || debug::NET_DBG);
 
     while (true) {
-        uint32_t now = millis();
-
-        // Update Xbox driver (handles BLE connection)
-        xboxDriver->update();
-
-        // Poll for input events
-        InputAction action = inputHandler->poll();
-
-        // Send non-empty actions to UI task via queue
-        if (!action.isNone()) {
-            if (!inputQueue.send(action)) {
-                Serial.println("[I/O Task] WARNING: Input queue full");
-            }
-        }
-
-        // Update Hue service (handles discovery, auth, polling)
-        if (WiFi.isConnected() && hueService) {
-            hueService->update();
-
-            // Process Hue commands from UI
-            HueCommand hueCmd;
-            while (hueCommandQueue.receive(hueCmd)) {
-                switch (hueCmd.type) {
-                    case HueCommandType::TOGGLE_ROOM:
-                        Serial.printf("[Hue] CMD: Toggle room %s\n", hueCmd.roomId);
-                        hueService->toggleRoom(hueCmd.roomId);
-                        break;
-
-                    case HueCommandType::SET_BRIGHTNESS:
-                        Serial.printf("[Hue] CMD: Set brightness %s = %d\n", hueCmd.roomId, hueCmd.value);
-                        // Convert from 0-100 to 0-254
-                        hueService->setRoomBrightness(hueCmd.roomId, (hueCmd.value * 254) / 100);
-                        break;
-
-                    case HueCommandType::ADJUST_BRIGHTNESS:
-                        Serial.printf("[Hue] CMD: Adjust brightness %s %+d\n", hueCmd.roomId, hueCmd.value);
-                        // Convert from 0-100 scale to 0-254 scale
-                        hueService->adjustRoomBrightness(hueCmd.roomId, (hueCmd.value * 254) / 100);
-                        break;
-                }
-            }
-        }
-
-        // Update Tado service (handles auth, token refresh, zone polling)
-        if (tadoService) {
-            // Process Tado commands from UI (always, even without WiFi for START_AUTH feedback)
-            TadoCommand tadoCmd;
-            while (tadoCommandQueue.receive(tadoCmd)) {
-                switch (tadoCmd.type) {
-                    case TadoCommandType::START_AUTH:
-                        // Allow START_AUTH even without WiFi - service will show error
-                        Serial.println("[Tado] CMD: Start OAuth device flow");
-                        tadoService->startAuth();
-                        break;
-
-                    case TadoCommandType::SET_TEMPERATURE:
-                        if (WiFi.isConnected()) {
-                            Serial.printf("[Tado] CMD: Set temp zone %ld = %.1f\n", tadoCmd.zoneId, tadoCmd.value);
-                            tadoService->setZoneTemperature(tadoCmd.zoneId, tadoCmd.value);
-                        }
-                        break;
-
-                    case TadoCommandType::ADJUST_TEMPERATURE:
-                        if (WiFi.isConnected()) {
-                            Serial.printf("[Tado] CMD: Adjust temp zone %ld %+.1f\n", tadoCmd.zoneId, tadoCmd.value);
-                            tadoService->adjustZoneTemperature(tadoCmd.zoneId, tadoCmd.value);
-                        }
-                        break;
-
-                    case TadoCommandType::RESUME_SCHEDULE:
-                        if (WiFi.isConnected()) {
-                            Serial.printf("[Tado] CMD: Resume schedule zone %ld\n", tadoCmd.zoneId);
-                            tadoService->resumeSchedule(tadoCmd.zoneId);
-                        }
-                        break;
-
-                    case TadoCommandType::SET_AUTO_ADJUST:
-                        Serial.printf("[Tado] CMD: Set auto-adjust zone %ld, enabled=%s, target=%.1f\n",
-                                      tadoCmd.zoneId, tadoCmd.autoAdjustEnabled ? "yes" : "no", tadoCmd.value);
-                        if (tadoAutoAdjust) {
-                            const AutoAdjustConfig* existing = tadoAutoAdjust->getConfig(tadoCmd.zoneId);
-                            const char* zoneName = existing ? existing->zoneName : "Unknown";
-                            tadoAutoAdjust->setConfig(tadoCmd.zoneId, zoneName, tadoCmd.value,
-                                                       tadoCmd.autoAdjustEnabled, tadoCmd.hysteresis);
-                        }
-                        break;
-
-                    case TadoCommandType::SYNC_MAPPING:
-                        Serial.printf("[Tado] CMD: Sync mapping zone %ld (%s), target=%.1f, auto=%s\n",
-                                      tadoCmd.zoneId, tadoCmd.zoneName, tadoCmd.value,
-                                      tadoCmd.autoAdjustEnabled ? "yes" : "no");
-                        if (tadoAutoAdjust) {
-                            tadoAutoAdjust->setConfig(tadoCmd.zoneId, tadoCmd.zoneName, tadoCmd.value,
-                                                       tadoCmd.autoAdjustEnabled, tadoCmd.hysteresis);
-                        }
-                        break;
-                }
-            }
+        uint32_t sleepMs = ioScheduler.runDue(millis());
+        vTaskDelay(pdMS_TO_TICKS(sleepMs > 0 ? sleepMs : 1));
+    }
+}
 
-            // Update service (requires WiFi for API calls)
-            if (WiFi.isConnected()) {
-                tadoService->update();
-            }
-        }
+// =============================================================================
+// UI Task (Core 1) - Display, Navigation, Screens
+// =============================================================================
 
-        // Update sensor manager (samples at configured interval internally)
-        if (sensorManager) {
-            sensorManager->update();
-        }
+/**
+ * @brief Apply state snapshots that changed since the last UI loop
+ *
+ * Mailboxes and snapshot stores hold only the newest data, so a burst of
+ * updates from the I/O core costs one setter call (and at most one
+ * render) here.
+ */
+void applyServiceSnapshots() {
+    StatusBarData status;
+    if (serviceQueue.readStatus(status)) {
+        statusBar.setData(status);
+        statusBarChanged = true;  // Repaint only the bar; diff picks the refresh
+        Serial.println("[Service] Status bar updated");
+    }
 
-        // Update Tado auto-adjust control loop (runs internally at 5-minute intervals)
-        if (tadoAutoAdjust && sensorManager) {
-            float currentTemp = sensorManager->getTemperature();
-            tadoAutoAdjust->update(currentTemp);
-        }
+    HueStateData hueState;
+    if (serviceQueue.readHueState(hueState)) {
+        settingsHue->setState(hueState.state, hueState.bridgeIP, hueState.roomCount);
+        Serial.printf("[Service] Hue state updated: %s\n", getHueStateName(hueState.state));
+    }
 
-        // Update MQTT client (handles connection and reconnection)
-        if (mqttClient && WiFi.isConnected()) {
-            mqttClient->update();
+    TadoStateData tadoState;
+    if (serviceQueue.readTadoState(tadoState)) {
+        settingsTado->setState(tadoState.state, tadoState.zoneCount);
+        if (tadoState.state == TadoState::AWAITING_AUTH) {
+            settingsTado->setAuthInfo(tadoState.authInfo);
         }
+        Serial.printf("[Service] Tado state updated: %s\n", getTadoStateName(tadoState.state));
+    }
 
-        // Periodic status and sensor data update
-        if (now - lastStatusUpdate >= STATUS_UPDATE_INTERVAL_MS) {
-            lastStatusUpdate = now;
-
-            // Status bar data
-            StatusBarData statusData;
-            statusData.wifiConnected = WiFi.isConnected();
-            statusData.wifiRSSI = WiFi.isConnected() ? WiFi.RSSI() : 0;
-            statusData.mqttConnected = mqttClient && mqttClient->isConnected();
-            statusData.hueConnected = hueService && hueService->isConnected();
-            statusData.tadoConnected = tadoService && tadoService->isConnected();
-            statusData.temperature = sensorManager ? sensorManager->getTemperature() : 0.0f;
-            statusData.co2 = sensorManager ? sensorManager->getCO2() : 0;
-            statusData.batteryPercent = 100;   // TODO: Add power manager
-            statusData.usbPowered = true;      // TODO: Add power manager
-            serviceQueue.sendStatus(statusData);
-
-            // Device info for settings screen
-            DeviceInfoData deviceInfo;
-            memset(&deviceInfo, 0, sizeof(deviceInfo));
-
-            // Network
-            deviceInfo.wifiConnected = WiFi.isConnected();
-            if (WiFi.isConnected()) {
-                strncpy(deviceInfo.wifiSSID, WiFi.SSID().c_str(), sizeof(deviceInfo.wifiSSID) - 1);
-                strncpy(deviceInfo.ipAddress, WiFi.localIP().toString().c_str(), sizeof(deviceInfo.ipAddress) - 1);
-                deviceInfo.rssi = WiFi.RSSI();
-            }
-            strncpy(deviceInfo.macAddress, WiFi.macAddress().c_str(), sizeof(deviceInfo.macAddress) - 1);
-
-            // MQTT
-            deviceInfo.mqttConnected = mqttClient && mqttClient->isConnected();
-
-            // Hue
-            deviceInfo.hueConnected = hueService && hueService->isConnected();
-            if (hueService && hueService->isConnected()) {
-                strncpy(deviceInfo.hueBridgeIP, hueService->getBridgeIP(), sizeof(deviceInfo.hueBridgeIP) - 1);
-                deviceInfo.hueRoomCount = hueService->getRoomCount();
-            }
-
-            // Tado
-            deviceInfo.tadoConnected = tadoService && tadoService->isConnected();
-            if (tadoService && tadoService->isConnected()) {
-                deviceInfo.tadoZoneCount = tadoService->getZoneCount();
-            }
+    SensorData sensorData;
+    if (serviceQueue.readSensorData(sensorData)) {
+        sensorDashboard->setSensorData(sensorData);
+        Serial.println("[Service] Sensor data updated");
+    }
 
-            // System
-            deviceInfo.freeHeap = ESP.getFreeHeap();
-            deviceInfo.freePSRAM = ESP.getFreePsram();
-            deviceInfo.uptime = millis() / 1000;
-            deviceInfo.cpuFreqMHz = getCpuFrequencyMhz();
-
-            // Power
-            deviceInfo.batteryPercent = 100;  // TODO: Add power manager
-            deviceInfo.batteryMV = 4200;      // TODO: Add power manager
-            deviceInfo.usbPowered = true;     // TODO: Add power manager
-            deviceInfo.charging = false;
-
-            // Sensors
-            if (sensorManager) {
-                SensorState stcc4State = sensorManager->getSTCC4State();
-                SensorState bme688State = sensorManager->getBME688State();
-                deviceInfo.stcc4Connected = (stcc4State == SensorState::ACTIVE || stcc4State == SensorState::WARMING_UP);
-                deviceInfo.bme688Connected = (bme688State == SensorState::ACTIVE || bme688State == SensorState::WARMING_UP);
-                deviceInfo.bme688IaqAccuracy = sensorManager->getIAQAccuracy();
-            }
+    DeviceInfoData deviceInfo;
+    if (serviceQueue.readDeviceInfo(deviceInfo)) {
+        settingsInfo->setDeviceInfo(deviceInfo.toDeviceInfo());
+        Serial.println("[Service] Device info updated");
+    }
 
-            // Controller
-            deviceInfo.controllerConnected = xboxDriver && xboxDriver->isConnected();
-            deviceInfo.controllerBattery = 100;  // TODO: Get from Xbox driver
-
-            // Firmware
-            strncpy(deviceInfo.firmwareVersion, "3.2.0", sizeof(deviceInfo.firmwareVersion) - 1);
-
-            serviceQueue.sendDeviceInfo(deviceInfo);
-
-            // Send sensor data to UI for dashboard
-            sendSensorDataToUI();
-
-            // Publish telemetry via MQTT
-            if (mqttClient && mqttClient->isConnected() && sensorManager) {
-                String telemetryJson = "{";
-                telemetryJson += "\"co2\":" + String(sensorManager->getCO2()) + ",";
-                telemetryJson += "\"temperature\":" + String(sensorManager->getTemperature(), 1) + ",";
-                telemetryJson += "\"humidity\":" + String(sensorManager->getHumidity(), 1) + ",";
-                telemetryJson += "\"battery\":" + String(100) + ",";  // TODO: Add power manager
-                telemetryJson += "\"iaq\":" + String(sensorManager->getIAQ()) + ",";
-                telemetryJson += "\"iaqAccuracy\":" + String(sensorManager->getIAQAccuracy()) + ",";
-                telemetryJson += "\"pressure\":" + String(sensorManager->getPressure(), 1) + ",";
-                telemetryJson += "\"bme688Temperature\":" + String(sensorManager->getBME688Temperature(), 1) + ",";
-                telemetryJson += "\"bme688Humidity\":" + String(sensorManager->getBME688Humidity(), 1) + ",";
-                telemetryJson += "\"timestamp\":" + String(millis());
-                telemetryJson += "}";
-
-                if (mqttClient->publishTelemetry(telemetryJson)) {
-                    Serial.println("[MQTT] Telemetry published");
-                }
-            }
-        }
+    // Room/zone tables: screens skip generations they already show
+    auto rooms = serviceQueue.readHueRooms();
+    if (rooms.generation != 0) {
+        hueDashboard->setRooms(*rooms.table, rooms.generation);
+    }
 
-        // Yield to other tasks (10ms = 100Hz polling)
-        vTaskDelay(pdMS_TO_TICKS(10));
+    auto zones = serviceQueue.readTadoZones();
+    if (zones.generation != 0) {
+        tadoControl->setZones(*zones.table, zones.generation);
     }
 }
 
-// =============================================================================
-// UI Task (Core 1) - Display, Navigation, Screens
-// =============================================================================
-
 void uiTask(void* parameter) {
     Serial.printf("[UI Task] Started on Core %d\n", xPortGetCoreID());
 
@@ -875,6 +983,8 @@ void uiTask(void* parameter) {
         // Process all pending input from queue
         InputAction rawAction;
         while (inputQueue.receive(rawAction)) {
+            displayDriver.noteInput();  // Postpones ghosting clean-up
+
             // Submit to batcher (coalesces rapid D-pad movements)
             inputBatcher->submit(rawAction);
         }
@@ -906,62 +1016,15 @@ void uiTask(void* parameter) {
         // Update navigation controller (handles timing)
         navController.update();
 
-        // Process service data updates from I/O core
-        ServiceUpdate serviceUpdate;
-        while (serviceQueue.receive(serviceUpdate)) {
-            switch (serviceUpdate.type) {
-                case ServiceDataType::STATUS_UPDATE:
-                    statusBar.setData(serviceUpdate.statusData);
-                    needsFullRefresh = true;  // Status bar changed, need full redraw
-                    Serial.println("[Service] Status bar updated");
-                    break;
-
-                case ServiceDataType::HUE_ROOMS: {
-                    auto rooms = serviceQueue.getHueRooms();
-                    hueDashboard->setRooms(rooms);
-                    Serial.printf("[Service] Hue rooms updated: %d rooms\n", rooms.size());
-                    break;
-                }
-
-                case ServiceDataType::HUE_STATE: {
-                    const auto& hueState = serviceUpdate.hueStateData;
-                    settingsHue->setState(hueState.state, hueState.bridgeIP, hueState.roomCount);
-                    Serial.printf("[Service] Hue state updated: %s\n", getHueStateName(hueState.state));
-                    break;
-                }
-
-                case ServiceDataType::TADO_ZONES: {
-                    auto zones = serviceQueue.getTadoZones();
-                    tadoControl->setZones(zones);
-                    Serial.printf("[Service] Tado zones updated: %d zones\n", zones.size());
-                    break;
-                }
-
-                case ServiceDataType::TADO_STATE: {
-                    const auto& tadoState = serviceUpdate.tadoStateData;
-                    settingsTado->setState(tadoState.state, tadoState.zoneCount);
-                    if (tadoState.state == TadoState::AWAITING_AUTH) {
-                        settingsTado->setAuthInfo(tadoState.authInfo);
-                    }
-                    Serial.printf("[Service] Tado state updated: %s\n", getTadoStateName(tadoState.state));
-                    break;
-                }
-
-                case ServiceDataType::SENSOR_DATA:
-                    sensorDashboard->setSensorData(serviceUpdate.sensorData);
-                    Serial.println("[Service] Sensor data updated");
-                    break;
-
-                case ServiceDataType::DEVICE_INFO:
-                    settingsInfo->setDeviceInfo(serviceUpdate.deviceInfoData.toDeviceInfo());
-                    Serial.println("[Service] Device info updated");
-                    break;
-            }
-        }
+        // Process service data from I/O core (newest snapshots only)
+        applyServiceSnapshots();
 
         // Render if needed
         renderCurrentScreen();
 
+        // Issue refreshes that queued while the panel was busy
+        displayDriver.service();
+
         // Yield to other tasks
         vTaskDelay(pdMS_TO_TICKS(10));
     }
@@ -1,5 +1,6 @@
 #include "tado/tado_service.h"
 #include <ArduinoJson.h>
+#include <HTTPClient.h>
 #include <WiFi.h>
 #include <Preferences.h>
 #include <stdarg.h>
@@ -8,10 +9,69 @@ namespace paperhome {
 
 using namespace config::tado;
 
-TadoService::TadoService()
+// Fields of a HOPS room that TadoZoneData keeps; the rest (connection,
+// schedule, open window, boost, away) is skipped while parsing
+static const JsonDocument& roomFilter() {
+    static const JsonDocument filter = [] {
+        JsonDocument doc;
+        JsonObject room = doc.add<JsonObject>();
+        room["id"] = true;
+        room["name"] = true;
+        room["sensorDataPoints"]["insideTemperature"]["value"] = true;
+        room["sensorDataPoints"]["humidity"]["percentage"] = true;
+        room["setting"]["power"] = true;
+        room["setting"]["temperature"]["value"] = true;
+        room["manualControlTermination"] = true;
+        room["heatingPower"]["percentage"] = true;
+        return doc;
+    }();
+    return filter;
+}
+
+/**
+ * @brief Pass-through Stream that counts the bytes read from it
+ */
+class CountingStream : public Stream {
+public:
+    explicit CountingStream(Stream& source) : _source(source), _count(0) {}
+
+    int available() override { return _source.available(); }
+    int peek() override { return _source.peek(); }
+    size_t write(uint8_t) override { return 0; }
+
+    int read() override {
+        const int c = _source.read();
+        if (c >= 0) {
+            _count++;
+        }
+        return c;
+    }
+
+    // Count the rest of the body (what the parser did not need)
+    uint32_t finish() {
+        while (read() >= 0) {
+        }
+        return _count;
+    }
+
+private:
+    Stream& _source;
+    uint32_t _count;
+};
+
+TadoService::TadoService(NetworkWorker& network)
     : _stateMachine(TadoState::DISCONNECTED)
     , _homeId(0)
     , _zoneCount(0)
+    , _polledCount(0)
+    , _fetchedCount(0)
+    , _fetchedBytes(0)
+    , _fetchedUs(0)
+    , _fetchPending(false)
+    , _refetchQueued(false)
+    , _conditionalPoll(CONDITIONAL_POLL)
+    , _network(network)
+    , _backgroundPending(0)
     , _lastPollTime(0)
     , _lastTokenRefresh(0)
     , _lastAuthPoll(0)
@@ -22,6 +82,9 @@ TadoService::TadoService()
     memset(_homeName, 0, sizeof(_homeName));
     memset(&_authInfo, 0, sizeof(_authInfo));
     memset(_zones, 0, sizeof(_zones));
+    memset(_zoneChanges, 0, sizeof(_zoneChanges));
+    memset(_polledZones, 0, sizeof(_polledZones));
+    memset(_fetchedZones, 0, sizeof(_fetchedZones));
 
     _stateMachine.setTransitionCallback(
         [this](TadoState oldState, TadoState newState, const char* message) {
@@ -80,6 +143,10 @@ void TadoService::handleDisconnected() {
 void TadoService::handleAuthenticating() {
     uint32_t now = millis();
 
+    if (_backgroundPending > 0) {
+        return;  // Previous poll still in flight
+    }
+
     if (now - _lastAuthPoll < _authPollInterval) {
         return;  // Not time to poll yet
     }
@@ -92,16 +159,7 @@ void TadoService::handleAuthenticating() {
         return;
     }
 
-    if (pollForToken()) {
-        log("Authentication successful!");
-        if (fetchHomeId()) {
-            fetchZones();
-            _lastTokenRefresh = millis();
-            _stateMachine.setState(TadoState::CONNECTED, "Connected");
-        } else {
-            _stateMachine.setState(TadoState::ERROR, "Failed to get home ID");
-        }
-    }
+    pollForToken();
 }
 
 void TadoService::handleVerifying() {
@@ -110,6 +168,10 @@ void TadoService::handleVerifying() {
         return;
     }
 
+    if (_backgroundPending > 0) {
+        return;
+    }
+
     uint32_t now = millis();
     if (now - _lastVerifyAttempt < VERIFY_RETRY_INTERVAL_MS) {
         return;
@@ -118,12 +180,17 @@ void TadoService::handleVerifying() {
     _lastVerifyAttempt = now;
     log("Attempting token verification...");
 
-    if (fetchHomeId()) {
-        log("Token verification successful");
-        fetchZones();
-        _lastTokenRefresh = millis();
-        _stateMachine.setState(TadoState::CONNECTED, "Connected to Tado");
-    } else {
+    fetchHomeId([this](bool ok) {
+        if (!_stateMachine.isInState(TadoState::VERIFYING)) {
+            return;
+        }
+
+        if (ok) {
+            log("Token verification successful");
+            onHomeVerified("Connected to Tado");
+            return;
+        }
+
         _verifyRetries++;
         logf("Token verification failed (attempt %d/%d)", _verifyRetries, MAX_VERIFY_RETRIES);
 
@@ -132,20 +199,26 @@ void TadoService::handleVerifying() {
             clearTokens();
             _stateMachine.setState(TadoState::DISCONNECTED, "Authentication required");
         }
-    }
+    });
 }
 
 void TadoService::handleConnected() {
     uint32_t now = millis();
 
-    // Refresh token periodically
+    // A setpoint whose result never showed up: show the polled state again
+    if (_pending.expire(now, PENDING_TIMEOUT_MS)) {
+        publishZones();
+    }
+
+    if (_backgroundPending > 0) {
+        return;
+    }
+
+    // Refresh token periodically (zones are polled once it completes)
     if (now - _lastTokenRefresh >= TOKEN_REFRESH_MS) {
         _lastTokenRefresh = now;
-        if (!refreshAccessToken()) {
-            log("Token refresh failed");
-            _stateMachine.setState(TadoState::ERROR, "Token refresh failed");
-            return;
-        }
+        refreshAccessToken();
+        return;
     }
 
     // Poll zones periodically
@@ -155,6 +228,12 @@ void TadoService::handleConnected() {
     }
 }
 
+void TadoService::onHomeVerified(const char* message) {
+    fetchZones();
+    _lastTokenRefresh = millis();
+    _stateMachine.setState(TadoState::CONNECTED, message);
+}
+
 void TadoService::startAuth() {
     log("Starting OAuth device code flow...");
 
@@ -164,10 +243,7 @@ void TadoService::startAuth() {
         return;
     }
 
-    if (requestDeviceCode()) {
-        _lastAuthPoll = millis();
-        _stateMachine.setState(TadoState::AWAITING_AUTH, "Waiting for login");
-    } else {
+    if (!requestDeviceCode()) {
         _stateMachine.setState(TadoState::ERROR, "Failed to get device code");
     }
 }
@@ -182,6 +258,9 @@ void TadoService::logout() {
     log("Logging out");
     clearTokens();
     _zoneCount = 0;
+    _polledCount = 0;
+    _zonesEtag = "";
+    _pending.clear();
     _stateMachine.setState(TadoState::DISCONNECTED, "Logged out");
 }
 
@@ -189,13 +268,22 @@ bool TadoService::requestDeviceCode() {
     log("Requesting device code...");
 
     String body = "client_id=" + String(CLIENT_ID) + "&scope=offline_access";
-    String response;
 
-    if (!httpsPost(AUTH_URL, body, response)) {
-        log("Failed to request device code");
-        return false;
-    }
+    return httpsPost(AUTH_URL, body, NetPriority::USER, [this](bool ok, const String& response) {
+        if (!ok) {
+            log("Failed to request device code");
+        }
 
+        if (ok && handleDeviceCodeResponse(response)) {
+            _lastAuthPoll = millis();
+            _stateMachine.setState(TadoState::AWAITING_AUTH, "Waiting for login");
+        } else {
+            _stateMachine.setState(TadoState::ERROR, "Failed to get device code");
+        }
+    });
+}
+
+bool TadoService::handleDeviceCodeResponse(const String& response) {
     // Debug: print raw response
     logf("Raw response length: %d", response.length());
     Serial.println("[Tado] Raw response:");
@@ -260,12 +348,30 @@ bool TadoService::pollForToken() {
     String body = "client_id=" + String(CLIENT_ID) +
                   "&grant_type=urn:ietf:params:oauth:grant-type:device_code" +
                   "&device_code=" + _deviceCode;
-    String response;
 
-    if (!httpsPost(TOKEN_URL, body, response)) {
-        return false;
-    }
+    return httpsPost(TOKEN_URL, body, NetPriority::BACKGROUND, [this](bool ok, const String& response) {
+        // Cancelled or expired while the request was in flight
+        TadoState state = _stateMachine.getState();
+        if (state != TadoState::AWAITING_AUTH && state != TadoState::AUTHENTICATING) {
+            return;
+        }
 
+        if (!ok || !handleTokenResponse(response)) {
+            return;
+        }
+
+        log("Authentication successful!");
+        fetchHomeId([this](bool found) {
+            if (found) {
+                onHomeVerified("Connected");
+            } else {
+                _stateMachine.setState(TadoState::ERROR, "Failed to get home ID");
+            }
+        });
+    });
+}
+
+bool TadoService::handleTokenResponse(const String& response) {
     JsonDocument doc;
     DeserializationError error = deserializeJson(doc, response);
     if (error) {
@@ -309,165 +415,265 @@ bool TadoService::refreshAccessToken() {
     String body = "client_id=" + String(CLIENT_ID) +
                   "&grant_type=refresh_token" +
                   "&refresh_token=" + _refreshToken;
-    String response;
 
-    if (!httpsPost(TOKEN_URL, body, response)) {
-        return false;
-    }
+    return httpsPost(TOKEN_URL, body, NetPriority::BACKGROUND, [this](bool ok, const String& response) {
+        if (!_stateMachine.isInState(TadoState::CONNECTED)) {
+            return;
+        }
 
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, response);
-    if (error) {
-        return false;
-    }
+        JsonDocument doc;
+        if (ok && !deserializeJson(doc, response) && doc.containsKey("access_token")) {
+            _accessToken = doc["access_token"].as<String>();
 
-    if (doc.containsKey("access_token")) {
-        _accessToken = doc["access_token"].as<String>();
+            if (doc.containsKey("refresh_token")) {
+                _refreshToken = doc["refresh_token"].as<String>();
+            }
 
-        if (doc.containsKey("refresh_token")) {
-            _refreshToken = doc["refresh_token"].as<String>();
+            saveTokens();
+            log("Token refreshed successfully");
+            return;
         }
 
-        saveTokens();
-        log("Token refreshed successfully");
-        return true;
-    }
-
-    return false;
+        log("Token refresh failed");
+        _stateMachine.setState(TadoState::ERROR, "Token refresh failed");
+    });
 }
 
-bool TadoService::fetchHomeId() {
+bool TadoService::fetchHomeId(std::function<void(bool ok)> done) {
     String url = String(API_URL) + "/me";
-    String response;
 
-    if (!httpsGet(url, response)) {
-        return false;
-    }
+    return httpsGet(url, NetPriority::BACKGROUND, [this, done](bool ok, const String& response) {
+        if (!ok) {
+            done(false);
+            return;
+        }
 
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, response);
-    if (error) {
-        logf("JSON parse error: %s", error.c_str());
-        return false;
-    }
+        JsonDocument doc;
+        DeserializationError error = deserializeJson(doc, response);
+        if (error) {
+            logf("JSON parse error: %s", error.c_str());
+            done(false);
+            return;
+        }
 
-    JsonArray homes = doc["homes"].as<JsonArray>();
-    if (homes.size() > 0) {
-        _homeId = homes[0]["id"].as<int32_t>();
-        String name = homes[0]["name"].as<String>();
-        strncpy(_homeName, name.c_str(), sizeof(_homeName) - 1);
-        logf("Home ID: %d, Name: %s", _homeId, _homeName);
-        return true;
-    }
+        JsonArray homes = doc["homes"].as<JsonArray>();
+        if (homes.size() > 0) {
+            _homeId = homes[0]["id"].as<int32_t>();
+            String name = homes[0]["name"].as<String>();
+            strncpy(_homeName, name.c_str(), sizeof(_homeName) - 1);
+            logf("Home ID: %d, Name: %s", _homeId, _homeName);
+            done(true);
+            return;
+        }
 
-    log("No homes found in account");
-    return false;
+        log("No homes found in account");
+        done(false);
+    });
 }
 
 bool TadoService::fetchZones() {
     if (_homeId == 0) {
-        if (!fetchHomeId()) {
-            return false;
-        }
+        return fetchHomeId([this](bool ok) {
+            if (ok) {
+                fetchZones();
+            }
+        });
     }
 
-    String url = String(HOPS_URL) + "/homes/" + String(_homeId) + "/rooms";
-    String response;
+    // One fetch at a time: the staging zones belong to it. A setpoint
+    // completing while one is in flight gets another fetch after it.
+    if (_fetchPending) {
+        _refetchQueued = true;
+        return true;
+    }
 
-    if (!httpsGet(url, response)) {
-        log("Failed to fetch zones");
+    NetRequest request;
+    request.method = NetMethod::GET;
+    request.url = String(HOPS_URL) + "/homes/" + String(_homeId) + "/rooms";
+    request.authorization = "Bearer " + _accessToken;
+    if (_conditionalPoll) {
+        request.ifNoneMatch = _zonesEtag;
+    }
+
+    // The lane parses the body straight off the connection into the
+    // staging fields; the completion reads them back
+    request.reader = [this](Stream& body) {
+        const uint32_t start = micros();
+        CountingStream counted(body);
+        const bool parsed = parseZones(counted, _fetchedZones, _fetchedCount);
+        _fetchedBytes = counted.finish();
+        _fetchedUs = micros() - start;
+        return parsed;
+    };
+
+    const uint32_t fetch = _pending.beginFetch();
+    _fetchPending = submit(std::move(request), NetPriority::BACKGROUND,
+        [this, fetch](const NetResponse& response) {
+            onZonesFetched(response, fetch);
+        });
+    return _fetchPending;
+}
+
+void TadoService::onZonesFetched(const NetResponse& response, uint32_t fetch) {
+    _fetchPending = false;
+    const bool refetch = _refetchQueued;
+    _refetchQueued = false;
+
+    if (response.code == HTTP_CODE_OK && response.parsed) {
+        _zoneStats.fetches++;
+        _zoneStats.parses++;
+        _zoneStats.bytes += _fetchedBytes;
+        _zoneStats.parseUs += _fetchedUs;
+
+        memcpy(_polledZones, _fetchedZones, sizeof(_polledZones));
+        _polledCount = _fetchedCount;
+        _zonesEtag = response.etag;
+        logf("Fetched %d zones", _polledCount);
+    } else if (response.code == HTTP_CODE_NOT_MODIFIED) {
+        // Same zone list as the last fetch: nothing to parse
+        _zoneStats.fetches++;
+        _zoneStats.notModified++;
+    } else {
+        if (response.code == HTTP_CODE_OK) {
+            log("Invalid /rooms response");
+            _zonesEtag = "";
+        } else {
+            logf("Failed to fetch zones: %d", response.code);
+        }
+        if (refetch) {
+            fetchZones();
+        }
+        return;
+    }
+
+    // Setpoints completed before this fetch went out are in it now
+    _pending.reconcile(fetch, [this](uint32_t key, const ZoneMutation& mutation) {
+        for (uint8_t i = 0; i < _polledCount; i++) {
+            const TadoZoneData& zone = _polledZones[i];
+            if (static_cast<uint32_t>(zone.id) == key) {
+                return zone.heating && fabsf(zone.targetTemp - mutation.targetTemp) < 0.05f;
+            }
+        }
         return false;
+    });
+
+    publishZones();
+
+    if (refetch) {
+        fetchZones();
     }
+}
+
+bool TadoService::parseZones(Stream& body, TadoZoneData* zones, uint8_t& count) {
+    count = 0;
 
     JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, response);
-    if (error) {
-        logf("JSON parse error: %s", error.c_str());
+    DeserializationError error = deserializeJson(doc, body, DeserializationOption::Filter(roomFilter()));
+    if (error || !doc.is<JsonArray>()) {
         return false;
     }
 
-    TadoZoneData newZones[TADO_MAX_ZONES];
-    uint8_t newCount = 0;
-    bool changed = false;
+    for (JsonObject room : doc.as<JsonArray>()) {
+        if (count >= TADO_MAX_ZONES) break;
 
-    JsonArray zonesArray = doc.as<JsonArray>();
-    for (JsonObject zoneObj : zonesArray) {
-        if (newCount >= TADO_MAX_ZONES) break;
+        TadoZoneData& zone = zones[count++];
+        memset(&zone, 0, sizeof(zone));
 
-        TadoZoneData& zone = newZones[newCount];
-        zone.id = zoneObj["id"].as<int32_t>();
+        zone.id = room["id"] | 0;
+        strncpy(zone.name, room["name"] | "", sizeof(zone.name) - 1);
 
-        String name = zoneObj["name"].as<String>();
-        strncpy(zone.name, name.c_str(), sizeof(zone.name) - 1);
+        // Sensor data from sensorDataPoints (HOPS API structure)
+        JsonObject sensors = room["sensorDataPoints"];
+        zone.currentTemp = sensors["insideTemperature"]["value"] | 0.0f;
+        zone.humidity = sensors["humidity"]["percentage"] | 0.0f;
 
-        // Parse sensor data from sensorDataPoints (HOPS API structure)
-        if (zoneObj.containsKey("sensorDataPoints")) {
-            JsonObject sensorData = zoneObj["sensorDataPoints"];
-            if (sensorData.containsKey("insideTemperature")) {
-                zone.currentTemp = sensorData["insideTemperature"]["value"].as<float>();
-            } else {
-                zone.currentTemp = 0;
-            }
-            if (sensorData.containsKey("humidity")) {
-                zone.humidity = sensorData["humidity"]["percentage"].as<float>();
-            } else {
-                zone.humidity = 0;
-            }
-        } else {
-            zone.currentTemp = 0;
-            zone.humidity = 0;
+        JsonObject setting = room["setting"];
+        if (strcmp(setting["power"] | "", "ON") == 0 && !setting["temperature"].isNull()) {
+            zone.targetTemp = setting["temperature"]["value"] | 0.0f;
+            zone.heating = true;
         }
 
-        if (zoneObj.containsKey("setting")) {
-            JsonObject setting = zoneObj["setting"];
-            if (setting["power"] == "ON" && setting.containsKey("temperature")) {
-                zone.targetTemp = setting["temperature"]["value"].as<float>();
-                zone.heating = true;
-            } else {
-                zone.targetTemp = 0;
-                zone.heating = false;
-            }
-        }
+        zone.manualOverride = !room["manualControlTermination"].isNull();
+        zone.heatingPower = room["heatingPower"]["percentage"] | 0;
+    }
+    return true;
+}
 
-        zone.manualOverride = zoneObj.containsKey("manualControlTermination");
+void TadoService::publishZones() {
+    // Only notify if what is shown actually changed
+    bool changed = (_zoneCount != _polledCount);
+    uint32_t zoneUpdates = 0;
+    uint32_t fieldUpdates = 0;
 
-        if (zoneObj.containsKey("heatingPower")) {
-            zone.heatingPower = zoneObj["heatingPower"]["percentage"].as<uint8_t>();
-        } else {
-            zone.heatingPower = 0;
+    for (uint8_t i = 0; i < _polledCount; i++) {
+        TadoZoneData zone = _polledZones[i];
+
+        const ZoneMutation* pending = _pending.get(static_cast<uint32_t>(zone.id));
+        if (pending) {
+            // Manual control switches the zone on at the new setpoint
+            zone.targetTemp = pending->targetTemp;
+            zone.heating = true;
+            zone.manualOverride = true;
         }
 
-        // Check if this zone changed
-        if (newCount < _zoneCount) {
-            const TadoZoneData& old = _zones[newCount];
-            if (old.id != zone.id ||
-                old.currentTemp != zone.currentTemp ||
-                old.targetTemp != zone.targetTemp ||
-                old.heating != zone.heating) {
-                changed = true;
-            }
-        } else {
+        const uint8_t mask = (i < _zoneCount) ? zoneChanges(_zones[i], zone) : TADO_ZONE_ADDED;
+        _zoneChanges[i] = mask;
+        if (mask) {
             changed = true;
+            zoneUpdates++;
+            for (uint8_t bits = mask; bits; bits &= bits - 1) {
+                fieldUpdates++;
+            }
         }
 
-        newCount++;
+        // Changes below what is shown are kept, just not published
+        _zones[i] = zone;
     }
+    _zoneCount = _polledCount;
 
-    if (newCount != _zoneCount) {
-        changed = true;
+    if (changed) {
+        _zoneStats.publishes++;
+        _zoneStats.zoneUpdates += zoneUpdates;
+        _zoneStats.fieldUpdates += fieldUpdates;
+        if (_zonesCallback) {
+            _zonesCallback();
+        }
     }
+}
 
-    // Update zones
-    memcpy(_zones, newZones, sizeof(newZones));
-    _zoneCount = newCount;
-
-    logf("Fetched %d zones", _zoneCount);
+uint8_t TadoService::zoneChanges(const TadoZoneData& shown, const TadoZoneData& zone) {
+    if (shown.id != zone.id) {
+        return TADO_ZONE_ADDED;
+    }
 
-    if (changed && _zonesCallback) {
-        _zonesCallback();
+    uint8_t mask = 0;
+    if (strcmp(shown.name, zone.name) != 0) {
+        mask |= TADO_ZONE_NAME;
     }
+    if (tadoTenths(shown.currentTemp) != tadoTenths(zone.currentTemp)) {
+        mask |= TADO_ZONE_CURRENT_TEMP;
+    }
+    if (tadoTenths(shown.targetTemp) != tadoTenths(zone.targetTemp)) {
+        mask |= TADO_ZONE_TARGET_TEMP;
+    }
+    if (tadoPercent(shown.humidity) != tadoPercent(zone.humidity)) {
+        mask |= TADO_ZONE_HUMIDITY;
+    }
+    if (shown.heating != zone.heating || shown.heatingPower != zone.heatingPower) {
+        mask |= TADO_ZONE_HEATING;
+    }
+    if (shown.manualOverride != zone.manualOverride) {
+        mask |= TADO_ZONE_MANUAL;
+    }
+    return mask;
+}
 
-    return true;
+uint8_t TadoService::getZoneChanges(uint8_t index) const {
+    return index < _zoneCount ? _zoneChanges[index] : 0;
+}
+
+void TadoService::setConditionalPolling(bool enabled) {
+    _conditionalPoll = enabled;
 }
 
 bool TadoService::refreshZones() {
@@ -501,6 +707,9 @@ bool TadoService::adjustZoneTemperature(int32_t zoneId, float delta) {
 }
 
 bool TadoService::resumeSchedule(int32_t zoneId) {
+    // The schedule's setpoint is unknown until the next fetch
+    _pending.remove(static_cast<uint32_t>(zoneId));
+    publishZones();
     return sendResumeSchedule(zoneId);
 }
 
@@ -523,13 +732,31 @@ bool TadoService::sendManualControl(int32_t zoneId, float temp, int durationSeco
     String body;
     serializeJson(doc, body);
 
-    String response;
-    if (!httpsPostJson(url, body, response)) {
-        logf("Failed to set temperature for zone %d", zoneId);
+    const uint32_t key = static_cast<uint32_t>(zoneId);
+    const uint32_t token = _pending.set(key, ZoneMutation{temp}, millis());
+
+    const bool queued = httpsPostJson(url, body, [this, zoneId, temp, key, token](bool ok, const String&) {
+        if (_pending.ack(key, token, ok, millis())) {
+            publishZones();
+        }
+        if (!ok) {
+            logf("Failed to set temperature for zone %d, rolled back", zoneId);
+            return;
+        }
+        logf("Set zone %d to %.1fC", zoneId, temp);
+
+        // Confirm now rather than at the next poll
+        _lastPollTime = millis();
+        fetchZones();
+    });
+
+    if (!queued) {
+        _pending.remove(key);
         return false;
     }
 
-    logf("Set zone %d to %.1fC", zoneId, temp);
+    // Show it before Tado has it
+    publishZones();
     return true;
 }
 
@@ -537,13 +764,15 @@ bool TadoService::sendResumeSchedule(int32_t zoneId) {
     String url = String(HOPS_URL) + "/homes/" + String(_homeId) +
                  "/rooms/" + String(zoneId) + "/manualControl";
 
-    if (!httpsDelete(url)) {
-        logf("Failed to resume schedule for zone %d", zoneId);
-        return false;
-    }
-
-    logf("Resumed schedule for zone %d", zoneId);
-    return true;
+    return httpsDelete(url, [this, zoneId](bool ok, const String&) {
+        if (!ok) {
+            logf("Failed to resume schedule for zone %d", zoneId);
+            return;
+        }
+        logf("Resumed schedule for zone %d", zoneId);
+        _lastPollTime = millis();
+        fetchZones();
+    });
 }
 
 bool TadoService::loadTokens() {
@@ -597,130 +826,89 @@ void TadoService::clearTokens() {
     log("Tokens cleared from NVS");
 }
 
-bool TadoService::httpsGet(const String& url, String& response) {
-    if (WiFi.status() != WL_CONNECTED) {
-        return false;
-    }
-
-    WiFiClientSecure client;
-    client.setInsecure();
-
-    HTTPClient https;
-    if (!https.begin(client, url)) {
-        return false;
-    }
+bool TadoService::httpsGet(const String& url, NetPriority priority, ResultCallback callback) {
+    NetRequest request;
+    request.method = NetMethod::GET;
+    request.url = url;
+    request.authorization = "Bearer " + _accessToken;
 
-    https.setTimeout(REQUEST_TIMEOUT_MS);
-    https.addHeader("Authorization", "Bearer " + _accessToken);
-
-    int httpCode = https.GET();
+    return submit(std::move(request), priority, [this, callback](const NetResponse& response) {
+        if (response.code != HTTP_CODE_OK) {
+            logf("HTTPS GET failed: %d", response.code);
+        }
+        callback(response.code == HTTP_CODE_OK, response.body);
+    });
+}
+
+bool TadoService::httpsPost(const String& url, const String& body, NetPriority priority,
+                            ResultCallback callback) {
+    NetRequest request;
+    request.method = NetMethod::POST;
+    request.url = url;
+    request.body = body;
+    request.contentType = "application/x-www-form-urlencoded";
+
+    return submit(std::move(request), priority, [this, callback](const NetResponse& response) {
+        if (response.code < 0) {
+            logf("Connection failed: %d", response.code);
+            callback(false, response.body);
+            return;
+        }
 
-    if (httpCode == HTTP_CODE_OK) {
-        response = https.getString();
-        https.end();
-        return true;
-    }
+        // Success codes or 400 (may contain valid OAuth error)
+        if (response.isSuccess() || response.code == HTTP_CODE_BAD_REQUEST) {
+            callback(true, response.body);
+            return;
+        }
 
-    logf("HTTPS GET failed: %d", httpCode);
-    if (httpCode > 0) {
-        response = https.getString();
-    }
-    https.end();
-    return false;
+        logf("HTTPS POST failed: HTTP %d", response.code);
+        callback(false, response.body);
+    });
 }
 
-bool TadoService::httpsPost(const String& url, const String& body, String& response,
-                            const char* contentType) {
-    if (WiFi.status() != WL_CONNECTED) {
-        return false;
-    }
-
-    WiFiClientSecure client;
-    client.setInsecure();
-    client.setTimeout(10);
-
-    HTTPClient https;
-    if (!https.begin(client, url)) {
-        return false;
-    }
-
-    https.setTimeout(REQUEST_TIMEOUT_MS);
-    https.addHeader("Content-Type", contentType);
-
-    int httpCode = https.POST(body);
-
-    if (httpCode < 0) {
-        logf("Connection failed: %d", httpCode);
-        https.end();
-        return false;
-    }
-
-    response = https.getString();
-    https.end();
+bool TadoService::httpsPostJson(const String& url, const String& jsonBody, ResultCallback callback) {
+    NetRequest request;
+    request.method = NetMethod::POST;
+    request.url = url;
+    request.body = jsonBody;
+    request.contentType = "application/json";
+    request.authorization = "Bearer " + _accessToken;
 
-    // Success codes or 400 (may contain valid OAuth error)
-    if (httpCode >= 200 && httpCode < 300) {
-        return true;
-    }
-    if (httpCode == 400) {
-        return true;  // Let caller handle OAuth errors
-    }
-
-    logf("HTTPS POST failed: HTTP %d", httpCode);
-    return false;
+    return submit(std::move(request), NetPriority::USER, [this, callback](const NetResponse& response) {
+        bool ok = response.code == HTTP_CODE_OK || response.code == 201 || response.code == 204;
+        if (!ok) {
+            logf("HTTPS POST JSON failed: %d", response.code);
+        }
+        callback(ok, response.body);
+    });
 }
 
-bool TadoService::httpsPostJson(const String& url, const String& jsonBody, String& response) {
-    if (WiFi.status() != WL_CONNECTED) {
-        return false;
-    }
-
-    WiFiClientSecure client;
-    client.setInsecure();
-
-    HTTPClient https;
-    if (!https.begin(client, url)) {
-        return false;
-    }
-
-    https.setTimeout(REQUEST_TIMEOUT_MS);
-    https.addHeader("Content-Type", "application/json");
-    https.addHeader("Authorization", "Bearer " + _accessToken);
-
-    int httpCode = https.POST(jsonBody);
+bool TadoService::httpsDelete(const String& url, ResultCallback callback) {
+    NetRequest request;
+    request.method = NetMethod::DEL;
+    request.url = url;
+    request.authorization = "Bearer " + _accessToken;
 
-    if (httpCode == HTTP_CODE_OK || httpCode == 201 || httpCode == 204) {
-        response = https.getString();
-        https.end();
-        return true;
-    }
-
-    logf("HTTPS POST JSON failed: %d", httpCode);
-    response = https.getString();
-    https.end();
-    return false;
+    return submit(std::move(request), NetPriority::USER, [callback](const NetResponse& response) {
+        callback(response.code == 204 || response.code == 200, response.body);
+    });
 }
 
-bool TadoService::httpsDelete(const String& url) {
-    if (WiFi.status() != WL_CONNECTED) {
-        return false;
-    }
+bool TadoService::submit(NetRequest&& request, NetPriority priority, NetworkWorker::Callback callback) {
+    request.secure = true;
+    request.timeoutMs = REQUEST_TIMEOUT_MS;
 
-    WiFiClientSecure client;
-    client.setInsecure();
+    const bool background = (priority == NetPriority::BACKGROUND);
+    const bool queued = _network.submit(NetLane::TADO, priority, std::move(request),
+        [this, background, callback](const NetResponse& response) {
+            if (background) _backgroundPending--;
+            callback(response);
+        });
 
-    HTTPClient https;
-    if (!https.begin(client, url)) {
-        return false;
+    if (queued && background) {
+        _backgroundPending++;
     }
-
-    https.setTimeout(REQUEST_TIMEOUT_MS);
-    https.addHeader("Authorization", "Bearer " + _accessToken);
-
-    int httpCode = https.sendRequest("DELETE");
-    https.end();
-
-    return (httpCode == 204 || httpCode == 200);
+    return queued;
 }
 
 void TadoService::onStateTransition(TadoState oldState, TadoState newState, const char* message) {
@@ -1,4 +1,5 @@
 #include "ui/screen.h"
+#include "ui/theme.h"
 #include "core/config.h"
 
 namespace paperhome {
@@ -17,6 +18,53 @@ GridScreen::GridScreen(int16_t cols, int16_t rows, int16_t itemWidth, int16_t it
     , _startY(startY)
     , _spacing(spacing)
 {
+    buildTree();
+}
+
+void GridScreen::buildTree() {
+    _root.setDrawFn([this](Compositor& compositor, const Rect&) {
+        renderChrome(compositor);
+    });
+
+    _cells.reserve(_cols * _rows);
+    for (int16_t i = 0; i < _cols * _rows; i++) {
+        auto cell = std::make_unique<DrawWidget>(
+            rectForCell(i % _cols, i / _cols),
+            [this, i](Compositor& compositor, const Rect& bounds) {
+                if (i < getItemCount()) {
+                    renderCell(compositor, i, bounds);
+                }
+            });
+        _root.addChild(cell.get());
+        _cells.push_back(std::move(cell));
+    }
+}
+
+void GridScreen::render(Compositor& compositor) {
+    _root.setBounds(getContentBounds());
+
+    // Plain markDirty() without invalidated cells means "redraw everything"
+    if (!_root.needsRender()) {
+        _root.invalidate();
+    }
+    _root.render(compositor);
+}
+
+void GridScreen::invalidateAll() {
+    _root.invalidate();
+    markDirty();
+}
+
+void GridScreen::invalidateCell(int16_t index) {
+    if (index >= 0 && index < static_cast<int16_t>(_cells.size())) {
+        _cells[index]->invalidate();
+    }
+    markDirty();
+}
+
+Rect GridScreen::getContentBounds() const {
+    return Rect(0, theme::STATUS_BAR_HEIGHT, config::display::WIDTH,
+                config::display::HEIGHT - theme::STATUS_BAR_HEIGHT);
 }
 
 bool GridScreen::handleEvent(NavEvent event) {
@@ -58,6 +106,9 @@ void GridScreen::setSelection(int16_t col, int16_t row) {
     _prevSelectedRow = _selectedRow;
     _selectedCol = col;
     _selectedRow = row;
+
+    invalidateCell(_prevSelectedRow * _cols + _prevSelectedCol);
+    invalidateCell(getSelectedIndex());
 }
 
 void GridScreen::setSelectionIndex(int16_t index) {
@@ -100,7 +151,10 @@ void GridScreen::moveSelection(int8_t dx, int8_t dy) {
     if (newCol != _selectedCol || newRow != _selectedRow) {
         _selectedCol = newCol;
         _selectedRow = newRow;
-        markDirty();
+
+        // Only the old and new cells change (selection border)
+        invalidateCell(_prevSelectedRow * _cols + _prevSelectedCol);
+        invalidateCell(getSelectedIndex());
         onSelectionChanged();
     }
 }
@@ -120,6 +174,56 @@ ListScreen::ListScreen(int16_t itemHeight, int16_t startY, int16_t marginX)
     , _startY(startY)
     , _marginX(marginX)
 {
+    _root.setDrawFn([this](Compositor& compositor, const Rect&) {
+        renderChrome(compositor);
+    });
+}
+
+void ListScreen::render(Compositor& compositor) {
+    _root.setBounds(getContentBounds());
+    syncItems();
+
+    // Plain markDirty() without invalidated items means "redraw everything"
+    if (!_root.needsRender()) {
+        _root.invalidate();
+    }
+    _root.render(compositor);
+}
+
+void ListScreen::invalidateAll() {
+    _root.invalidate();
+    markDirty();
+}
+
+void ListScreen::invalidateItem(int16_t index) {
+    if (index >= 0 && index < static_cast<int16_t>(_items.size())) {
+        _items[index]->invalidate();
+    }
+    markDirty();
+}
+
+Rect ListScreen::getContentBounds() const {
+    return Rect(0, theme::STATUS_BAR_HEIGHT, config::display::WIDTH,
+                config::display::HEIGHT - theme::STATUS_BAR_HEIGHT);
+}
+
+void ListScreen::syncItems() {
+    int16_t count = getItemCount();
+    if (count == static_cast<int16_t>(_items.size())) return;
+
+    // Item count changed: rebuild item nodes (clearChildren repaints all)
+    _root.clearChildren();
+    _items.clear();
+    _items.reserve(count);
+    for (int16_t i = 0; i < count; i++) {
+        auto item = std::make_unique<DrawWidget>(
+            rectForIndex(i),
+            [this, i](Compositor& compositor, const Rect& bounds) {
+                renderItem(compositor, i, bounds);
+            });
+        _root.addChild(item.get());
+        _items.push_back(std::move(item));
+    }
 }
 
 bool ListScreen::handleEvent(NavEvent event) {
@@ -156,6 +260,9 @@ void ListScreen::setSelection(int16_t index) {
     _selectedIndex = index;
     if (_selectedIndex < 0) _selectedIndex = 0;
     if (_selectedIndex >= count) _selectedIndex = count - 1;
+
+    invalidateItem(_prevSelectedIndex);
+    invalidateItem(_selectedIndex);
 }
 
 int16_t ListScreen::getItemWidth() const {
@@ -176,7 +283,10 @@ void ListScreen::moveSelection(int8_t direction) {
 
     if (newIndex != _selectedIndex) {
         _selectedIndex = newIndex;
-        markDirty();
+
+        // Only the old and new items change (selection border)
+        invalidateItem(_prevSelectedIndex);
+        invalidateItem(_selectedIndex);
         onSelectionChanged();
     }
 }
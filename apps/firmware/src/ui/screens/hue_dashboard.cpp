@@ -14,8 +14,29 @@ void HueDashboard::onEnter() {
 }
 
 void HueDashboard::setRooms(const std::vector<HueRoom>& rooms) {
-    _rooms = rooms;
-    markDirty();
+    _roomsGeneration = 0;
+    applyRooms(rooms.data(), rooms.size());
+}
+
+void HueDashboard::setRooms(const HueRoomTable& table, uint32_t generation) {
+    if (generation == _roomsGeneration) return;
+    _roomsGeneration = generation;
+    applyRooms(table.rooms, table.count);
+}
+
+void HueDashboard::applyRooms(const HueRoom* rooms, size_t count) {
+    if (count != _rooms.size()) {
+        _rooms.assign(rooms, rooms + count);
+        invalidateAll();  // Tiles and empty state change
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (rooms[i] != _rooms[i]) {
+            _rooms[i] = rooms[i];
+            invalidateCell(static_cast<int16_t>(i));
+        }
+    }
 }
 
 const HueRoom* HueDashboard::getSelectedRoom() const {
@@ -61,26 +82,16 @@ bool HueDashboard::handleTrigger(int16_t leftIntensity, int16_t rightIntensity)
 
     if (delta != 0) {
         _onBrightnessChange(room->id, delta);
-        markDirty();  // Brightness changed, need redraw
+        invalidateCell(getSelectedIndex());  // Brightness changed, need redraw
         return true;
     }
     return false;
 }
 
-void HueDashboard::render(Compositor& compositor) {
+void HueDashboard::renderChrome(Compositor& compositor) {
     // Title area (below status bar which will be at top)
     compositor.drawText("Hue", 20, 60, &FreeSansBold18pt7b, true);
 
-    // Render room tiles
-    for (int16_t i = 0; i < static_cast<int16_t>(_rooms.size()); i++) {
-        int16_t col = i % COLS;
-        int16_t row = i / COLS;
-        int16_t x = MARGIN_X + col * (TILE_WIDTH + SPACING);
-        int16_t y = MARGIN_Y + row * (TILE_HEIGHT + SPACING);
-
-        renderTile(compositor, i, x, y);
-    }
-
     // Empty state
     if (_rooms.empty()) {
         compositor.drawTextCentered("No rooms found", 0,
@@ -95,6 +106,10 @@ void HueDashboard::render(Compositor& compositor) {
     renderPageIndicator(compositor, 0, 3);
 }
 
+void HueDashboard::renderCell(Compositor& compositor, int16_t index, const Rect& bounds) {
+    renderTile(compositor, index, bounds.x, bounds.y);
+}
+
 void HueDashboard::renderTile(Compositor& compositor, int16_t index, int16_t x, int16_t y) {
     const HueRoom& room = _rooms[index];
     bool isSelected = (index == getSelectedIndex());
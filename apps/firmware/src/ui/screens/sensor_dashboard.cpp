@@ -14,8 +14,21 @@ void SensorDashboard::onEnter() {
 }
 
 void SensorDashboard::setSensorData(const SensorData& data) {
+    // Snapshot what each panel shows, then repaint only panels that differ
+    char before[6][48];
+    for (int16_t i = 0; i < 6; i++) {
+        formatPanelKey(i, before[i], sizeof(before[i]));
+    }
+
     _data = data;
-    markDirty();
+
+    char after[48];
+    for (int16_t i = 0; i < 6; i++) {
+        formatPanelKey(i, after, sizeof(after));
+        if (strcmp(before[i], after) != 0) {
+            invalidateCell(i);
+        }
+    }
 }
 
 bool SensorDashboard::onConfirm() {
@@ -27,24 +40,18 @@ void SensorDashboard::onSelectionChanged() {
     // Haptic feedback handled by input handler
 }
 
-void SensorDashboard::render(Compositor& compositor) {
+void SensorDashboard::renderChrome(Compositor& compositor) {
     // Title
     compositor.drawText("Sensors", 20, TITLE_Y, &FreeSansBold18pt7b, true);
 
-    // Render 2x3 grid of panels
-    for (int16_t i = 0; i < 6; i++) {
-        int16_t col = i % COLS;
-        int16_t row = i / COLS;
-        int16_t x = MARGIN_X + col * (PANEL_WIDTH + SPACING);
-        int16_t y = MARGIN_Y + row * (PANEL_HEIGHT + SPACING);
-
-        renderPanel(compositor, i, x, y);
-    }
-
     // Page indicator (position 1 of 3 in main stack)
     renderPageIndicator(compositor, 1, 3);
 }
 
+void SensorDashboard::renderCell(Compositor& compositor, int16_t index, const Rect& bounds) {
+    renderPanel(compositor, index, bounds.x, bounds.y);
+}
+
 void SensorDashboard::renderPanel(Compositor& compositor, int16_t index, int16_t x, int16_t y) {
     bool isSelected = (index == getSelectedIndex());
 
@@ -65,12 +72,7 @@ void SensorDashboard::renderPanel(Compositor& compositor, int16_t index, int16_t
     compositor.drawText(unit, x + 10, y + PANEL_HEIGHT / 2 + 40, &FreeSans9pt7b, true);
 
     // Connection status indicator (small dot in corner)
-    bool connected = false;
-    if (index < 3) {
-        connected = _data.stcc4Connected;  // CO2, Temp, Humidity from STCC4
-    } else {
-        connected = _data.bme688Connected;  // IAQ, Pressure, Accuracy from BME688
-    }
+    bool connected = isConnected(index);
 
     if (!connected) {
         // Draw X in corner for disconnected
@@ -81,44 +83,67 @@ void SensorDashboard::renderPanel(Compositor& compositor, int16_t index, int16_t
     }
 
     // Trend arrow (if we have history data)
-    if (connected && _data.historyCount > 1) {
-        int16_t arrowX = x + PANEL_WIDTH - 20;
-        int16_t arrowY = y + 28;
-
-        // Get previous value from history
-        float current = 0, previous = 0;
-        int histIdx = _data.historyCount - 1;
-        int prevIdx = histIdx > 0 ? histIdx - 1 : 0;
-
-        switch (index) {
-            case 0:  // CO2
-                current = static_cast<float>(_data.co2);
-                previous = static_cast<float>(_data.co2History[prevIdx]);
-                break;
-            case 1:  // Temperature
-                current = _data.temperature;
-                previous = static_cast<float>(_data.tempHistory[prevIdx]) / 10.0f;
-                break;
-            case 2:  // Humidity
-                current = _data.humidity;
-                previous = static_cast<float>(_data.humidityHistory[prevIdx]) / 10.0f;
-                break;
-            case 3:  // IAQ
-                current = static_cast<float>(_data.iaq);
-                previous = static_cast<float>(_data.iaqHistory[prevIdx]);
-                break;
-            case 4:  // Pressure
-                current = _data.pressure;
-                previous = static_cast<float>(_data.pressureHistory[prevIdx]) / 10.0f;
-                break;
-            default:
-                break;  // No trend for IAQ Accuracy
-        }
+    float current = 0, previous = 0;
+    if (getTrend(index, current, previous)) {
+        ui::renderTrendArrow(compositor, x + PANEL_WIDTH - 20, y + 28, current, previous);
+    }
+}
 
-        if (index < 5) {  // Show trend for all except IAQ Accuracy
-            ui::renderTrendArrow(compositor, arrowX, arrowY, current, previous);
-        }
+bool SensorDashboard::isConnected(int16_t index) const {
+    if (index < 3) {
+        return _data.stcc4Connected;  // CO2, Temp, Humidity from STCC4
     }
+    return _data.bme688Connected;  // IAQ, Pressure, Accuracy from BME688
+}
+
+bool SensorDashboard::getTrend(int16_t index, float& current, float& previous) const {
+    // No trend for IAQ Accuracy, while disconnected or without history
+    if (index >= 5 || !isConnected(index) || _data.historyCount <= 1) {
+        return false;
+    }
+
+    // Get previous value from history
+    int histIdx = _data.historyCount - 1;
+    int prevIdx = histIdx > 0 ? histIdx - 1 : 0;
+
+    switch (index) {
+        case 0:  // CO2
+            current = static_cast<float>(_data.co2);
+            previous = static_cast<float>(_data.co2History[prevIdx]);
+            break;
+        case 1:  // Temperature
+            current = _data.temperature;
+            previous = static_cast<float>(_data.tempHistory[prevIdx]) / 10.0f;
+            break;
+        case 2:  // Humidity
+            current = _data.humidity;
+            previous = static_cast<float>(_data.humidityHistory[prevIdx]) / 10.0f;
+            break;
+        case 3:  // IAQ
+            current = static_cast<float>(_data.iaq);
+            previous = static_cast<float>(_data.iaqHistory[prevIdx]);
+            break;
+        case 4:  // Pressure
+            current = _data.pressure;
+            previous = static_cast<float>(_data.pressureHistory[prevIdx]) / 10.0f;
+            break;
+    }
+    return true;
+}
+
+void SensorDashboard::formatPanelKey(int16_t index, char* buffer, size_t size) const {
+    // Everything renderPanel() depends on: value text, status, trend direction
+    char value[32];
+    formatValue(index, value, sizeof(value));
+
+    int trend = 0;
+    float current = 0, previous = 0;
+    if (getTrend(index, current, previous)) {
+        if (current > previous + theme::TREND_THRESHOLD) trend = 1;
+        else if (current < previous - theme::TREND_THRESHOLD) trend = -1;
+    }
+
+    snprintf(buffer, size, "%s|%d|%d", value, isConnected(index) ? 1 : 0, trend);
 }
 
 const char* SensorDashboard::getLabel(int16_t index) const {
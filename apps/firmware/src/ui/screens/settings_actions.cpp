@@ -21,10 +21,7 @@ bool SettingsActions::onConfirm() {
     return false;
 }
 
-void SettingsActions::render(Compositor& compositor) {
-    // Background
-    compositor.fillScreen(true);  // White
-
+void SettingsActions::renderChrome(Compositor& compositor) {
     // Header
     compositor.drawText("Settings", 20, 30, &FreeSansBold12pt7b, true);
     compositor.drawText("Actions", config::display::WIDTH - 100, 30, &FreeSans9pt7b, true);
@@ -32,26 +29,6 @@ void SettingsActions::render(Compositor& compositor) {
     // Divider
     compositor.drawHLine(10, 45, config::display::WIDTH - 20, true);
 
-    // Render action items
-    int16_t y = START_Y;
-    int16_t width = config::display::WIDTH - 40;
-
-    for (int i = 0; i < static_cast<int>(DeviceAction::COUNT); i++) {
-        DeviceAction action = static_cast<DeviceAction>(i);
-        bool isSelected = (i == getSelectedIndex());
-
-        // Selection border (thick 2px when selected, 1px otherwise)
-        ui::drawSelectionBorder(compositor, 20, y, width, ITEM_HEIGHT - 5, isSelected);
-
-        // Action name
-        compositor.drawText(getActionName(action), 35, y + 25, &FreeSansBold12pt7b, true);
-
-        // Action description
-        compositor.drawText(getActionDescription(action), 35, y + 45, &FreeSans9pt7b, true);
-
-        y += ITEM_HEIGHT;
-    }
-
     // Action hint
     compositor.drawText("A: Execute selected action", 20, config::display::HEIGHT - 60,
                          &FreeSans9pt7b, true);
@@ -66,6 +43,21 @@ void SettingsActions::render(Compositor& compositor) {
                          &FreeSans9pt7b, true);
 }
 
+void SettingsActions::renderItem(Compositor& compositor, int16_t index, const Rect& bounds) {
+    DeviceAction action = static_cast<DeviceAction>(index);
+    bool isSelected = (index == getSelectedIndex());
+    int16_t y = bounds.y;
+
+    // Selection border (thick 2px when selected, 1px otherwise)
+    ui::drawSelectionBorder(compositor, bounds.x, y, bounds.width, ITEM_HEIGHT - 5, isSelected);
+
+    // Action name
+    compositor.drawText(getActionName(action), 35, y + 25, &FreeSansBold12pt7b, true);
+
+    // Action description
+    compositor.drawText(getActionDescription(action), 35, y + 45, &FreeSans9pt7b, true);
+}
+
 const char* SettingsActions::getActionName(DeviceAction action) const {
     switch (action) {
         case DeviceAction::CALIBRATE_CO2:  return "Calibrate CO2";
@@ -15,8 +15,31 @@ void TadoControl::onEnter() {
 }
 
 void TadoControl::setZones(const std::vector<TadoZone>& zones) {
-    _zones = zones;
-    markDirty();
+    _zonesGeneration = 0;
+    applyZones(zones.data(), zones.size());
+}
+
+void TadoControl::setZones(const TadoZoneTable& table, uint32_t generation) {
+    if (generation == _zonesGeneration) return;
+    _zonesGeneration = generation;
+    applyZones(table.zones, table.count);
+}
+
+void TadoControl::applyZones(const TadoZone* zones, size_t count) {
+    if (count != _zones.size()) {
+        _zones.assign(zones, zones + count);
+        invalidateAll();  // Zone list and empty state change
+        return;
+    }
+
+    // Changes below what is drawn are kept, just not redrawn
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t changes = zones[i].changesFrom(_zones[i]);
+        _zones[i] = zones[i];
+        if (changes) {
+            invalidateItem(static_cast<int16_t>(i));
+        }
+    }
 }
 
 const TadoZone* TadoControl::getSelectedZone() const {
@@ -57,23 +80,16 @@ bool TadoControl::handleTrigger(int16_t leftIntensity, int16_t rightIntensity) {
 
     if (delta != 0.0f) {
         _onTempChange(zone->id, delta);
-        markDirty();  // Temperature changed, need redraw
+        invalidateItem(getSelectedIndex());  // Temperature changed, need redraw
         return true;
     }
     return false;
 }
 
-void TadoControl::render(Compositor& compositor) {
+void TadoControl::renderChrome(Compositor& compositor) {
     // Title
     compositor.drawText("Tado", 20, TITLE_Y, &FreeSansBold18pt7b, true);
 
-    // Render zones
-    int16_t y = START_Y;
-    for (int16_t i = 0; i < static_cast<int16_t>(_zones.size()); i++) {
-        renderZone(compositor, i, y);
-        y += ZONE_HEIGHT + ZONE_SPACING;
-    }
-
     // Empty state
     if (_zones.empty()) {
         compositor.drawTextCentered("No Tado zones found", 0,
@@ -88,6 +104,10 @@ void TadoControl::render(Compositor& compositor) {
     renderPageIndicator(compositor, 2, 3);
 }
 
+void TadoControl::renderItem(Compositor& compositor, int16_t index, const Rect& bounds) {
+    renderZone(compositor, index, bounds.y);
+}
+
 void TadoControl::renderZone(Compositor& compositor, int16_t index, int16_t y) {
     const TadoZone& zone = _zones[index];
     int16_t width = config::display::WIDTH - 2 * MARGIN_X;
@@ -0,0 +1,111 @@
+#include "ui/widget.h"
+
+namespace paperhome {
+
+// =============================================================================
+// Tree
+// =============================================================================
+
+void Widget::addChild(Widget* child) {
+    if (!child) return;
+
+    child->_parent = this;
+    _children.push_back(child);
+    child->invalidate();
+}
+
+void Widget::clearChildren() {
+    for (Widget* child : _children) {
+        child->_parent = nullptr;
+    }
+    _children.clear();
+    invalidate();
+}
+
+// =============================================================================
+// Properties
+// =============================================================================
+
+void Widget::setBounds(const Rect& bounds) {
+    if (bounds == _bounds) return;
+
+    _bounds = bounds;
+
+    // Old area must be cleared too, which only the parent can do
+    if (_parent) {
+        _parent->invalidate();
+    } else {
+        invalidate();
+    }
+}
+
+void Widget::setVisible(bool visible) {
+    if (visible == _visible) return;
+
+    _visible = visible;
+    if (_parent) {
+        _parent->invalidate();
+    } else {
+        invalidate();
+    }
+}
+
+// =============================================================================
+// Dirty Tracking
+// =============================================================================
+
+void Widget::invalidate() {
+    _dirty |= DIRTY_SELF;
+    if (_parent) {
+        _parent->markChildDirty();
+    }
+}
+
+void Widget::markChildDirty() {
+    if (_dirty & DIRTY_CHILDREN) return;  // Ancestors already flagged
+
+    _dirty |= DIRTY_CHILDREN;
+    if (_parent) {
+        _parent->markChildDirty();
+    }
+}
+
+// =============================================================================
+// Rendering
+// =============================================================================
+
+void Widget::render(Compositor& compositor) {
+    if (!_dirty) return;
+
+    if (!_visible) {
+        _dirty = 0;
+        return;
+    }
+
+    if (_dirty & DIRTY_SELF) {
+        paint(compositor);
+        return;
+    }
+
+    // Only descendants changed
+    _dirty = 0;
+    for (Widget* child : _children) {
+        child->render(compositor);
+    }
+}
+
+void Widget::paint(Compositor& compositor) {
+    _dirty = 0;
+    if (!_visible) return;
+
+    if (_opaque) {
+        compositor.fillRect(_bounds.x, _bounds.y, _bounds.width, _bounds.height, false);
+    }
+    draw(compositor);
+
+    for (Widget* child : _children) {
+        child->paint(compositor);
+    }
+}
+
+} // namespace paperhome